@@ -144,14 +144,15 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
     Callers must not call grpc_completion_queue_next and
     grpc_completion_queue_pluck simultaneously on the same completion queue.
 
-    Completion queues support a maximum of GRPC_MAX_COMPLETION_QUEUE_PLUCKERS
-    concurrently executing plucks at any time. */
+    Any number of threads may concurrently pluck (different tags) from the same
+    completion queue. */
 GRPCAPI grpc_event grpc_completion_queue_pluck(grpc_completion_queue* cq,
                                                void* tag, gpr_timespec deadline,
                                                void* reserved);
 
-/** Maximum number of outstanding grpc_completion_queue_pluck executions per
-    completion queue */
+/** Formerly the maximum number of outstanding grpc_completion_queue_pluck
+    executions per completion queue. No longer enforced, kept for source
+    compatibility. */
 #define GRPC_MAX_COMPLETION_QUEUE_PLUCKERS 6
 
 /** Begin destruction of a completion queue. Once all possible events are
@@ -184,6 +185,24 @@ GRPCAPI void grpc_completion_queue_thread_local_cache_init(
 GRPCAPI int grpc_completion_queue_thread_local_cache_flush(
     grpc_completion_queue* cq, void** tag, int* ok);
 
+/*********** EXPERIMENTAL API ************/
+/** Blocks like grpc_completion_queue_next until an event is available, the
+ * completion queue is being shut down, or deadline is reached, and stores that
+ * event in events[0]. If it is a GRPC_OP_COMPLETE event, up to max_events - 1
+ * further completions that are already queued are returned in the following
+ * entries of \a events, without blocking again.
+ *
+ * Returns the number of events stored, which is at least 1 (and exactly 1 if
+ * events[0] is a GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN event).
+ * \a max_events must be positive. Only valid for completion queues of type
+ * GRPC_CQ_NEXT.
+ */
+GRPCAPI size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                                grpc_event* events,
+                                                size_t max_events,
+                                                gpr_timespec deadline,
+                                                void* reserved);
+
 /** Check the connectivity state of a channel. */
 GRPCAPI grpc_connectivity_state grpc_channel_check_connectivity_state(
     grpc_channel* channel, int try_to_connect);
@@ -145,6 +145,10 @@ typedef struct {
 /** Request that optional features default to off (regardless of what they
     usually default to) - to enable tight control over what gets enabled */
 #define GRPC_ARG_MINIMAL_STACK "grpc.minimal_stack"
+/** If non-zero, the arenas backing calls are recycled through a per-channel
+    (or, on servers, per-server) pool, so that steady state call creation does
+    not allocate. Defaults to 1. */
+#define GRPC_ARG_CALL_ARENA_POOL "grpc.call_arena_pool"
 /** Maximum number of concurrent incoming streams to allow on a http2
     connection. Int valued. */
 #define GRPC_ARG_MAX_CONCURRENT_STREAMS "grpc.max_concurrent_streams"
@@ -202,6 +206,13 @@ typedef struct {
 #define GRPC_ARG_HTTP2_MAX_FRAME_SIZE "grpc.http2.max_frame_size"
 /** Should BDP probing be performed? */
 #define GRPC_ARG_HTTP2_BDP_PROBE "grpc.http2.bdp_probe"
+/** If non-zero, BDP probing sizes the announced flow control windows, and so
+    the stream lookahead, from the bottleneck bandwidth and minimum round trip
+    time measured continuously from incoming data and ping acks, rather than
+    from smoothed per-ping samples. Has no effect when BDP probing is off.
+    Defaults to 0. */
+#define GRPC_ARG_HTTP2_DELIVERY_RATE_AUTOTUNING \
+  "grpc.http2.delivery_rate_autotuning"
 /** Minimum time between sending successive ping frames without receiving any
     data/header frame, Int valued, milliseconds. */
 #define GRPC_ARG_HTTP2_MIN_SENT_PING_INTERVAL_WITHOUT_DATA_MS \
@@ -228,6 +239,30 @@ typedef struct {
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
+/** If non-zero, the streams of an http2 connection share each write by
+    deficit round robin: streams with at most this many bytes of data pending
+    are written first, and the others take turns sending at most this many
+    bytes each, so that a bulk stream cannot delay small calls multiplexed
+    with it by a whole write. Zero (the default) writes streams in the order
+    they became writable. Int valued, bytes. */
+#define GRPC_ARG_HTTP2_WRITE_QUANTUM_BYTES "grpc.http2.write_quantum_bytes"
+/** If non-zero, an http2 connection that is writing frequently holds back
+    small writes for up to this long so that the frames queued meanwhile go
+    out in the same syscall, trading latency for fewer writes. Holding back
+    stops by itself while it coalesces nothing. Timers have millisecond
+    resolution, so the delay is rounded up to a whole millisecond. Defaults to
+    0 (write immediately). Int valued, microseconds. */
+#define GRPC_ARG_HTTP2_WRITE_CORK_US "grpc.http2.write_cork_us"
+/** If non-zero, http2 connections over sockets size each write from the
+    socket's TCP_NOTSENT_LOWAT threshold or send buffer, instead of aiming for
+    1MB. Defaults to 0. */
+#define GRPC_ARG_HTTP2_ADAPTIVE_WRITE_SIZE "grpc.http2.adaptive_write_size"
+/** If non-zero, http2 connections keep their streams in a hash table rather
+    than a sorted array, which is faster with more than a few dozen open
+    streams and slower with only a handful. Defaults to non-zero on servers
+    configured with a GRPC_ARG_MAX_CONCURRENT_STREAMS of at least 100, and to
+    0 otherwise. */
+#define GRPC_ARG_HTTP2_HASHED_STREAM_MAP "grpc.http2.hashed_stream_map"
 /** After a duration of this time the client/server pings its peer to see if the
     transport is still alive. Int valued, milliseconds. */
 #define GRPC_ARG_KEEPALIVE_TIME_MS "grpc.keepalive_time_ms"
@@ -281,6 +316,26 @@ typedef struct {
  *        can break old binaries that don't support larger than 1MiB frame
  *        size. */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** If non-zero, hand TLS record protection to the kernel (Linux kTLS) once
+ *  the handshake completes, so that the TCP endpoint is used without a
+ *  userspace protector. Only TLS 1.2 AES-GCM connections using BoringSSL are
+ *  offloaded; anything else, or a kernel without the tls module, silently
+ *  keeps protecting records in userspace. Zero-copy TCP sends and receives are
+ *  disabled on offloaded connections. Boolean, defaults to false. */
+#define GRPC_ARG_TLS_KERNEL_OFFLOAD "grpc.tls.kernel_offload"
+/** If non-zero, run the steps of security handshakes (TLS key exchange and
+ *  certificate verification) on a dedicated process-wide pool with one
+ *  thread per core instead of on the thread polling the connection, so that
+ *  a burst of new connections does not hold up the established ones.
+ *  Boolean, defaults to false. */
+#define GRPC_ARG_SECURITY_HANDSHAKE_THREAD_POOL \
+  "grpc.security_handshake_thread_pool"
+/** Number of handshake steps allowed to wait for a thread of the pool enabled
+ *  by GRPC_ARG_SECURITY_HANDSHAKE_THREAD_POOL. Handshakes needing a step while
+ *  this many are already waiting fail, and the peer has to reconnect later.
+ *  Int valued, defaults to 1024. */
+#define GRPC_ARG_SECURITY_HANDSHAKE_THREAD_POOL_QUEUE_LIMIT \
+  "grpc.security_handshake_thread_pool_queue_limit"
 /** Maximum metadata size, in bytes. Note this limit applies to the max sum of
     all metadata key-value entries in a batch of headers. */
 #define GRPC_ARG_MAX_METADATA_SIZE "grpc.max_metadata_size"
@@ -343,6 +398,17 @@ typedef struct {
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, large reads map the received pages into the process instead of
+   copying them (TCP_ZEROCOPY_RECEIVE, Linux 4.18+). By default, it is
+   disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy receive threshold: only zerocopy if >= this many bytes are
+   pending on the socket; smaller reads are copied. By default, this is set to
+   64KB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_recv_bytes_threshold"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -174,6 +174,22 @@ class CompletionQueue : private ::grpc::GrpcLibraryCodegen {
                                   GPR_CLOCK_REALTIME)) != SHUTDOWN);
   }
 
+  /// EXPERIMENTAL
+  /// Read up to \a max_events events from the queue, blocking until at least
+  /// one is available or the queue is shutting down. Events that are already
+  /// queued behind the first one are returned by the same call, which
+  /// amortizes the cost of retrieving them when events arrive in bursts.
+  ///
+  /// \param tags [out] Updated to point to the read events' tags.
+  /// \param oks [out] oks[i] is the \a ok value of the event with tag
+  ///        tags[i]. See documentation for CompletionQueue::Next for
+  ///        explanation of ok.
+  /// \param max_events [in] Number of entries in \a tags and \a oks.
+  ///
+  /// \return The number of events read, 0 if the queue is fully drained and
+  ///         shut down.
+  size_t NextBatch(void** tags, bool* oks, size_t max_events);
+
   /// Read from the queue, blocking up to \a deadline (or the queue's shutdown).
   /// Both \a tag and \a ok are updated upon success (if an event is available
   /// within the \a deadline).  A \a tag points to an arbitrary location usually
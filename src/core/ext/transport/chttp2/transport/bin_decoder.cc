@@ -22,6 +22,8 @@
 #include <grpc/support/log.h>
 #include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/slice/b64.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 
@@ -110,6 +112,16 @@ bool grpc_base64_decode_partial(struct grpc_base64_decode_context* ctx) {
     return false;
   }
 
+  // Process as many blocks as possible in bulk
+  const size_t blocks =
+      GPR_MIN(static_cast<size_t>(ctx->input_end - ctx->input_cur) / 4,
+              static_cast<size_t>(ctx->output_end - ctx->output_cur) / 3);
+  const size_t decoded = grpc_base64_decode_blocks(
+      ctx->output_cur, reinterpret_cast<const char*>(ctx->input_cur),
+      blocks * 4, 0);
+  ctx->output_cur += decoded / 4 * 3;
+  ctx->input_cur += decoded;
+
   // Process a block of 4 input characters and 3 output bytes
   while (ctx->input_end >= ctx->input_cur + 4 &&
          ctx->output_end >= ctx->output_cur + 3) {
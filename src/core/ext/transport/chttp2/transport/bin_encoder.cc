@@ -24,6 +24,8 @@
 
 #include <grpc/support/log.h>
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/slice/b64.h"
 
 static const char alphabet[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
@@ -57,8 +59,11 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   char* out = reinterpret_cast<char*> GRPC_SLICE_START_PTR(output);
   size_t i;
 
-  /* encode full triplets */
-  for (i = 0; i < input_triplets; i++) {
+  /* encode full triplets, in bulk where possible */
+  const size_t encoded = grpc_base64_encode_blocks(out, in, input_length, 0);
+  out += encoded / 3 * 4;
+  in += encoded;
+  for (i = encoded / 3; i < input_triplets; i++) {
     out[0] = alphabet[in[0] >> 2];
     out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
     out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
@@ -136,7 +141,7 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
 }
 
 struct huff_out {
-  uint32_t temp;
+  uint64_t temp;
   uint32_t temp_length;
   uint8_t* out;
 };
@@ -151,7 +156,7 @@ static void enc_add2(huff_out* out, uint8_t a, uint8_t b) {
   b64_huff_sym sa = huff_alphabet[a];
   b64_huff_sym sb = huff_alphabet[b];
   out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
+              (static_cast<uint64_t>(sa.bits) << sb.length) | sb.bits;
   out->temp_length +=
       static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
   enc_flush_some(out);
@@ -164,6 +169,20 @@ static void enc_add1(huff_out* out, uint8_t a) {
   enc_flush_some(out);
 }
 
+/* add the four base64 characters of an encoded triplet */
+static void enc_add4_chars(huff_out* out, const char* chars) {
+  for (int i = 0; i < 4; i++) {
+    const grpc_chttp2_huffsym& sym =
+        grpc_chttp2_huffsyms[static_cast<uint8_t>(chars[i])];
+    out->temp = (out->temp << sym.length) | sym.bits;
+    out->temp_length += sym.length;
+  }
+  enc_flush_some(out);
+}
+
+/* number of input triplets base64 encoded at a time before compression */
+#define ENCODE_CHUNK_TRIPLETS 64
+
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     const grpc_slice& input) {
   size_t input_length = GRPC_SLICE_LENGTH(input);
@@ -182,8 +201,23 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   out.temp_length = 0;
   out.out = start_out;
 
-  /* encode full triplets */
-  for (i = 0; i < input_triplets; i++) {
+  /* encode full triplets: base64 encode a chunk of them in bulk, then huffman
+     compress the characters, falling back to encoding triplet by triplet
+     wherever the bulk encoder declines */
+  for (i = 0; i < input_triplets;) {
+    char chunk[4 * ENCODE_CHUNK_TRIPLETS];
+    const size_t encoded = grpc_base64_encode_blocks(
+        chunk, in,
+        GPR_MIN(input_length - 3 * i, 3 * ENCODE_CHUNK_TRIPLETS + 4), 0);
+    if (encoded != 0) {
+      for (size_t j = 0; j < encoded / 3 * 4; j += 4) {
+        enc_add4_chars(&out, chunk + j);
+      }
+      in += encoded;
+      i += encoded / 3;
+      continue;
+    }
+
     const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
     const uint8_t high_to_low = in[1] >> 4;
     enc_add2(&out, in[0] >> 2, low_to_high | high_to_low);
@@ -192,6 +226,7 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     const uint8_t b = (in[2] >> 6);
     enc_add2(&out, a | b, in[2] & 0x3f);
     in += 3;
+    i++;
   }
 
   /* encode the remaining bytes */
@@ -44,6 +44,7 @@
 #include "src/core/lib/http/parser.h"
 #include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/iomgr.h"
+#include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -57,6 +58,10 @@
 #include "src/core/lib/transport/transport_impl.h"
 #include "src/core/lib/uri/uri_parser.h"
 
+#ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
+#include "src/core/lib/iomgr/socket_utils_posix.h"
+#endif
+
 #define DEFAULT_CONNECTION_WINDOW_TARGET (1024 * 1024)
 #define MAX_WINDOW 0x7fffffffu
 #define MAX_WRITE_BUFFER_SIZE (64 * 1024 * 1024)
@@ -76,6 +81,13 @@
 
 #define DEFAULT_MAX_PENDING_INDUCED_FRAMES 10000
 
+#define HASHED_STREAM_MAP_MIN_CONCURRENT_STREAMS 100
+
+#define MIN_ADAPTIVE_WRITE_SIZE (16 * 1024)
+#define MAX_ADAPTIVE_WRITE_SIZE (4 * 1024 * 1024)
+#define WRITES_PER_WRITE_SIZE_UPDATE 64
+#define MAX_WRITE_CORK_BACKOFF 64
+
 static int g_default_client_keepalive_time_ms =
     DEFAULT_CLIENT_KEEPALIVE_TIME_MS;
 static int g_default_client_keepalive_timeout_ms =
@@ -104,6 +116,8 @@ grpc_core::DebugOnlyTraceFlag grpc_trace_chttp2_refcount(false,
 
 // forward declarations of various callbacks that we'll build closures around
 static void write_action_begin_locked(void* t, grpc_error* error);
+static void write_cork_timer_expired(void* t, grpc_error* error);
+static void write_cork_timer_expired_locked(void* t, grpc_error* error);
 static void write_action(void* t, grpc_error* error);
 static void write_action_end(void* t, grpc_error* error);
 static void write_action_end_locked(void* t, grpc_error* error);
@@ -188,7 +202,7 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
   grpc_chttp2_hpack_compressor_destroy(&hpack_compressor);
 
   grpc_error* error =
-      GRPC_ERROR_CREATE_FROM_STATIC_STRING("Transport destroyed");
+      GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_TRANSPORT_DESTROYED);
   // ContextList::Execute follows semantics of a callback function and does not
   // take a ref on error
   grpc_core::ContextList::Execute(cl, nullptr, error);
@@ -212,8 +226,8 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
 
   GRPC_COMBINER_UNREF(combiner, "chttp2_transport");
 
-  cancel_pings(this,
-               GRPC_ERROR_CREATE_FROM_STATIC_STRING("Transport destroyed"));
+  cancel_pings(
+      this, GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_TRANSPORT_DESTROYED));
 
   while (write_cb_pool) {
     grpc_chttp2_write_cb* next = write_cb_pool->next;
@@ -232,7 +246,8 @@ static const grpc_transport_vtable* get_vtable(void);
 // Returns whether bdp is enabled
 static bool read_channel_args(grpc_chttp2_transport* t,
                               const grpc_channel_args* channel_args,
-                              bool is_client) {
+                              bool is_client,
+                              grpc_core::chttp2::AutotuneMode* autotune_mode) {
   bool enable_bdp = true;
   bool channelz_enabled = GRPC_ENABLE_CHANNELZ_DEFAULT;
   size_t i;
@@ -293,9 +308,31 @@ static bool read_channel_args(grpc_chttp2_transport* t,
                            GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)) {
       t->write_buffer_size = static_cast<uint32_t>(grpc_channel_arg_get_integer(
           &channel_args->args[i], {0, 0, MAX_WRITE_BUFFER_SIZE}));
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_WRITE_QUANTUM_BYTES)) {
+      t->write_quantum = static_cast<uint32_t>(grpc_channel_arg_get_integer(
+          &channel_args->args[i], {0, 0, INT_MAX}));
+      t->write_scheduler =
+          t->write_quantum == 0
+              ? GRPC_CHTTP2_WRITE_SCHEDULER_FIFO
+              : GRPC_CHTTP2_WRITE_SCHEDULER_DEFICIT_ROUND_ROBIN;
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_WRITE_CORK_US)) {
+      t->write_cork_us = grpc_channel_arg_get_integer(&channel_args->args[i],
+                                                      {0, 0, INT_MAX});
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_ADAPTIVE_WRITE_SIZE)) {
+      t->adaptive_write_size =
+          grpc_channel_arg_get_bool(&channel_args->args[i], false);
     } else if (0 ==
                strcmp(channel_args->args[i].key, GRPC_ARG_HTTP2_BDP_PROBE)) {
       enable_bdp = grpc_channel_arg_get_bool(&channel_args->args[i], true);
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_DELIVERY_RATE_AUTOTUNING)) {
+      *autotune_mode =
+          grpc_channel_arg_get_bool(&channel_args->args[i], false)
+              ? grpc_core::chttp2::AutotuneMode::kDeliveryRate
+              : grpc_core::chttp2::AutotuneMode::kBdpPid;
     } else if (0 ==
                strcmp(channel_args->args[i].key, GRPC_ARG_KEEPALIVE_TIME_MS)) {
       const int value = grpc_channel_arg_get_integer(
@@ -431,6 +468,22 @@ static void init_keepalive_pings_if_enabled(grpc_chttp2_transport* t) {
   }
 }
 
+// The hash table representation keeps stream lookup, add and delete constant
+// time however many streams are open, but the sorted array is faster for the
+// few streams most connections carry (see BM_StreamMapChurn). Servers expecting
+// many concurrent streams get the hash table unless told otherwise.
+static bool use_hashed_stream_map(const grpc_channel_args* channel_args,
+                                  bool is_client) {
+  bool hashed_default =
+      !is_client &&
+      grpc_channel_args_find_integer(channel_args,
+                                     GRPC_ARG_MAX_CONCURRENT_STREAMS,
+                                     {-1, -1, INT32_MAX}) >=
+          HASHED_STREAM_MAP_MIN_CONCURRENT_STREAMS;
+  return grpc_channel_args_find_bool(
+      channel_args, GRPC_ARG_HTTP2_HASHED_STREAM_MAP, hashed_default);
+}
+
 grpc_chttp2_transport::grpc_chttp2_transport(
     const grpc_channel_args* channel_args, grpc_endpoint* ep, bool is_client,
     grpc_resource_user* resource_user)
@@ -454,7 +507,11 @@ grpc_chttp2_transport::grpc_chttp2_transport(
   //   large enough that the exponential growth should happen nicely when it's
   //   needed.
   //   TODO(ctiller): tune this
-  grpc_chttp2_stream_map_init(&stream_map, 8);
+  if (use_hashed_stream_map(channel_args, is_client)) {
+    grpc_chttp2_stream_map_init_hashed(&stream_map, 8);
+  } else {
+    grpc_chttp2_stream_map_init(&stream_map, 8);
+  }
 
   grpc_slice_buffer_init(&read_buffer);
   grpc_slice_buffer_init(&outbuf);
@@ -489,13 +546,16 @@ grpc_chttp2_transport::grpc_chttp2_transport(
   init_transport_keepalive_settings(this);
 
   bool enable_bdp = true;
+  grpc_core::chttp2::AutotuneMode autotune_mode =
+      grpc_core::chttp2::AutotuneMode::kBdpPid;
   if (channel_args) {
-    enable_bdp = read_channel_args(this, channel_args, is_client);
+    enable_bdp =
+        read_channel_args(this, channel_args, is_client, &autotune_mode);
   }
 
   if (g_flow_control_enabled) {
-    flow_control.Init<grpc_core::chttp2::TransportFlowControl>(this,
-                                                               enable_bdp);
+    flow_control.Init<grpc_core::chttp2::TransportFlowControl>(
+        this, enable_bdp, autotune_mode);
   } else {
     flow_control.Init<grpc_core::chttp2::TransportFlowControlDisabled>(this);
     enable_bdp = false;
@@ -525,9 +585,7 @@ static void destroy_transport_locked(void* tp, grpc_error* /*error*/) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
   t->destroying = 1;
   close_transport_locked(
-      t, grpc_error_set_int(
-             GRPC_ERROR_CREATE_FROM_STATIC_STRING("Transport destroyed"),
-             GRPC_ERROR_INT_OCCURRED_DURING_WRITE, t->write_state));
+      t, GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_TRANSPORT_DESTROYED));
   // Must be the last line.
   GRPC_CHTTP2_UNREF_TRANSPORT(t, "destroy");
 }
@@ -555,6 +613,11 @@ static void close_transport_locked(grpc_chttp2_transport* t,
       }
       t->close_transport_on_writes_finished =
           grpc_error_add_child(t->close_transport_on_writes_finished, error);
+      if (t->write_corked) {
+        // Let the held back write go out now, so that the close is not
+        // delayed by the cork.
+        grpc_timer_cancel(&t->write_cork_timer);
+      }
       return;
     }
     GPR_ASSERT(error != GRPC_ERROR_NONE);
@@ -933,15 +996,87 @@ static const char* begin_writing_desc(bool partial) {
   }
 }
 
-static void write_action_begin_locked(void* gt, grpc_error* /*error_ignored*/) {
-  GPR_TIMER_SCOPE("write_action_begin_locked", 0);
-  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
+// Re-measures how many bytes a write can usefully hand to the socket.
+static void update_target_write_size(grpc_chttp2_transport* t) {
+#ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
+  int fd = grpc_endpoint_get_fd(t->ep);
+  if (fd < 0) return;
+  int bytes;
+  grpc_error* error = grpc_get_socket_write_capacity(fd, &bytes);
+  if (error != GRPC_ERROR_NONE) {
+    GRPC_CHTTP2_IF_TRACING(gpr_log(GPR_INFO, "%s: failed to size writes: %s",
+                                   t->peer_string.c_str(),
+                                   grpc_error_string(error)));
+    GRPC_ERROR_UNREF(error);
+    return;
+  }
+  t->target_write_size = static_cast<uint32_t>(GPR_CLAMP(
+      bytes, MIN_ADAPTIVE_WRITE_SIZE, MAX_ADAPTIVE_WRITE_SIZE));
+#else
+  (void)t;
+#endif
+}
+
+// Decides whether to hold back the write that has just been gathered into
+// outbuf, and if so arms the cork timer. Only small writes that follow the
+// previous one closely are held back, and never ones carrying frames the peer
+// is waiting on or a ping whose round trip is being timed.
+static bool maybe_cork_write(grpc_chttp2_transport* t, bool urgent) {
+  if (t->write_cork_us == 0 || urgent) return false;
+  if (t->outbuf.length * 4 >= t->target_write_size) return false;
+  gpr_timespec cork_window_end = gpr_time_add(
+      t->last_write_time, gpr_time_from_micros(t->write_cork_us, GPR_TIMESPAN));
+  if (gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), cork_window_end) >= 0) {
+    return false;
+  }
+  if (t->write_cork_skip > 0) {
+    --t->write_cork_skip;
+    return false;
+  }
+  t->write_corked = true;
+  t->write_cork_start_length = t->outbuf.length;
+  GRPC_CLOSURE_INIT(&t->write_cork_timer_expired_locked,
+                    write_cork_timer_expired, t, grpc_schedule_on_exec_ctx);
+  grpc_timer_init(&t->write_cork_timer,
+                  grpc_core::ExecCtx::Get()->Now() +
+                      (t->write_cork_us + GPR_US_PER_MS - 1) / GPR_US_PER_MS,
+                  &t->write_cork_timer_expired_locked);
+  return true;
+}
+
+// Held back writes that gained nothing make us let the next few writes
+// through straight away, backing off exponentially while that keeps happening.
+static void note_write_cork_result(grpc_chttp2_transport* t) {
+  if (t->outbuf.length > t->write_cork_start_length) {
+    t->write_cork_backoff = 0;
+    return;
+  }
+  t->write_cork_backoff =
+      GPR_MIN(GPR_MAX(1u, t->write_cork_backoff * 2), MAX_WRITE_CORK_BACKOFF);
+  t->write_cork_skip = t->write_cork_backoff;
+}
+
+static void begin_write_locked(grpc_chttp2_transport* t, bool cork_expired) {
   GPR_ASSERT(t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE);
   grpc_chttp2_begin_write_result r;
+  bool urgent = false;
   if (t->closed_with_error != GRPC_ERROR_NONE) {
     r.writing = false;
   } else {
+    if (t->adaptive_write_size && t->writes_until_write_size_update-- == 0) {
+      update_target_write_size(t);
+      t->writes_until_write_size_update = WRITES_PER_WRITE_SIZE_UPDATE;
+    }
+    const uint64_t ping_ctr = t->ping_ctr;
+    urgent = t->num_pending_induced_frames > 0 || t->ping_ack_count > 0;
     r = grpc_chttp2_begin_write(t);
+    urgent = urgent || t->ping_ctr != ping_ctr;
+  }
+  if (cork_expired) {
+    note_write_cork_result(t);
+  } else if (r.writing && !r.partial && maybe_cork_write(t, urgent)) {
+    // Keep the write state and the "writing" ref until the timer fires.
+    return;
   }
   if (r.writing) {
     if (r.partial) {
@@ -972,11 +1107,36 @@ static void write_action_begin_locked(void* gt, grpc_error* /*error_ignored*/) {
   }
 }
 
+static void write_action_begin_locked(void* gt, grpc_error* /*error_ignored*/) {
+  GPR_TIMER_SCOPE("write_action_begin_locked", 0);
+  begin_write_locked(static_cast<grpc_chttp2_transport*>(gt), false);
+}
+
+static void write_cork_timer_expired(void* gt, grpc_error* error) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
+  t->combiner->Run(GRPC_CLOSURE_INIT(&t->write_cork_timer_expired_locked,
+                                     write_cork_timer_expired_locked, t,
+                                     nullptr),
+                   GRPC_ERROR_REF(error));
+}
+
+// Sends the held back write together with whatever was queued since. This
+// also runs, early, when the timer is cancelled by the transport closing.
+static void write_cork_timer_expired_locked(void* gt,
+                                            grpc_error* /*error*/) {
+  GPR_TIMER_SCOPE("write_cork_timer_expired_locked", 0);
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
+  GPR_ASSERT(t->write_corked);
+  t->write_corked = false;
+  begin_write_locked(t, true);
+}
+
 static void write_action(void* gt, grpc_error* /*error*/) {
   GPR_TIMER_SCOPE("write_action", 0);
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
   void* cl = t->cl;
   t->cl = nullptr;
+  t->last_write_time = gpr_now(GPR_CLOCK_MONOTONIC);
   grpc_endpoint_write(
       t->ep, &t->outbuf,
       GRPC_CLOSURE_INIT(&t->write_action_end_locked, write_action_end, t,
@@ -2008,7 +2168,7 @@ static void remove_stream(grpc_chttp2_transport* t, uint32_t id,
     if (s->on_next != nullptr) {
       grpc_core::Chttp2IncomingByteStream* bs = s->data_parser.parsing_frame;
       if (error == GRPC_ERROR_NONE) {
-        error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Truncated message");
+        error = GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_TRUNCATED_MESSAGE);
       }
       bs->PublishError(error);
       bs->Unref();
@@ -3071,7 +3231,7 @@ grpc_error* Chttp2IncomingByteStream::Pull(grpc_slice* slice) {
       return error;
     }
   } else {
-    error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Truncated message");
+    error = GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_TRUNCATED_MESSAGE);
     stream_->t->combiner->Run(&stream_->reset_byte_stream,
                               GRPC_ERROR_REF(error));
     return error;
@@ -3079,6 +3239,32 @@ grpc_error* Chttp2IncomingByteStream::Pull(grpc_slice* slice) {
   return GRPC_ERROR_NONE;
 }
 
+// Deframes everything received so far for this message, handing on sub-slices
+// of the slices the endpoint read into. Stream compression produces new slices
+// as it goes, so that case keeps to one slice per call.
+grpc_error* Chttp2IncomingByteStream::PullAvailable(grpc_slice_buffer* slices) {
+  GPR_TIMER_SCOPE("incoming_byte_stream_pull_available", 0);
+  if (stream_->stream_decompression_method !=
+          GRPC_STREAM_COMPRESSION_IDENTITY_DECOMPRESS ||
+      stream_->unprocessed_incoming_frames_buffer.length == 0) {
+    return ByteStream::PullAvailable(slices);
+  }
+  while (remaining_bytes_ > 0 &&
+         stream_->unprocessed_incoming_frames_buffer.length > 0) {
+    grpc_slice slice = grpc_empty_slice();
+    grpc_error* error = grpc_deframe_unprocessed_incoming_frames(
+        &stream_->data_parser, stream_,
+        &stream_->unprocessed_incoming_frames_buffer, &slice, nullptr);
+    if (error != GRPC_ERROR_NONE) {
+      return error;
+    }
+    if (GRPC_SLICE_LENGTH(slice) > 0) {
+      grpc_slice_buffer_add(slices, slice);
+    }
+  }
+  return GRPC_ERROR_NONE;
+}
+
 void Chttp2IncomingByteStream::PublishError(grpc_error* error) {
   GPR_ASSERT(error != GRPC_ERROR_NONE);
   grpc_core::ExecCtx::Run(DEBUG_LOCATION, stream_->on_next,
@@ -3111,7 +3297,7 @@ grpc_error* Chttp2IncomingByteStream::Finished(grpc_error* error,
                                                bool reset_on_error) {
   if (error == GRPC_ERROR_NONE) {
     if (remaining_bytes_ != 0) {
-      error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Truncated message");
+      error = GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_TRUNCATED_MESSAGE);
     }
   }
   if (error != GRPC_ERROR_NONE && reset_on_error) {
@@ -3173,7 +3359,7 @@ static void benign_reclaimer_locked(void* arg, grpc_error* error) {
     }
     send_goaway(t,
                 grpc_error_set_int(
-                    GRPC_ERROR_CREATE_FROM_STATIC_STRING("Buffers full"),
+                    GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_BUFFERS_FULL),
                     GRPC_ERROR_INT_HTTP2_ERROR, GRPC_HTTP2_ENHANCE_YOUR_CALM));
   } else if (error == GRPC_ERROR_NONE &&
              GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace)) {
@@ -3211,9 +3397,9 @@ static void destructive_reclaimer_locked(void* arg, grpc_error* error) {
     }
     grpc_chttp2_cancel_stream(
         t, s,
-        grpc_error_set_int(GRPC_ERROR_CREATE_FROM_STATIC_STRING("Buffers full"),
-                           GRPC_ERROR_INT_HTTP2_ERROR,
-                           GRPC_HTTP2_ENHANCE_YOUR_CALM));
+        grpc_error_set_int(
+            GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_BUFFERS_FULL),
+            GRPC_ERROR_INT_HTTP2_ERROR, GRPC_HTTP2_ENHANCE_YOUR_CALM));
     if (n > 1) {
       // Since we cancel one stream per destructive reclamation, if
       //   there are more streams left, we can immediately post a new
@@ -175,7 +175,8 @@ TransportFlowControlDisabled::TransportFlowControlDisabled(
 }
 
 TransportFlowControl::TransportFlowControl(const grpc_chttp2_transport* t,
-                                           bool enable_bdp_probe)
+                                           bool enable_bdp_probe,
+                                           AutotuneMode autotune_mode)
     : t_(t),
       enable_bdp_probe_(enable_bdp_probe),
       bdp_estimator_(t->peer_string.c_str()),
@@ -187,7 +188,9 @@ TransportFlowControl::TransportFlowControl(const grpc_chttp2_transport* t,
                           .set_min_control_value(-1)
                           .set_max_control_value(25)
                           .set_integral_range(10)),
-      last_pid_update_(grpc_core::ExecCtx::Get()->Now()) {}
+      last_pid_update_(grpc_core::ExecCtx::Get()->Now()),
+      autotune_mode_(autotune_mode),
+      delivery_rate_estimator_(t->peer_string.c_str()) {}
 
 uint32_t TransportFlowControl::MaybeSendUpdate(bool writing_anyway) {
   FlowControlTrace trace("t updt sent", this, nullptr);
@@ -304,6 +307,9 @@ void StreamFlowControl::IncomingByteStreamUpdate(size_t max_size_hint,
   }
 }
 
+static const double kHighMemPressure = 0.8;
+static const double kMaxMemPressure = 0.9;
+
 // Take in a target and modifies it based on the memory pressure of the system
 static double AdjustForMemoryPressure(grpc_resource_quota* quota,
                                       double target) {
@@ -311,8 +317,6 @@ static double AdjustForMemoryPressure(grpc_resource_quota* quota,
   double memory_pressure = grpc_resource_quota_get_memory_pressure(quota);
   static const double kLowMemPressure = 0.1;
   static const double kZeroTarget = 22;
-  static const double kHighMemPressure = 0.8;
-  static const double kMaxMemPressure = 0.9;
   if (memory_pressure < kLowMemPressure && target < kZeroTarget) {
     target = (target - kZeroTarget) * memory_pressure / kLowMemPressure +
              kZeroTarget;
@@ -351,40 +355,90 @@ FlowControlAction::Urgency TransportFlowControl::DeltaUrgency(
   }
 }
 
+// Sizes the window to the measured bandwidth-delay product, times the gain
+// BBR gives its congestion window: generous while the bandwidth is still
+// growing, so that the sender can show the link carries more, and twice the
+// product once it has stopped. Unlike TargetLogBdp, low memory pressure does
+// not inflate the target, so that fast local links keep small windows.
+double TransportFlowControl::TargetDeliveryRateWindow() {
+  static const double kStartupGain = 2.885;  // 2/ln(2)
+  static const double kSteadyGain = 2;
+  double target = static_cast<double>(delivery_rate_estimator_.EstimateBdp()) *
+                  (delivery_rate_estimator_.filled_pipe() ? kSteadyGain
+                                                          : kStartupGain);
+  double memory_pressure = grpc_resource_quota_get_memory_pressure(
+      grpc_resource_user_quota(grpc_endpoint_get_resource_user(t_->ep)));
+  if (memory_pressure > kHighMemPressure) {
+    target *= 1 - GPR_MIN(1, (memory_pressure - kHighMemPressure) /
+                                 (kMaxMemPressure - kHighMemPressure));
+  }
+  // Never announce less than the HTTP/2 default.
+  return GPR_MAX(target, kDefaultWindow);
+}
+
+FlowControlAction TransportFlowControl::UpdateDeliveryRateTargets() {
+  return UpdateTargets(TargetDeliveryRateWindow(),
+                       delivery_rate_estimator_.EstimateBandwidth());
+}
+
+FlowControlAction TransportFlowControl::UpdateTargets(double target,
+                                                      double bw_dbl) {
+  FlowControlAction action;
+  // Though initial window 'could' drop to 0, we keep the floor at 128
+  target_initial_window_size_ =
+      static_cast<int32_t> GPR_CLAMP(target, 128, INT32_MAX);
+
+  action.set_send_initial_window_update(
+      DeltaUrgency(target_initial_window_size_,
+                   GRPC_CHTTP2_SETTINGS_INITIAL_WINDOW_SIZE),
+      static_cast<uint32_t>(target_initial_window_size_));
+
+  // we target the max of BDP or bandwidth in microseconds.
+  int32_t frame_size = static_cast<int32_t> GPR_CLAMP(
+      GPR_MAX((int32_t)GPR_CLAMP(bw_dbl, 0, INT_MAX) / 1000,
+              target_initial_window_size_),
+      16384, 16777215);
+  action.set_send_max_frame_size_update(
+      DeltaUrgency(static_cast<int64_t>(frame_size),
+                   GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE),
+      frame_size);
+  return action;
+}
+
 FlowControlAction TransportFlowControl::PeriodicUpdate() {
   FlowControlAction action;
   if (enable_bdp_probe_) {
-    // get bdp estimate and update initial_window accordingly.
-    // target might change based on how much memory pressure we are under
-    // TODO(ncteisen): experiment with setting target to be huge under low
-    // memory pressure.
-    double target = pow(2, SmoothLogBdp(TargetLogBdp()));
+    double target = 0;
+    double bw_dbl = 0;
+    switch (autotune_mode_) {
+      case AutotuneMode::kBdpPid:
+        // get bdp estimate and update initial_window accordingly.
+        // target might change based on how much memory pressure we are under
+        // TODO(ncteisen): experiment with setting target to be huge under low
+        // memory pressure.
+        target = pow(2, SmoothLogBdp(TargetLogBdp()));
+        bw_dbl = bdp_estimator_.EstimateBandwidth();
+        break;
+      case AutotuneMode::kDeliveryRate:
+        // Called as each BDP ping completes: its round trip feeds the
+        // minimum RTT, while bandwidth is sampled as data arrives.
+        if (gpr_time_cmp(bdp_estimator_.last_ping_rtt(),
+                         gpr_time_0(GPR_TIMESPAN)) > 0) {
+          delivery_rate_estimator_.AddRttSample(
+              bdp_estimator_.last_ping_rtt(), gpr_now(GPR_CLOCK_MONOTONIC));
+        }
+        delivery_rate_sampled_ = false;
+        target = TargetDeliveryRateWindow();
+        bw_dbl = delivery_rate_estimator_.EstimateBandwidth();
+        break;
+    }
     if (g_test_only_transport_target_window_estimates_mocker != nullptr) {
       // Hook for simulating unusual flow control situations in tests.
       target = g_test_only_transport_target_window_estimates_mocker
                    ->ComputeNextTargetInitialWindowSizeFromPeriodicUpdate(
                        target_initial_window_size_ /* current target */);
     }
-    // Though initial window 'could' drop to 0, we keep the floor at 128
-    target_initial_window_size_ =
-        static_cast<int32_t> GPR_CLAMP(target, 128, INT32_MAX);
-
-    action.set_send_initial_window_update(
-        DeltaUrgency(target_initial_window_size_,
-                     GRPC_CHTTP2_SETTINGS_INITIAL_WINDOW_SIZE),
-        static_cast<uint32_t>(target_initial_window_size_));
-
-    // get bandwidth estimate and update max_frame accordingly.
-    double bw_dbl = bdp_estimator_.EstimateBandwidth();
-    // we target the max of BDP or bandwidth in microseconds.
-    int32_t frame_size = static_cast<int32_t> GPR_CLAMP(
-        GPR_MAX((int32_t)GPR_CLAMP(bw_dbl, 0, INT_MAX) / 1000,
-                target_initial_window_size_),
-        16384, 16777215);
-    action.set_send_max_frame_size_update(
-        DeltaUrgency(static_cast<int64_t>(frame_size),
-                     GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE),
-        frame_size);
+    action = UpdateTargets(target, bw_dbl);
   }
   return UpdateAction(action);
 }
@@ -51,6 +51,15 @@ static constexpr uint32_t kFrameSize = 1024 * 1024;
 class TransportFlowControl;
 class StreamFlowControl;
 
+// How TransportFlowControl sizes the windows it announces.
+enum class AutotuneMode : uint8_t {
+  // Follow BdpEstimator's ping samples, smoothed by a PidController.
+  kBdpPid,
+  // Follow the bandwidth and minimum round trip time measured continuously
+  // by a DeliveryRateEstimator.
+  kDeliveryRate,
+};
+
 // Encapsulates a collections of actions the transport needs to take with
 // regard to flow control. Each action comes with urgencies that tell the
 // transport how quickly the action must take place.
@@ -220,7 +229,8 @@ class TransportFlowControlDisabled final : public TransportFlowControlBase {
 // to be as performant as possible.
 class TransportFlowControl final : public TransportFlowControlBase {
  public:
-  TransportFlowControl(const grpc_chttp2_transport* t, bool enable_bdp_probe);
+  TransportFlowControl(const grpc_chttp2_transport* t, bool enable_bdp_probe,
+                       AutotuneMode autotune_mode = AutotuneMode::kBdpPid);
   ~TransportFlowControl() override {}
 
   bool flow_control_enabled() const override { return true; }
@@ -236,6 +246,10 @@ class TransportFlowControl final : public TransportFlowControlBase {
   // Reads the flow control data and returns and actionable struct that will
   // tell chttp2 exactly what it needs to do
   FlowControlAction MakeAction() override {
+    if (delivery_rate_sampled_) {
+      delivery_rate_sampled_ = false;
+      return UpdateAction(UpdateDeliveryRateTargets());
+    }
     return UpdateAction(FlowControlAction());
   }
 
@@ -249,6 +263,11 @@ class TransportFlowControl final : public TransportFlowControlBase {
   grpc_error* ValidateRecvData(int64_t incoming_frame_size);
   void CommitRecvData(int64_t incoming_frame_size) {
     announced_window_ -= incoming_frame_size;
+    if (enable_bdp_probe_ && autotune_mode_ == AutotuneMode::kDeliveryRate &&
+        delivery_rate_estimator_.AddIncomingBytes(
+            incoming_frame_size, gpr_now(GPR_CLOCK_MONOTONIC))) {
+      delivery_rate_sampled_ = true;
+    }
   }
 
   grpc_error* RecvData(int64_t incoming_frame_size) override {
@@ -298,6 +317,9 @@ class TransportFlowControl final : public TransportFlowControlBase {
  private:
   double TargetLogBdp();
   double SmoothLogBdp(double value);
+  double TargetDeliveryRateWindow();
+  FlowControlAction UpdateDeliveryRateTargets();
+  FlowControlAction UpdateTargets(double target, double bw_dbl);
   FlowControlAction::Urgency DeltaUrgency(int64_t value,
                                           grpc_chttp2_setting_id setting_id);
 
@@ -330,6 +352,12 @@ class TransportFlowControl final : public TransportFlowControlBase {
   /* pid controller */
   grpc_core::PidController pid_controller_;
   grpc_millis last_pid_update_ = 0;
+
+  const AutotuneMode autotune_mode_;
+  /* delivery rate estimation, for AutotuneMode::kDeliveryRate */
+  grpc_core::DeliveryRateEstimator delivery_rate_estimator_;
+  /* has a delivery rate sample been taken since the targets were updated? */
+  bool delivery_rate_sampled_ = false;
 };
 
 // Fat interface with all methods a stream flow control implementation needs
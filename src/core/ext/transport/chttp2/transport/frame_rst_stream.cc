@@ -105,7 +105,13 @@ grpc_error* grpc_chttp2_rst_stream_parser_parse(void* parser,
                       ((static_cast<uint32_t>(p->reason_bytes[2])) << 8) |
                       ((static_cast<uint32_t>(p->reason_bytes[3])));
     grpc_error* error = GRPC_ERROR_NONE;
-    if (reason != GRPC_HTTP2_NO_ERROR || s->metadata_buffer[1].size == 0) {
+    if (reason < GRPC_ERROR_INLINE_UNSET_HTTP2 &&
+        (reason != GRPC_HTTP2_NO_ERROR || s->metadata_buffer[1].size == 0)) {
+      // Every code defined by RFC 7540 fits inline, along with its message.
+      error = grpc_error_set_int(
+          GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_RST_STREAM),
+          GRPC_ERROR_INT_HTTP2_ERROR, static_cast<intptr_t>(reason));
+    } else if (reason != GRPC_HTTP2_NO_ERROR) {
       error = grpc_error_set_int(
           grpc_error_set_str(
               GRPC_ERROR_CREATE_FROM_STATIC_STRING("RST_STREAM"),
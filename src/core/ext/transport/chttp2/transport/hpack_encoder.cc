@@ -69,6 +69,8 @@ namespace {
 constexpr size_t kMaxDecoderSpaceUsage = 512;
 constexpr size_t kDataFrameHeaderSize = 9;
 constexpr uint8_t kMaxFilterValue = 255;
+/* an indexed field is a varint with a 7 bit prefix: at most 5 bytes */
+constexpr size_t kMaxIndexedFieldSize = 5;
 
 /* if the probability of this item being seen again is < 1/x then don't add
    it to the table */
@@ -278,6 +280,15 @@ struct framer_state {
   size_t max_frame_size;
   bool use_true_binary_metadata;
   bool is_end_of_stream;
+  /* while recording a header block to memoize: the bytes of the fields that
+     were emitted as indexed, how many of them there were, and the popularity
+     filter entries that were bumped along the way */
+  bool memo_recording;
+  uint32_t memo_indexed_fields;
+  size_t memo_length;
+  uint8_t memo_bytes[GRPC_CHTTP2_HPACKC_MEMO_MAX_FIELDS * kMaxIndexedFieldSize];
+  uint32_t memo_num_filter_indices;
+  uint8_t memo_filter_indices[GRPC_CHTTP2_HPACKC_MEMO_MAX_FIELDS];
 };
 /* fills p (which is expected to be kDataFrameHeaderSize bytes long)
  * with a data frame header */
@@ -396,6 +407,7 @@ static void evict_entry(grpc_chttp2_hpack_compressor* c) {
       c->table_size -
       c->table_elem_size[c->tail_remote_index % c->cap_table_elems]);
   c->table_elems--;
+  c->table_generation++;
 }
 
 // Reserve space in table for the new element, evict entries if needed.
@@ -425,6 +437,7 @@ static uint32_t prepare_space_for_new_elem(grpc_chttp2_hpack_compressor* c,
       static_cast<uint16_t>(elem_size);
   c->table_size = static_cast<uint16_t>(c->table_size + elem_size);
   c->table_elems++;
+  c->table_generation++;
 
   return new_index;
 }
@@ -470,6 +483,13 @@ static void emit_indexed(grpc_chttp2_hpack_compressor* /*c*/,
   uint32_t len = GRPC_CHTTP2_VARINT_LENGTH(elem_index, 1);
   GRPC_CHTTP2_WRITE_VARINT(elem_index, 1, 0x80, add_tiny_header_data(st, len),
                            len);
+  if (st->memo_recording) {
+    GPR_DEBUG_ASSERT(st->memo_length + len <= sizeof(st->memo_bytes));
+    GRPC_CHTTP2_WRITE_VARINT(elem_index, 1, 0x80,
+                             &st->memo_bytes[st->memo_length], len);
+    st->memo_length += len;
+    st->memo_indexed_fields++;
+  }
 }
 
 struct wire_value {
@@ -637,18 +657,28 @@ struct EmitIndexedStatus {
   const bool can_add = false;
 };
 
+/* hash of an interned or static elem */
+static uint32_t mdelem_hash(grpc_mdelem elem) {
+  return GRPC_MDELEM_STORAGE(elem) == GRPC_MDELEM_STORAGE_INTERNED
+             ? reinterpret_cast<grpc_core::InternedMetadata*>(
+                   GRPC_MDELEM_DATA(elem))
+                   ->hash()
+             : reinterpret_cast<grpc_core::StaticMetadata*>(
+                   GRPC_MDELEM_DATA(elem))
+                   ->hash();
+}
+
 static EmitIndexedStatus maybe_emit_indexed(grpc_chttp2_hpack_compressor* c,
                                             grpc_mdelem elem,
                                             framer_state* st) {
-  const uint32_t elem_hash =
-      GRPC_MDELEM_STORAGE(elem) == GRPC_MDELEM_STORAGE_INTERNED
-          ? reinterpret_cast<grpc_core::InternedMetadata*>(
-                GRPC_MDELEM_DATA(elem))
-                ->hash()
-          : reinterpret_cast<grpc_core::StaticMetadata*>(GRPC_MDELEM_DATA(elem))
-                ->hash();
+  const uint32_t elem_hash = mdelem_hash(elem);
   /* Update filter to see if we can perhaps add this elem. */
   const uint32_t popularity_hash = UpdateHashtablePopularity(c, elem_hash);
+  if (st->memo_recording &&
+      st->memo_num_filter_indices < GRPC_CHTTP2_HPACKC_MEMO_MAX_FIELDS) {
+    st->memo_filter_indices[st->memo_num_filter_indices++] =
+        static_cast<uint8_t>(popularity_hash);
+  }
   /* is this elem currently in the decoders table? */
   HpackEncoderIndex indices_key;
   if (GetMatchingIndex<MetadataComparator>(c->elem_table.entries, elem,
@@ -744,16 +774,115 @@ static void hpack_enc(grpc_chttp2_hpack_compressor* c, grpc_mdelem elem,
 #define STRLEN_LIT(x) (sizeof(x) - 1)
 #define TIMEOUT_KEY "grpc-timeout"
 
+static void emit_static_or_enc(grpc_chttp2_hpack_compressor* c,
+                               grpc_mdelem md, framer_state* st) {
+  const bool is_static = GRPC_MDELEM_STORAGE(md) == GRPC_MDELEM_STORAGE_STATIC;
+  uintptr_t static_index;
+  if (is_static &&
+      (static_index =
+           reinterpret_cast<grpc_core::StaticMetadata*>(GRPC_MDELEM_DATA(md))
+               ->StaticIndex()) < GRPC_CHTTP2_LAST_STATIC_ENTRY) {
+    emit_indexed(c, static_cast<uint32_t>(static_index + 1), st);
+  } else {
+    hpack_enc(c, md, st);
+  }
+}
+
+/* Encodes key: value where the element only lives for the duration of the
+   call. \a storage backs the element when it does not get interned, which
+   saves allocating one just to hand it to hpack_enc. Takes ownership of
+   \a value. */
+static void transient_enc(grpc_chttp2_hpack_compressor* c,
+                          const grpc_core::StaticMetadataSlice& key,
+                          const grpc_slice& value, framer_state* st) {
+  grpc_mdelem_data storage = {key, value};
+  grpc_mdelem mdelem = grpc_mdelem_create(key, value, &storage);
+  hpack_enc(c, mdelem, st);
+  GRPC_MDELEM_UNREF(mdelem);
+  grpc_slice_unref_internal(value);
+}
+
 static void deadline_enc(grpc_chttp2_hpack_compressor* c, grpc_millis deadline,
                          framer_state* st) {
   char timeout_str[GRPC_HTTP2_TIMEOUT_ENCODE_MIN_BUFSIZE];
-  grpc_mdelem mdelem;
   grpc_http2_encode_timeout(deadline - grpc_core::ExecCtx::Get()->Now(),
                             timeout_str);
-  mdelem = grpc_mdelem_from_slices(
-      GRPC_MDSTR_GRPC_TIMEOUT, grpc_core::UnmanagedMemorySlice(timeout_str));
-  hpack_enc(c, mdelem, st);
-  GRPC_MDELEM_UNREF(mdelem);
+  transient_enc(c, GRPC_MDSTR_GRPC_TIMEOUT,
+                grpc_core::UnmanagedMemorySlice(timeout_str), st);
+}
+
+/* Gathers the fields of a header block that memoization covers, in the
+   order they are encoded: extra headers, then the linked metadata.
+   Returns how many there are, or 0 if the block cannot be memoized because it
+   has too many fields or fields that are never emitted indexed. */
+static size_t collect_memo_fields(grpc_mdelem** extra_headers,
+                                  size_t extra_headers_size,
+                                  const grpc_metadata_batch* metadata,
+                                  grpc_mdelem* fields) {
+  const size_t num_fields = extra_headers_size + metadata->list.count;
+  if (num_fields == 0 || num_fields > GRPC_CHTTP2_HPACKC_MEMO_MAX_FIELDS) {
+    return 0;
+  }
+  size_t n = 0;
+  for (size_t i = 0; i < extra_headers_size; ++i) {
+    fields[n++] = *extra_headers[i];
+  }
+  for (grpc_linked_mdelem* l = metadata->list.head; l; l = l->next) {
+    fields[n++] = l->md;
+  }
+  GPR_DEBUG_ASSERT(n == num_fields);
+  for (size_t i = 0; i < n; ++i) {
+    if (!GRPC_MDELEM_IS_INTERNED(fields[i])) return 0;
+  }
+  return n;
+}
+
+static uint32_t memo_slot(const grpc_metadata_batch* metadata,
+                          const grpc_mdelem* fields) {
+  const grpc_linked_mdelem* path = metadata->idx.named.path;
+  return mdelem_hash(path != nullptr ? path->md : fields[0]) %
+         GRPC_CHTTP2_HPACKC_NUM_MEMOS;
+}
+
+/* emits the memoized header block in slot if it was recorded for exactly
+   these fields and the decoder table has not changed since */
+static bool emit_memoized(grpc_chttp2_hpack_compressor* c,
+                          const grpc_mdelem* fields, size_t num_fields,
+                          uint32_t slot, framer_state* st) {
+  const auto* memo = &c->memos[slot];
+  if (memo->num_fields != num_fields ||
+      memo->table_generation != c->table_generation) {
+    return false;
+  }
+  for (size_t i = 0; i < num_fields; ++i) {
+    if (memo->fields[i].payload != fields[i].payload) return false;
+  }
+  for (uint32_t i = 0; i < memo->num_filter_indices; ++i) {
+    IncrementFilter(memo->filter_indices[i], &c->filter_elems_sum,
+                    c->filter_elems);
+  }
+  GRPC_STATS_INC_COUNTER_BY(GRPC_STATS_COUNTER_HPACK_SEND_INDEXED, num_fields);
+  add_header_data(st, grpc_slice_ref_internal(memo->block));
+  return true;
+}
+
+static void memoize(grpc_chttp2_hpack_compressor* c, const grpc_mdelem* fields,
+                    size_t num_fields, uint32_t slot, const framer_state* st) {
+  auto* memo = &c->memos[slot];
+  for (size_t i = 0; i < memo->num_fields; ++i) {
+    GRPC_MDELEM_UNREF(memo->fields[i]);
+  }
+  grpc_slice_unref_internal(memo->block);
+  for (size_t i = 0; i < num_fields; ++i) {
+    memo->fields[i] = GRPC_MDELEM_REF(fields[i]);
+  }
+  memo->num_fields = static_cast<uint32_t>(num_fields);
+  memo->table_generation = c->table_generation;
+  memo->num_filter_indices = st->memo_num_filter_indices;
+  memcpy(memo->filter_indices, st->memo_filter_indices,
+         st->memo_num_filter_indices);
+  memo->block = grpc_slice_from_copied_buffer(
+      reinterpret_cast<const char*>(st->memo_bytes), st->memo_length);
 }
 
 static uint32_t elems_for_bytes(uint32_t bytes) { return (bytes + 31) / 32; }
@@ -777,6 +906,12 @@ void grpc_chttp2_hpack_compressor_destroy(grpc_chttp2_hpack_compressor* c) {
     }
     GRPC_MDELEM_UNREF(GetEntry<grpc_mdelem>(c->elem_table.entries, i));
   }
+  for (int i = 0; i < GRPC_CHTTP2_HPACKC_NUM_MEMOS; i++) {
+    for (uint32_t j = 0; j < c->memos[i].num_fields; j++) {
+      GRPC_MDELEM_UNREF(c->memos[i].fields[j]);
+    }
+    grpc_slice_unref_internal(c->memos[i].block);
+  }
   gpr_free(c->table_elem_size);
 }
 
@@ -831,6 +966,19 @@ void grpc_chttp2_hpack_compressor_set_max_table_size(
   }
 }
 
+static void encode_fields(grpc_chttp2_hpack_compressor* c,
+                          grpc_mdelem** extra_headers,
+                          size_t extra_headers_size,
+                          grpc_metadata_batch* metadata, framer_state* st) {
+  for (size_t i = 0; i < extra_headers_size; ++i) {
+    emit_static_or_enc(c, *extra_headers[i], st);
+  }
+  grpc_metadata_batch_assert_ok(metadata);
+  for (grpc_linked_mdelem* l = metadata->list.head; l; l = l->next) {
+    emit_static_or_enc(c, l->md, st);
+  }
+}
+
 void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
                                grpc_mdelem** extra_headers,
                                size_t extra_headers_size,
@@ -854,6 +1002,10 @@ void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
   st.max_frame_size = options->max_frame_size;
   st.use_true_binary_metadata = options->use_true_binary_metadata;
   st.is_end_of_stream = options->is_eof;
+  st.memo_recording = false;
+  st.memo_indexed_fields = 0;
+  st.memo_length = 0;
+  st.memo_num_filter_indices = 0;
 
   /* Encode a metadata batch; store the returned values, representing
      a metadata element that needs to be unreffed back into the metadata
@@ -863,32 +1015,27 @@ void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
   if (c->advertise_table_size_change != 0) {
     emit_advertise_table_size_change(c, &st);
   }
-  for (size_t i = 0; i < extra_headers_size; ++i) {
-    grpc_mdelem md = *extra_headers[i];
-    const bool is_static =
-        GRPC_MDELEM_STORAGE(md) == GRPC_MDELEM_STORAGE_STATIC;
-    uintptr_t static_index;
-    if (is_static &&
-        (static_index =
-             reinterpret_cast<grpc_core::StaticMetadata*>(GRPC_MDELEM_DATA(md))
-                 ->StaticIndex()) < GRPC_CHTTP2_LAST_STATIC_ENTRY) {
-      emit_indexed(c, static_cast<uint32_t>(static_index + 1), &st);
-    } else {
-      hpack_enc(c, md, &st);
-    }
-  }
-  grpc_metadata_batch_assert_ok(metadata);
-  for (grpc_linked_mdelem* l = metadata->list.head; l; l = l->next) {
-    const bool is_static =
-        GRPC_MDELEM_STORAGE(l->md) == GRPC_MDELEM_STORAGE_STATIC;
-    uintptr_t static_index;
-    if (is_static &&
-        (static_index = reinterpret_cast<grpc_core::StaticMetadata*>(
-                            GRPC_MDELEM_DATA(l->md))
-                            ->StaticIndex()) < GRPC_CHTTP2_LAST_STATIC_ENTRY) {
-      emit_indexed(c, static_cast<uint32_t>(static_index + 1), &st);
-    } else {
-      hpack_enc(c, l->md, &st);
+  /* Calls on a connection tend to send the same metadata over and over. Once
+     a batch encodes to nothing but indexed fields, remember the bytes and
+     reuse them for the next batch with the same fields. Tracing logs every
+     field, so it always takes the slow path. */
+  grpc_mdelem memo_fields[GRPC_CHTTP2_HPACKC_MEMO_MAX_FIELDS];
+  const size_t num_memo_fields =
+      GRPC_TRACE_FLAG_ENABLED(grpc_http_trace)
+          ? 0
+          : collect_memo_fields(extra_headers, extra_headers_size, metadata,
+                                memo_fields);
+  if (num_memo_fields == 0) {
+    encode_fields(c, extra_headers, extra_headers_size, metadata, &st);
+  } else {
+    const uint32_t slot = memo_slot(metadata, memo_fields);
+    if (!emit_memoized(c, memo_fields, num_memo_fields, slot, &st)) {
+      st.memo_recording = true;
+      encode_fields(c, extra_headers, extra_headers_size, metadata, &st);
+      st.memo_recording = false;
+      if (st.memo_indexed_fields == num_memo_fields) {
+        memoize(c, memo_fields, num_memo_fields, slot, &st);
+      }
     }
   }
   grpc_millis deadline = metadata->deadline;
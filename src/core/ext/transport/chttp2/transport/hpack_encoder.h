@@ -35,6 +35,10 @@
 #define GRPC_CHTTP2_HPACKC_INITIAL_TABLE_SIZE 4096
 /* maximum table size we'll actually use */
 #define GRPC_CHTTP2_HPACKC_MAX_TABLE_SIZE (1024 * 1024)
+/* number of memoized header blocks kept per compressor */
+#define GRPC_CHTTP2_HPACKC_NUM_MEMOS 4
+/* most fields a header block can have and still be memoized */
+#define GRPC_CHTTP2_HPACKC_MEMO_MAX_FIELDS 16
 
 extern grpc_core::TraceFlag grpc_http_trace;
 
@@ -81,6 +85,26 @@ struct grpc_chttp2_hpack_compressor {
       uint32_t index;
     } entries[GRPC_CHTTP2_HPACKC_NUM_VALUES];
   } key_table; /* Key table management */
+
+  /* bumped whenever an entry is added to or evicted from the decoder table,
+     which is what can invalidate a dynamic table index we emitted before */
+  uint32_t table_generation;
+  /* header blocks whose fields were all emitted as indexed references, keyed
+     by :path (or the first field when there is none). While table_generation
+     is unchanged, a batch with the same fields encodes to the same bytes, so
+     they are re-emitted without looking any field up. */
+  struct {
+    uint32_t table_generation;
+    uint32_t num_fields;
+    /* static or interned, so comparing payloads compares contents; a ref is
+       held on each */
+    grpc_mdelem fields[GRPC_CHTTP2_HPACKC_MEMO_MAX_FIELDS];
+    /* filter_elems entries that encoding the fields bumped, so that a memoized
+       block keeps the popularity counts the same as a full encode would */
+    uint32_t num_filter_indices;
+    uint8_t filter_indices[GRPC_CHTTP2_HPACKC_MEMO_MAX_FIELDS];
+    grpc_slice block;
+  } memos[GRPC_CHTTP2_HPACKC_NUM_MEMOS];
 };
 
 void grpc_chttp2_hpack_compressor_init(grpc_chttp2_hpack_compressor* c);
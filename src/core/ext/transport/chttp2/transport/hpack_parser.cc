@@ -35,6 +35,7 @@
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/profiling/timers.h"
+#include "src/core/lib/slice/b64.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/surface/validate_metadata.h"
@@ -606,6 +607,642 @@ static const int16_t emit_sub_tbl[249 * 16] = {
     13,  22,  22,  22,  22,  256, 256, 256, 256,
 };
 
+/* multi-symbol decoding table, indexed by the next HUFF_FAST_BITS bits of a
+   huffman encoded string. Each entry holds up to two symbols whose codes
+   both fit in those bits: bits 0-7 the first symbol, 8-15 the second, 16-19
+   the length of the first code, 20-23 the length of both codes, and 24-25 the
+   number of symbols - 0 if the next code is longer than HUFF_FAST_BITS.
+
+   generated by gen_hpack_tables.cc */
+#define HUFF_FAST_BITS 12
+static const uint32_t huff_fast_tbl[4096] = {
+    0x2a53030, 0x2a53030, 0x2a53030, 0x2a53030, 0x2a53130, 0x2a53130, 0x2a53130,
+    0x2a53130, 0x2a53230, 0x2a53230, 0x2a53230, 0x2a53230, 0x2a56130, 0x2a56130,
+    0x2a56130, 0x2a56130, 0x2a56330, 0x2a56330, 0x2a56330, 0x2a56330, 0x2a56530,
+    0x2a56530, 0x2a56530, 0x2a56530, 0x2a56930, 0x2a56930, 0x2a56930, 0x2a56930,
+    0x2a56f30, 0x2a56f30, 0x2a56f30, 0x2a56f30, 0x2a57330, 0x2a57330, 0x2a57330,
+    0x2a57330, 0x2a57430, 0x2a57430, 0x2a57430, 0x2a57430, 0x2b52030, 0x2b52030,
+    0x2b52530, 0x2b52530, 0x2b52d30, 0x2b52d30, 0x2b52e30, 0x2b52e30, 0x2b52f30,
+    0x2b52f30, 0x2b53330, 0x2b53330, 0x2b53430, 0x2b53430, 0x2b53530, 0x2b53530,
+    0x2b53630, 0x2b53630, 0x2b53730, 0x2b53730, 0x2b53830, 0x2b53830, 0x2b53930,
+    0x2b53930, 0x2b53d30, 0x2b53d30, 0x2b54130, 0x2b54130, 0x2b55f30, 0x2b55f30,
+    0x2b56230, 0x2b56230, 0x2b56430, 0x2b56430, 0x2b56630, 0x2b56630, 0x2b56730,
+    0x2b56730, 0x2b56830, 0x2b56830, 0x2b56c30, 0x2b56c30, 0x2b56d30, 0x2b56d30,
+    0x2b56e30, 0x2b56e30, 0x2b57030, 0x2b57030, 0x2b57230, 0x2b57230, 0x2b57530,
+    0x2b57530, 0x2c53a30, 0x2c54230, 0x2c54330, 0x2c54430, 0x2c54530, 0x2c54630,
+    0x2c54730, 0x2c54830, 0x2c54930, 0x2c54a30, 0x2c54b30, 0x2c54c30, 0x2c54d30,
+    0x2c54e30, 0x2c54f30, 0x2c55030, 0x2c55130, 0x2c55230, 0x2c55330, 0x2c55430,
+    0x2c55530, 0x2c55630, 0x2c55730, 0x2c55930, 0x2c56a30, 0x2c56b30, 0x2c57130,
+    0x2c57630, 0x2c57730, 0x2c57830, 0x2c57930, 0x2c57a30, 0x1550030, 0x1550030,
+    0x1550030, 0x1550030, 0x2a53031, 0x2a53031, 0x2a53031, 0x2a53031, 0x2a53131,
+    0x2a53131, 0x2a53131, 0x2a53131, 0x2a53231, 0x2a53231, 0x2a53231, 0x2a53231,
+    0x2a56131, 0x2a56131, 0x2a56131, 0x2a56131, 0x2a56331, 0x2a56331, 0x2a56331,
+    0x2a56331, 0x2a56531, 0x2a56531, 0x2a56531, 0x2a56531, 0x2a56931, 0x2a56931,
+    0x2a56931, 0x2a56931, 0x2a56f31, 0x2a56f31, 0x2a56f31, 0x2a56f31, 0x2a57331,
+    0x2a57331, 0x2a57331, 0x2a57331, 0x2a57431, 0x2a57431, 0x2a57431, 0x2a57431,
+    0x2b52031, 0x2b52031, 0x2b52531, 0x2b52531, 0x2b52d31, 0x2b52d31, 0x2b52e31,
+    0x2b52e31, 0x2b52f31, 0x2b52f31, 0x2b53331, 0x2b53331, 0x2b53431, 0x2b53431,
+    0x2b53531, 0x2b53531, 0x2b53631, 0x2b53631, 0x2b53731, 0x2b53731, 0x2b53831,
+    0x2b53831, 0x2b53931, 0x2b53931, 0x2b53d31, 0x2b53d31, 0x2b54131, 0x2b54131,
+    0x2b55f31, 0x2b55f31, 0x2b56231, 0x2b56231, 0x2b56431, 0x2b56431, 0x2b56631,
+    0x2b56631, 0x2b56731, 0x2b56731, 0x2b56831, 0x2b56831, 0x2b56c31, 0x2b56c31,
+    0x2b56d31, 0x2b56d31, 0x2b56e31, 0x2b56e31, 0x2b57031, 0x2b57031, 0x2b57231,
+    0x2b57231, 0x2b57531, 0x2b57531, 0x2c53a31, 0x2c54231, 0x2c54331, 0x2c54431,
+    0x2c54531, 0x2c54631, 0x2c54731, 0x2c54831, 0x2c54931, 0x2c54a31, 0x2c54b31,
+    0x2c54c31, 0x2c54d31, 0x2c54e31, 0x2c54f31, 0x2c55031, 0x2c55131, 0x2c55231,
+    0x2c55331, 0x2c55431, 0x2c55531, 0x2c55631, 0x2c55731, 0x2c55931, 0x2c56a31,
+    0x2c56b31, 0x2c57131, 0x2c57631, 0x2c57731, 0x2c57831, 0x2c57931, 0x2c57a31,
+    0x1550031, 0x1550031, 0x1550031, 0x1550031, 0x2a53032, 0x2a53032, 0x2a53032,
+    0x2a53032, 0x2a53132, 0x2a53132, 0x2a53132, 0x2a53132, 0x2a53232, 0x2a53232,
+    0x2a53232, 0x2a53232, 0x2a56132, 0x2a56132, 0x2a56132, 0x2a56132, 0x2a56332,
+    0x2a56332, 0x2a56332, 0x2a56332, 0x2a56532, 0x2a56532, 0x2a56532, 0x2a56532,
+    0x2a56932, 0x2a56932, 0x2a56932, 0x2a56932, 0x2a56f32, 0x2a56f32, 0x2a56f32,
+    0x2a56f32, 0x2a57332, 0x2a57332, 0x2a57332, 0x2a57332, 0x2a57432, 0x2a57432,
+    0x2a57432, 0x2a57432, 0x2b52032, 0x2b52032, 0x2b52532, 0x2b52532, 0x2b52d32,
+    0x2b52d32, 0x2b52e32, 0x2b52e32, 0x2b52f32, 0x2b52f32, 0x2b53332, 0x2b53332,
+    0x2b53432, 0x2b53432, 0x2b53532, 0x2b53532, 0x2b53632, 0x2b53632, 0x2b53732,
+    0x2b53732, 0x2b53832, 0x2b53832, 0x2b53932, 0x2b53932, 0x2b53d32, 0x2b53d32,
+    0x2b54132, 0x2b54132, 0x2b55f32, 0x2b55f32, 0x2b56232, 0x2b56232, 0x2b56432,
+    0x2b56432, 0x2b56632, 0x2b56632, 0x2b56732, 0x2b56732, 0x2b56832, 0x2b56832,
+    0x2b56c32, 0x2b56c32, 0x2b56d32, 0x2b56d32, 0x2b56e32, 0x2b56e32, 0x2b57032,
+    0x2b57032, 0x2b57232, 0x2b57232, 0x2b57532, 0x2b57532, 0x2c53a32, 0x2c54232,
+    0x2c54332, 0x2c54432, 0x2c54532, 0x2c54632, 0x2c54732, 0x2c54832, 0x2c54932,
+    0x2c54a32, 0x2c54b32, 0x2c54c32, 0x2c54d32, 0x2c54e32, 0x2c54f32, 0x2c55032,
+    0x2c55132, 0x2c55232, 0x2c55332, 0x2c55432, 0x2c55532, 0x2c55632, 0x2c55732,
+    0x2c55932, 0x2c56a32, 0x2c56b32, 0x2c57132, 0x2c57632, 0x2c57732, 0x2c57832,
+    0x2c57932, 0x2c57a32, 0x1550032, 0x1550032, 0x1550032, 0x1550032, 0x2a53061,
+    0x2a53061, 0x2a53061, 0x2a53061, 0x2a53161, 0x2a53161, 0x2a53161, 0x2a53161,
+    0x2a53261, 0x2a53261, 0x2a53261, 0x2a53261, 0x2a56161, 0x2a56161, 0x2a56161,
+    0x2a56161, 0x2a56361, 0x2a56361, 0x2a56361, 0x2a56361, 0x2a56561, 0x2a56561,
+    0x2a56561, 0x2a56561, 0x2a56961, 0x2a56961, 0x2a56961, 0x2a56961, 0x2a56f61,
+    0x2a56f61, 0x2a56f61, 0x2a56f61, 0x2a57361, 0x2a57361, 0x2a57361, 0x2a57361,
+    0x2a57461, 0x2a57461, 0x2a57461, 0x2a57461, 0x2b52061, 0x2b52061, 0x2b52561,
+    0x2b52561, 0x2b52d61, 0x2b52d61, 0x2b52e61, 0x2b52e61, 0x2b52f61, 0x2b52f61,
+    0x2b53361, 0x2b53361, 0x2b53461, 0x2b53461, 0x2b53561, 0x2b53561, 0x2b53661,
+    0x2b53661, 0x2b53761, 0x2b53761, 0x2b53861, 0x2b53861, 0x2b53961, 0x2b53961,
+    0x2b53d61, 0x2b53d61, 0x2b54161, 0x2b54161, 0x2b55f61, 0x2b55f61, 0x2b56261,
+    0x2b56261, 0x2b56461, 0x2b56461, 0x2b56661, 0x2b56661, 0x2b56761, 0x2b56761,
+    0x2b56861, 0x2b56861, 0x2b56c61, 0x2b56c61, 0x2b56d61, 0x2b56d61, 0x2b56e61,
+    0x2b56e61, 0x2b57061, 0x2b57061, 0x2b57261, 0x2b57261, 0x2b57561, 0x2b57561,
+    0x2c53a61, 0x2c54261, 0x2c54361, 0x2c54461, 0x2c54561, 0x2c54661, 0x2c54761,
+    0x2c54861, 0x2c54961, 0x2c54a61, 0x2c54b61, 0x2c54c61, 0x2c54d61, 0x2c54e61,
+    0x2c54f61, 0x2c55061, 0x2c55161, 0x2c55261, 0x2c55361, 0x2c55461, 0x2c55561,
+    0x2c55661, 0x2c55761, 0x2c55961, 0x2c56a61, 0x2c56b61, 0x2c57161, 0x2c57661,
+    0x2c57761, 0x2c57861, 0x2c57961, 0x2c57a61, 0x1550061, 0x1550061, 0x1550061,
+    0x1550061, 0x2a53063, 0x2a53063, 0x2a53063, 0x2a53063, 0x2a53163, 0x2a53163,
+    0x2a53163, 0x2a53163, 0x2a53263, 0x2a53263, 0x2a53263, 0x2a53263, 0x2a56163,
+    0x2a56163, 0x2a56163, 0x2a56163, 0x2a56363, 0x2a56363, 0x2a56363, 0x2a56363,
+    0x2a56563, 0x2a56563, 0x2a56563, 0x2a56563, 0x2a56963, 0x2a56963, 0x2a56963,
+    0x2a56963, 0x2a56f63, 0x2a56f63, 0x2a56f63, 0x2a56f63, 0x2a57363, 0x2a57363,
+    0x2a57363, 0x2a57363, 0x2a57463, 0x2a57463, 0x2a57463, 0x2a57463, 0x2b52063,
+    0x2b52063, 0x2b52563, 0x2b52563, 0x2b52d63, 0x2b52d63, 0x2b52e63, 0x2b52e63,
+    0x2b52f63, 0x2b52f63, 0x2b53363, 0x2b53363, 0x2b53463, 0x2b53463, 0x2b53563,
+    0x2b53563, 0x2b53663, 0x2b53663, 0x2b53763, 0x2b53763, 0x2b53863, 0x2b53863,
+    0x2b53963, 0x2b53963, 0x2b53d63, 0x2b53d63, 0x2b54163, 0x2b54163, 0x2b55f63,
+    0x2b55f63, 0x2b56263, 0x2b56263, 0x2b56463, 0x2b56463, 0x2b56663, 0x2b56663,
+    0x2b56763, 0x2b56763, 0x2b56863, 0x2b56863, 0x2b56c63, 0x2b56c63, 0x2b56d63,
+    0x2b56d63, 0x2b56e63, 0x2b56e63, 0x2b57063, 0x2b57063, 0x2b57263, 0x2b57263,
+    0x2b57563, 0x2b57563, 0x2c53a63, 0x2c54263, 0x2c54363, 0x2c54463, 0x2c54563,
+    0x2c54663, 0x2c54763, 0x2c54863, 0x2c54963, 0x2c54a63, 0x2c54b63, 0x2c54c63,
+    0x2c54d63, 0x2c54e63, 0x2c54f63, 0x2c55063, 0x2c55163, 0x2c55263, 0x2c55363,
+    0x2c55463, 0x2c55563, 0x2c55663, 0x2c55763, 0x2c55963, 0x2c56a63, 0x2c56b63,
+    0x2c57163, 0x2c57663, 0x2c57763, 0x2c57863, 0x2c57963, 0x2c57a63, 0x1550063,
+    0x1550063, 0x1550063, 0x1550063, 0x2a53065, 0x2a53065, 0x2a53065, 0x2a53065,
+    0x2a53165, 0x2a53165, 0x2a53165, 0x2a53165, 0x2a53265, 0x2a53265, 0x2a53265,
+    0x2a53265, 0x2a56165, 0x2a56165, 0x2a56165, 0x2a56165, 0x2a56365, 0x2a56365,
+    0x2a56365, 0x2a56365, 0x2a56565, 0x2a56565, 0x2a56565, 0x2a56565, 0x2a56965,
+    0x2a56965, 0x2a56965, 0x2a56965, 0x2a56f65, 0x2a56f65, 0x2a56f65, 0x2a56f65,
+    0x2a57365, 0x2a57365, 0x2a57365, 0x2a57365, 0x2a57465, 0x2a57465, 0x2a57465,
+    0x2a57465, 0x2b52065, 0x2b52065, 0x2b52565, 0x2b52565, 0x2b52d65, 0x2b52d65,
+    0x2b52e65, 0x2b52e65, 0x2b52f65, 0x2b52f65, 0x2b53365, 0x2b53365, 0x2b53465,
+    0x2b53465, 0x2b53565, 0x2b53565, 0x2b53665, 0x2b53665, 0x2b53765, 0x2b53765,
+    0x2b53865, 0x2b53865, 0x2b53965, 0x2b53965, 0x2b53d65, 0x2b53d65, 0x2b54165,
+    0x2b54165, 0x2b55f65, 0x2b55f65, 0x2b56265, 0x2b56265, 0x2b56465, 0x2b56465,
+    0x2b56665, 0x2b56665, 0x2b56765, 0x2b56765, 0x2b56865, 0x2b56865, 0x2b56c65,
+    0x2b56c65, 0x2b56d65, 0x2b56d65, 0x2b56e65, 0x2b56e65, 0x2b57065, 0x2b57065,
+    0x2b57265, 0x2b57265, 0x2b57565, 0x2b57565, 0x2c53a65, 0x2c54265, 0x2c54365,
+    0x2c54465, 0x2c54565, 0x2c54665, 0x2c54765, 0x2c54865, 0x2c54965, 0x2c54a65,
+    0x2c54b65, 0x2c54c65, 0x2c54d65, 0x2c54e65, 0x2c54f65, 0x2c55065, 0x2c55165,
+    0x2c55265, 0x2c55365, 0x2c55465, 0x2c55565, 0x2c55665, 0x2c55765, 0x2c55965,
+    0x2c56a65, 0x2c56b65, 0x2c57165, 0x2c57665, 0x2c57765, 0x2c57865, 0x2c57965,
+    0x2c57a65, 0x1550065, 0x1550065, 0x1550065, 0x1550065, 0x2a53069, 0x2a53069,
+    0x2a53069, 0x2a53069, 0x2a53169, 0x2a53169, 0x2a53169, 0x2a53169, 0x2a53269,
+    0x2a53269, 0x2a53269, 0x2a53269, 0x2a56169, 0x2a56169, 0x2a56169, 0x2a56169,
+    0x2a56369, 0x2a56369, 0x2a56369, 0x2a56369, 0x2a56569, 0x2a56569, 0x2a56569,
+    0x2a56569, 0x2a56969, 0x2a56969, 0x2a56969, 0x2a56969, 0x2a56f69, 0x2a56f69,
+    0x2a56f69, 0x2a56f69, 0x2a57369, 0x2a57369, 0x2a57369, 0x2a57369, 0x2a57469,
+    0x2a57469, 0x2a57469, 0x2a57469, 0x2b52069, 0x2b52069, 0x2b52569, 0x2b52569,
+    0x2b52d69, 0x2b52d69, 0x2b52e69, 0x2b52e69, 0x2b52f69, 0x2b52f69, 0x2b53369,
+    0x2b53369, 0x2b53469, 0x2b53469, 0x2b53569, 0x2b53569, 0x2b53669, 0x2b53669,
+    0x2b53769, 0x2b53769, 0x2b53869, 0x2b53869, 0x2b53969, 0x2b53969, 0x2b53d69,
+    0x2b53d69, 0x2b54169, 0x2b54169, 0x2b55f69, 0x2b55f69, 0x2b56269, 0x2b56269,
+    0x2b56469, 0x2b56469, 0x2b56669, 0x2b56669, 0x2b56769, 0x2b56769, 0x2b56869,
+    0x2b56869, 0x2b56c69, 0x2b56c69, 0x2b56d69, 0x2b56d69, 0x2b56e69, 0x2b56e69,
+    0x2b57069, 0x2b57069, 0x2b57269, 0x2b57269, 0x2b57569, 0x2b57569, 0x2c53a69,
+    0x2c54269, 0x2c54369, 0x2c54469, 0x2c54569, 0x2c54669, 0x2c54769, 0x2c54869,
+    0x2c54969, 0x2c54a69, 0x2c54b69, 0x2c54c69, 0x2c54d69, 0x2c54e69, 0x2c54f69,
+    0x2c55069, 0x2c55169, 0x2c55269, 0x2c55369, 0x2c55469, 0x2c55569, 0x2c55669,
+    0x2c55769, 0x2c55969, 0x2c56a69, 0x2c56b69, 0x2c57169, 0x2c57669, 0x2c57769,
+    0x2c57869, 0x2c57969, 0x2c57a69, 0x1550069, 0x1550069, 0x1550069, 0x1550069,
+    0x2a5306f, 0x2a5306f, 0x2a5306f, 0x2a5306f, 0x2a5316f, 0x2a5316f, 0x2a5316f,
+    0x2a5316f, 0x2a5326f, 0x2a5326f, 0x2a5326f, 0x2a5326f, 0x2a5616f, 0x2a5616f,
+    0x2a5616f, 0x2a5616f, 0x2a5636f, 0x2a5636f, 0x2a5636f, 0x2a5636f, 0x2a5656f,
+    0x2a5656f, 0x2a5656f, 0x2a5656f, 0x2a5696f, 0x2a5696f, 0x2a5696f, 0x2a5696f,
+    0x2a56f6f, 0x2a56f6f, 0x2a56f6f, 0x2a56f6f, 0x2a5736f, 0x2a5736f, 0x2a5736f,
+    0x2a5736f, 0x2a5746f, 0x2a5746f, 0x2a5746f, 0x2a5746f, 0x2b5206f, 0x2b5206f,
+    0x2b5256f, 0x2b5256f, 0x2b52d6f, 0x2b52d6f, 0x2b52e6f, 0x2b52e6f, 0x2b52f6f,
+    0x2b52f6f, 0x2b5336f, 0x2b5336f, 0x2b5346f, 0x2b5346f, 0x2b5356f, 0x2b5356f,
+    0x2b5366f, 0x2b5366f, 0x2b5376f, 0x2b5376f, 0x2b5386f, 0x2b5386f, 0x2b5396f,
+    0x2b5396f, 0x2b53d6f, 0x2b53d6f, 0x2b5416f, 0x2b5416f, 0x2b55f6f, 0x2b55f6f,
+    0x2b5626f, 0x2b5626f, 0x2b5646f, 0x2b5646f, 0x2b5666f, 0x2b5666f, 0x2b5676f,
+    0x2b5676f, 0x2b5686f, 0x2b5686f, 0x2b56c6f, 0x2b56c6f, 0x2b56d6f, 0x2b56d6f,
+    0x2b56e6f, 0x2b56e6f, 0x2b5706f, 0x2b5706f, 0x2b5726f, 0x2b5726f, 0x2b5756f,
+    0x2b5756f, 0x2c53a6f, 0x2c5426f, 0x2c5436f, 0x2c5446f, 0x2c5456f, 0x2c5466f,
+    0x2c5476f, 0x2c5486f, 0x2c5496f, 0x2c54a6f, 0x2c54b6f, 0x2c54c6f, 0x2c54d6f,
+    0x2c54e6f, 0x2c54f6f, 0x2c5506f, 0x2c5516f, 0x2c5526f, 0x2c5536f, 0x2c5546f,
+    0x2c5556f, 0x2c5566f, 0x2c5576f, 0x2c5596f, 0x2c56a6f, 0x2c56b6f, 0x2c5716f,
+    0x2c5766f, 0x2c5776f, 0x2c5786f, 0x2c5796f, 0x2c57a6f, 0x155006f, 0x155006f,
+    0x155006f, 0x155006f, 0x2a53073, 0x2a53073, 0x2a53073, 0x2a53073, 0x2a53173,
+    0x2a53173, 0x2a53173, 0x2a53173, 0x2a53273, 0x2a53273, 0x2a53273, 0x2a53273,
+    0x2a56173, 0x2a56173, 0x2a56173, 0x2a56173, 0x2a56373, 0x2a56373, 0x2a56373,
+    0x2a56373, 0x2a56573, 0x2a56573, 0x2a56573, 0x2a56573, 0x2a56973, 0x2a56973,
+    0x2a56973, 0x2a56973, 0x2a56f73, 0x2a56f73, 0x2a56f73, 0x2a56f73, 0x2a57373,
+    0x2a57373, 0x2a57373, 0x2a57373, 0x2a57473, 0x2a57473, 0x2a57473, 0x2a57473,
+    0x2b52073, 0x2b52073, 0x2b52573, 0x2b52573, 0x2b52d73, 0x2b52d73, 0x2b52e73,
+    0x2b52e73, 0x2b52f73, 0x2b52f73, 0x2b53373, 0x2b53373, 0x2b53473, 0x2b53473,
+    0x2b53573, 0x2b53573, 0x2b53673, 0x2b53673, 0x2b53773, 0x2b53773, 0x2b53873,
+    0x2b53873, 0x2b53973, 0x2b53973, 0x2b53d73, 0x2b53d73, 0x2b54173, 0x2b54173,
+    0x2b55f73, 0x2b55f73, 0x2b56273, 0x2b56273, 0x2b56473, 0x2b56473, 0x2b56673,
+    0x2b56673, 0x2b56773, 0x2b56773, 0x2b56873, 0x2b56873, 0x2b56c73, 0x2b56c73,
+    0x2b56d73, 0x2b56d73, 0x2b56e73, 0x2b56e73, 0x2b57073, 0x2b57073, 0x2b57273,
+    0x2b57273, 0x2b57573, 0x2b57573, 0x2c53a73, 0x2c54273, 0x2c54373, 0x2c54473,
+    0x2c54573, 0x2c54673, 0x2c54773, 0x2c54873, 0x2c54973, 0x2c54a73, 0x2c54b73,
+    0x2c54c73, 0x2c54d73, 0x2c54e73, 0x2c54f73, 0x2c55073, 0x2c55173, 0x2c55273,
+    0x2c55373, 0x2c55473, 0x2c55573, 0x2c55673, 0x2c55773, 0x2c55973, 0x2c56a73,
+    0x2c56b73, 0x2c57173, 0x2c57673, 0x2c57773, 0x2c57873, 0x2c57973, 0x2c57a73,
+    0x1550073, 0x1550073, 0x1550073, 0x1550073, 0x2a53074, 0x2a53074, 0x2a53074,
+    0x2a53074, 0x2a53174, 0x2a53174, 0x2a53174, 0x2a53174, 0x2a53274, 0x2a53274,
+    0x2a53274, 0x2a53274, 0x2a56174, 0x2a56174, 0x2a56174, 0x2a56174, 0x2a56374,
+    0x2a56374, 0x2a56374, 0x2a56374, 0x2a56574, 0x2a56574, 0x2a56574, 0x2a56574,
+    0x2a56974, 0x2a56974, 0x2a56974, 0x2a56974, 0x2a56f74, 0x2a56f74, 0x2a56f74,
+    0x2a56f74, 0x2a57374, 0x2a57374, 0x2a57374, 0x2a57374, 0x2a57474, 0x2a57474,
+    0x2a57474, 0x2a57474, 0x2b52074, 0x2b52074, 0x2b52574, 0x2b52574, 0x2b52d74,
+    0x2b52d74, 0x2b52e74, 0x2b52e74, 0x2b52f74, 0x2b52f74, 0x2b53374, 0x2b53374,
+    0x2b53474, 0x2b53474, 0x2b53574, 0x2b53574, 0x2b53674, 0x2b53674, 0x2b53774,
+    0x2b53774, 0x2b53874, 0x2b53874, 0x2b53974, 0x2b53974, 0x2b53d74, 0x2b53d74,
+    0x2b54174, 0x2b54174, 0x2b55f74, 0x2b55f74, 0x2b56274, 0x2b56274, 0x2b56474,
+    0x2b56474, 0x2b56674, 0x2b56674, 0x2b56774, 0x2b56774, 0x2b56874, 0x2b56874,
+    0x2b56c74, 0x2b56c74, 0x2b56d74, 0x2b56d74, 0x2b56e74, 0x2b56e74, 0x2b57074,
+    0x2b57074, 0x2b57274, 0x2b57274, 0x2b57574, 0x2b57574, 0x2c53a74, 0x2c54274,
+    0x2c54374, 0x2c54474, 0x2c54574, 0x2c54674, 0x2c54774, 0x2c54874, 0x2c54974,
+    0x2c54a74, 0x2c54b74, 0x2c54c74, 0x2c54d74, 0x2c54e74, 0x2c54f74, 0x2c55074,
+    0x2c55174, 0x2c55274, 0x2c55374, 0x2c55474, 0x2c55574, 0x2c55674, 0x2c55774,
+    0x2c55974, 0x2c56a74, 0x2c56b74, 0x2c57174, 0x2c57674, 0x2c57774, 0x2c57874,
+    0x2c57974, 0x2c57a74, 0x1550074, 0x1550074, 0x1550074, 0x1550074, 0x2b63020,
+    0x2b63020, 0x2b63120, 0x2b63120, 0x2b63220, 0x2b63220, 0x2b66120, 0x2b66120,
+    0x2b66320, 0x2b66320, 0x2b66520, 0x2b66520, 0x2b66920, 0x2b66920, 0x2b66f20,
+    0x2b66f20, 0x2b67320, 0x2b67320, 0x2b67420, 0x2b67420, 0x2c62020, 0x2c62520,
+    0x2c62d20, 0x2c62e20, 0x2c62f20, 0x2c63320, 0x2c63420, 0x2c63520, 0x2c63620,
+    0x2c63720, 0x2c63820, 0x2c63920, 0x2c63d20, 0x2c64120, 0x2c65f20, 0x2c66220,
+    0x2c66420, 0x2c66620, 0x2c66720, 0x2c66820, 0x2c66c20, 0x2c66d20, 0x2c66e20,
+    0x2c67020, 0x2c67220, 0x2c67520, 0x1660020, 0x1660020, 0x1660020, 0x1660020,
+    0x1660020, 0x1660020, 0x1660020, 0x1660020, 0x1660020, 0x1660020, 0x1660020,
+    0x1660020, 0x1660020, 0x1660020, 0x1660020, 0x1660020, 0x1660020, 0x1660020,
+    0x2b63025, 0x2b63025, 0x2b63125, 0x2b63125, 0x2b63225, 0x2b63225, 0x2b66125,
+    0x2b66125, 0x2b66325, 0x2b66325, 0x2b66525, 0x2b66525, 0x2b66925, 0x2b66925,
+    0x2b66f25, 0x2b66f25, 0x2b67325, 0x2b67325, 0x2b67425, 0x2b67425, 0x2c62025,
+    0x2c62525, 0x2c62d25, 0x2c62e25, 0x2c62f25, 0x2c63325, 0x2c63425, 0x2c63525,
+    0x2c63625, 0x2c63725, 0x2c63825, 0x2c63925, 0x2c63d25, 0x2c64125, 0x2c65f25,
+    0x2c66225, 0x2c66425, 0x2c66625, 0x2c66725, 0x2c66825, 0x2c66c25, 0x2c66d25,
+    0x2c66e25, 0x2c67025, 0x2c67225, 0x2c67525, 0x1660025, 0x1660025, 0x1660025,
+    0x1660025, 0x1660025, 0x1660025, 0x1660025, 0x1660025, 0x1660025, 0x1660025,
+    0x1660025, 0x1660025, 0x1660025, 0x1660025, 0x1660025, 0x1660025, 0x1660025,
+    0x1660025, 0x2b6302d, 0x2b6302d, 0x2b6312d, 0x2b6312d, 0x2b6322d, 0x2b6322d,
+    0x2b6612d, 0x2b6612d, 0x2b6632d, 0x2b6632d, 0x2b6652d, 0x2b6652d, 0x2b6692d,
+    0x2b6692d, 0x2b66f2d, 0x2b66f2d, 0x2b6732d, 0x2b6732d, 0x2b6742d, 0x2b6742d,
+    0x2c6202d, 0x2c6252d, 0x2c62d2d, 0x2c62e2d, 0x2c62f2d, 0x2c6332d, 0x2c6342d,
+    0x2c6352d, 0x2c6362d, 0x2c6372d, 0x2c6382d, 0x2c6392d, 0x2c63d2d, 0x2c6412d,
+    0x2c65f2d, 0x2c6622d, 0x2c6642d, 0x2c6662d, 0x2c6672d, 0x2c6682d, 0x2c66c2d,
+    0x2c66d2d, 0x2c66e2d, 0x2c6702d, 0x2c6722d, 0x2c6752d, 0x166002d, 0x166002d,
+    0x166002d, 0x166002d, 0x166002d, 0x166002d, 0x166002d, 0x166002d, 0x166002d,
+    0x166002d, 0x166002d, 0x166002d, 0x166002d, 0x166002d, 0x166002d, 0x166002d,
+    0x166002d, 0x166002d, 0x2b6302e, 0x2b6302e, 0x2b6312e, 0x2b6312e, 0x2b6322e,
+    0x2b6322e, 0x2b6612e, 0x2b6612e, 0x2b6632e, 0x2b6632e, 0x2b6652e, 0x2b6652e,
+    0x2b6692e, 0x2b6692e, 0x2b66f2e, 0x2b66f2e, 0x2b6732e, 0x2b6732e, 0x2b6742e,
+    0x2b6742e, 0x2c6202e, 0x2c6252e, 0x2c62d2e, 0x2c62e2e, 0x2c62f2e, 0x2c6332e,
+    0x2c6342e, 0x2c6352e, 0x2c6362e, 0x2c6372e, 0x2c6382e, 0x2c6392e, 0x2c63d2e,
+    0x2c6412e, 0x2c65f2e, 0x2c6622e, 0x2c6642e, 0x2c6662e, 0x2c6672e, 0x2c6682e,
+    0x2c66c2e, 0x2c66d2e, 0x2c66e2e, 0x2c6702e, 0x2c6722e, 0x2c6752e, 0x166002e,
+    0x166002e, 0x166002e, 0x166002e, 0x166002e, 0x166002e, 0x166002e, 0x166002e,
+    0x166002e, 0x166002e, 0x166002e, 0x166002e, 0x166002e, 0x166002e, 0x166002e,
+    0x166002e, 0x166002e, 0x166002e, 0x2b6302f, 0x2b6302f, 0x2b6312f, 0x2b6312f,
+    0x2b6322f, 0x2b6322f, 0x2b6612f, 0x2b6612f, 0x2b6632f, 0x2b6632f, 0x2b6652f,
+    0x2b6652f, 0x2b6692f, 0x2b6692f, 0x2b66f2f, 0x2b66f2f, 0x2b6732f, 0x2b6732f,
+    0x2b6742f, 0x2b6742f, 0x2c6202f, 0x2c6252f, 0x2c62d2f, 0x2c62e2f, 0x2c62f2f,
+    0x2c6332f, 0x2c6342f, 0x2c6352f, 0x2c6362f, 0x2c6372f, 0x2c6382f, 0x2c6392f,
+    0x2c63d2f, 0x2c6412f, 0x2c65f2f, 0x2c6622f, 0x2c6642f, 0x2c6662f, 0x2c6672f,
+    0x2c6682f, 0x2c66c2f, 0x2c66d2f, 0x2c66e2f, 0x2c6702f, 0x2c6722f, 0x2c6752f,
+    0x166002f, 0x166002f, 0x166002f, 0x166002f, 0x166002f, 0x166002f, 0x166002f,
+    0x166002f, 0x166002f, 0x166002f, 0x166002f, 0x166002f, 0x166002f, 0x166002f,
+    0x166002f, 0x166002f, 0x166002f, 0x166002f, 0x2b63033, 0x2b63033, 0x2b63133,
+    0x2b63133, 0x2b63233, 0x2b63233, 0x2b66133, 0x2b66133, 0x2b66333, 0x2b66333,
+    0x2b66533, 0x2b66533, 0x2b66933, 0x2b66933, 0x2b66f33, 0x2b66f33, 0x2b67333,
+    0x2b67333, 0x2b67433, 0x2b67433, 0x2c62033, 0x2c62533, 0x2c62d33, 0x2c62e33,
+    0x2c62f33, 0x2c63333, 0x2c63433, 0x2c63533, 0x2c63633, 0x2c63733, 0x2c63833,
+    0x2c63933, 0x2c63d33, 0x2c64133, 0x2c65f33, 0x2c66233, 0x2c66433, 0x2c66633,
+    0x2c66733, 0x2c66833, 0x2c66c33, 0x2c66d33, 0x2c66e33, 0x2c67033, 0x2c67233,
+    0x2c67533, 0x1660033, 0x1660033, 0x1660033, 0x1660033, 0x1660033, 0x1660033,
+    0x1660033, 0x1660033, 0x1660033, 0x1660033, 0x1660033, 0x1660033, 0x1660033,
+    0x1660033, 0x1660033, 0x1660033, 0x1660033, 0x1660033, 0x2b63034, 0x2b63034,
+    0x2b63134, 0x2b63134, 0x2b63234, 0x2b63234, 0x2b66134, 0x2b66134, 0x2b66334,
+    0x2b66334, 0x2b66534, 0x2b66534, 0x2b66934, 0x2b66934, 0x2b66f34, 0x2b66f34,
+    0x2b67334, 0x2b67334, 0x2b67434, 0x2b67434, 0x2c62034, 0x2c62534, 0x2c62d34,
+    0x2c62e34, 0x2c62f34, 0x2c63334, 0x2c63434, 0x2c63534, 0x2c63634, 0x2c63734,
+    0x2c63834, 0x2c63934, 0x2c63d34, 0x2c64134, 0x2c65f34, 0x2c66234, 0x2c66434,
+    0x2c66634, 0x2c66734, 0x2c66834, 0x2c66c34, 0x2c66d34, 0x2c66e34, 0x2c67034,
+    0x2c67234, 0x2c67534, 0x1660034, 0x1660034, 0x1660034, 0x1660034, 0x1660034,
+    0x1660034, 0x1660034, 0x1660034, 0x1660034, 0x1660034, 0x1660034, 0x1660034,
+    0x1660034, 0x1660034, 0x1660034, 0x1660034, 0x1660034, 0x1660034, 0x2b63035,
+    0x2b63035, 0x2b63135, 0x2b63135, 0x2b63235, 0x2b63235, 0x2b66135, 0x2b66135,
+    0x2b66335, 0x2b66335, 0x2b66535, 0x2b66535, 0x2b66935, 0x2b66935, 0x2b66f35,
+    0x2b66f35, 0x2b67335, 0x2b67335, 0x2b67435, 0x2b67435, 0x2c62035, 0x2c62535,
+    0x2c62d35, 0x2c62e35, 0x2c62f35, 0x2c63335, 0x2c63435, 0x2c63535, 0x2c63635,
+    0x2c63735, 0x2c63835, 0x2c63935, 0x2c63d35, 0x2c64135, 0x2c65f35, 0x2c66235,
+    0x2c66435, 0x2c66635, 0x2c66735, 0x2c66835, 0x2c66c35, 0x2c66d35, 0x2c66e35,
+    0x2c67035, 0x2c67235, 0x2c67535, 0x1660035, 0x1660035, 0x1660035, 0x1660035,
+    0x1660035, 0x1660035, 0x1660035, 0x1660035, 0x1660035, 0x1660035, 0x1660035,
+    0x1660035, 0x1660035, 0x1660035, 0x1660035, 0x1660035, 0x1660035, 0x1660035,
+    0x2b63036, 0x2b63036, 0x2b63136, 0x2b63136, 0x2b63236, 0x2b63236, 0x2b66136,
+    0x2b66136, 0x2b66336, 0x2b66336, 0x2b66536, 0x2b66536, 0x2b66936, 0x2b66936,
+    0x2b66f36, 0x2b66f36, 0x2b67336, 0x2b67336, 0x2b67436, 0x2b67436, 0x2c62036,
+    0x2c62536, 0x2c62d36, 0x2c62e36, 0x2c62f36, 0x2c63336, 0x2c63436, 0x2c63536,
+    0x2c63636, 0x2c63736, 0x2c63836, 0x2c63936, 0x2c63d36, 0x2c64136, 0x2c65f36,
+    0x2c66236, 0x2c66436, 0x2c66636, 0x2c66736, 0x2c66836, 0x2c66c36, 0x2c66d36,
+    0x2c66e36, 0x2c67036, 0x2c67236, 0x2c67536, 0x1660036, 0x1660036, 0x1660036,
+    0x1660036, 0x1660036, 0x1660036, 0x1660036, 0x1660036, 0x1660036, 0x1660036,
+    0x1660036, 0x1660036, 0x1660036, 0x1660036, 0x1660036, 0x1660036, 0x1660036,
+    0x1660036, 0x2b63037, 0x2b63037, 0x2b63137, 0x2b63137, 0x2b63237, 0x2b63237,
+    0x2b66137, 0x2b66137, 0x2b66337, 0x2b66337, 0x2b66537, 0x2b66537, 0x2b66937,
+    0x2b66937, 0x2b66f37, 0x2b66f37, 0x2b67337, 0x2b67337, 0x2b67437, 0x2b67437,
+    0x2c62037, 0x2c62537, 0x2c62d37, 0x2c62e37, 0x2c62f37, 0x2c63337, 0x2c63437,
+    0x2c63537, 0x2c63637, 0x2c63737, 0x2c63837, 0x2c63937, 0x2c63d37, 0x2c64137,
+    0x2c65f37, 0x2c66237, 0x2c66437, 0x2c66637, 0x2c66737, 0x2c66837, 0x2c66c37,
+    0x2c66d37, 0x2c66e37, 0x2c67037, 0x2c67237, 0x2c67537, 0x1660037, 0x1660037,
+    0x1660037, 0x1660037, 0x1660037, 0x1660037, 0x1660037, 0x1660037, 0x1660037,
+    0x1660037, 0x1660037, 0x1660037, 0x1660037, 0x1660037, 0x1660037, 0x1660037,
+    0x1660037, 0x1660037, 0x2b63038, 0x2b63038, 0x2b63138, 0x2b63138, 0x2b63238,
+    0x2b63238, 0x2b66138, 0x2b66138, 0x2b66338, 0x2b66338, 0x2b66538, 0x2b66538,
+    0x2b66938, 0x2b66938, 0x2b66f38, 0x2b66f38, 0x2b67338, 0x2b67338, 0x2b67438,
+    0x2b67438, 0x2c62038, 0x2c62538, 0x2c62d38, 0x2c62e38, 0x2c62f38, 0x2c63338,
+    0x2c63438, 0x2c63538, 0x2c63638, 0x2c63738, 0x2c63838, 0x2c63938, 0x2c63d38,
+    0x2c64138, 0x2c65f38, 0x2c66238, 0x2c66438, 0x2c66638, 0x2c66738, 0x2c66838,
+    0x2c66c38, 0x2c66d38, 0x2c66e38, 0x2c67038, 0x2c67238, 0x2c67538, 0x1660038,
+    0x1660038, 0x1660038, 0x1660038, 0x1660038, 0x1660038, 0x1660038, 0x1660038,
+    0x1660038, 0x1660038, 0x1660038, 0x1660038, 0x1660038, 0x1660038, 0x1660038,
+    0x1660038, 0x1660038, 0x1660038, 0x2b63039, 0x2b63039, 0x2b63139, 0x2b63139,
+    0x2b63239, 0x2b63239, 0x2b66139, 0x2b66139, 0x2b66339, 0x2b66339, 0x2b66539,
+    0x2b66539, 0x2b66939, 0x2b66939, 0x2b66f39, 0x2b66f39, 0x2b67339, 0x2b67339,
+    0x2b67439, 0x2b67439, 0x2c62039, 0x2c62539, 0x2c62d39, 0x2c62e39, 0x2c62f39,
+    0x2c63339, 0x2c63439, 0x2c63539, 0x2c63639, 0x2c63739, 0x2c63839, 0x2c63939,
+    0x2c63d39, 0x2c64139, 0x2c65f39, 0x2c66239, 0x2c66439, 0x2c66639, 0x2c66739,
+    0x2c66839, 0x2c66c39, 0x2c66d39, 0x2c66e39, 0x2c67039, 0x2c67239, 0x2c67539,
+    0x1660039, 0x1660039, 0x1660039, 0x1660039, 0x1660039, 0x1660039, 0x1660039,
+    0x1660039, 0x1660039, 0x1660039, 0x1660039, 0x1660039, 0x1660039, 0x1660039,
+    0x1660039, 0x1660039, 0x1660039, 0x1660039, 0x2b6303d, 0x2b6303d, 0x2b6313d,
+    0x2b6313d, 0x2b6323d, 0x2b6323d, 0x2b6613d, 0x2b6613d, 0x2b6633d, 0x2b6633d,
+    0x2b6653d, 0x2b6653d, 0x2b6693d, 0x2b6693d, 0x2b66f3d, 0x2b66f3d, 0x2b6733d,
+    0x2b6733d, 0x2b6743d, 0x2b6743d, 0x2c6203d, 0x2c6253d, 0x2c62d3d, 0x2c62e3d,
+    0x2c62f3d, 0x2c6333d, 0x2c6343d, 0x2c6353d, 0x2c6363d, 0x2c6373d, 0x2c6383d,
+    0x2c6393d, 0x2c63d3d, 0x2c6413d, 0x2c65f3d, 0x2c6623d, 0x2c6643d, 0x2c6663d,
+    0x2c6673d, 0x2c6683d, 0x2c66c3d, 0x2c66d3d, 0x2c66e3d, 0x2c6703d, 0x2c6723d,
+    0x2c6753d, 0x166003d, 0x166003d, 0x166003d, 0x166003d, 0x166003d, 0x166003d,
+    0x166003d, 0x166003d, 0x166003d, 0x166003d, 0x166003d, 0x166003d, 0x166003d,
+    0x166003d, 0x166003d, 0x166003d, 0x166003d, 0x166003d, 0x2b63041, 0x2b63041,
+    0x2b63141, 0x2b63141, 0x2b63241, 0x2b63241, 0x2b66141, 0x2b66141, 0x2b66341,
+    0x2b66341, 0x2b66541, 0x2b66541, 0x2b66941, 0x2b66941, 0x2b66f41, 0x2b66f41,
+    0x2b67341, 0x2b67341, 0x2b67441, 0x2b67441, 0x2c62041, 0x2c62541, 0x2c62d41,
+    0x2c62e41, 0x2c62f41, 0x2c63341, 0x2c63441, 0x2c63541, 0x2c63641, 0x2c63741,
+    0x2c63841, 0x2c63941, 0x2c63d41, 0x2c64141, 0x2c65f41, 0x2c66241, 0x2c66441,
+    0x2c66641, 0x2c66741, 0x2c66841, 0x2c66c41, 0x2c66d41, 0x2c66e41, 0x2c67041,
+    0x2c67241, 0x2c67541, 0x1660041, 0x1660041, 0x1660041, 0x1660041, 0x1660041,
+    0x1660041, 0x1660041, 0x1660041, 0x1660041, 0x1660041, 0x1660041, 0x1660041,
+    0x1660041, 0x1660041, 0x1660041, 0x1660041, 0x1660041, 0x1660041, 0x2b6305f,
+    0x2b6305f, 0x2b6315f, 0x2b6315f, 0x2b6325f, 0x2b6325f, 0x2b6615f, 0x2b6615f,
+    0x2b6635f, 0x2b6635f, 0x2b6655f, 0x2b6655f, 0x2b6695f, 0x2b6695f, 0x2b66f5f,
+    0x2b66f5f, 0x2b6735f, 0x2b6735f, 0x2b6745f, 0x2b6745f, 0x2c6205f, 0x2c6255f,
+    0x2c62d5f, 0x2c62e5f, 0x2c62f5f, 0x2c6335f, 0x2c6345f, 0x2c6355f, 0x2c6365f,
+    0x2c6375f, 0x2c6385f, 0x2c6395f, 0x2c63d5f, 0x2c6415f, 0x2c65f5f, 0x2c6625f,
+    0x2c6645f, 0x2c6665f, 0x2c6675f, 0x2c6685f, 0x2c66c5f, 0x2c66d5f, 0x2c66e5f,
+    0x2c6705f, 0x2c6725f, 0x2c6755f, 0x166005f, 0x166005f, 0x166005f, 0x166005f,
+    0x166005f, 0x166005f, 0x166005f, 0x166005f, 0x166005f, 0x166005f, 0x166005f,
+    0x166005f, 0x166005f, 0x166005f, 0x166005f, 0x166005f, 0x166005f, 0x166005f,
+    0x2b63062, 0x2b63062, 0x2b63162, 0x2b63162, 0x2b63262, 0x2b63262, 0x2b66162,
+    0x2b66162, 0x2b66362, 0x2b66362, 0x2b66562, 0x2b66562, 0x2b66962, 0x2b66962,
+    0x2b66f62, 0x2b66f62, 0x2b67362, 0x2b67362, 0x2b67462, 0x2b67462, 0x2c62062,
+    0x2c62562, 0x2c62d62, 0x2c62e62, 0x2c62f62, 0x2c63362, 0x2c63462, 0x2c63562,
+    0x2c63662, 0x2c63762, 0x2c63862, 0x2c63962, 0x2c63d62, 0x2c64162, 0x2c65f62,
+    0x2c66262, 0x2c66462, 0x2c66662, 0x2c66762, 0x2c66862, 0x2c66c62, 0x2c66d62,
+    0x2c66e62, 0x2c67062, 0x2c67262, 0x2c67562, 0x1660062, 0x1660062, 0x1660062,
+    0x1660062, 0x1660062, 0x1660062, 0x1660062, 0x1660062, 0x1660062, 0x1660062,
+    0x1660062, 0x1660062, 0x1660062, 0x1660062, 0x1660062, 0x1660062, 0x1660062,
+    0x1660062, 0x2b63064, 0x2b63064, 0x2b63164, 0x2b63164, 0x2b63264, 0x2b63264,
+    0x2b66164, 0x2b66164, 0x2b66364, 0x2b66364, 0x2b66564, 0x2b66564, 0x2b66964,
+    0x2b66964, 0x2b66f64, 0x2b66f64, 0x2b67364, 0x2b67364, 0x2b67464, 0x2b67464,
+    0x2c62064, 0x2c62564, 0x2c62d64, 0x2c62e64, 0x2c62f64, 0x2c63364, 0x2c63464,
+    0x2c63564, 0x2c63664, 0x2c63764, 0x2c63864, 0x2c63964, 0x2c63d64, 0x2c64164,
+    0x2c65f64, 0x2c66264, 0x2c66464, 0x2c66664, 0x2c66764, 0x2c66864, 0x2c66c64,
+    0x2c66d64, 0x2c66e64, 0x2c67064, 0x2c67264, 0x2c67564, 0x1660064, 0x1660064,
+    0x1660064, 0x1660064, 0x1660064, 0x1660064, 0x1660064, 0x1660064, 0x1660064,
+    0x1660064, 0x1660064, 0x1660064, 0x1660064, 0x1660064, 0x1660064, 0x1660064,
+    0x1660064, 0x1660064, 0x2b63066, 0x2b63066, 0x2b63166, 0x2b63166, 0x2b63266,
+    0x2b63266, 0x2b66166, 0x2b66166, 0x2b66366, 0x2b66366, 0x2b66566, 0x2b66566,
+    0x2b66966, 0x2b66966, 0x2b66f66, 0x2b66f66, 0x2b67366, 0x2b67366, 0x2b67466,
+    0x2b67466, 0x2c62066, 0x2c62566, 0x2c62d66, 0x2c62e66, 0x2c62f66, 0x2c63366,
+    0x2c63466, 0x2c63566, 0x2c63666, 0x2c63766, 0x2c63866, 0x2c63966, 0x2c63d66,
+    0x2c64166, 0x2c65f66, 0x2c66266, 0x2c66466, 0x2c66666, 0x2c66766, 0x2c66866,
+    0x2c66c66, 0x2c66d66, 0x2c66e66, 0x2c67066, 0x2c67266, 0x2c67566, 0x1660066,
+    0x1660066, 0x1660066, 0x1660066, 0x1660066, 0x1660066, 0x1660066, 0x1660066,
+    0x1660066, 0x1660066, 0x1660066, 0x1660066, 0x1660066, 0x1660066, 0x1660066,
+    0x1660066, 0x1660066, 0x1660066, 0x2b63067, 0x2b63067, 0x2b63167, 0x2b63167,
+    0x2b63267, 0x2b63267, 0x2b66167, 0x2b66167, 0x2b66367, 0x2b66367, 0x2b66567,
+    0x2b66567, 0x2b66967, 0x2b66967, 0x2b66f67, 0x2b66f67, 0x2b67367, 0x2b67367,
+    0x2b67467, 0x2b67467, 0x2c62067, 0x2c62567, 0x2c62d67, 0x2c62e67, 0x2c62f67,
+    0x2c63367, 0x2c63467, 0x2c63567, 0x2c63667, 0x2c63767, 0x2c63867, 0x2c63967,
+    0x2c63d67, 0x2c64167, 0x2c65f67, 0x2c66267, 0x2c66467, 0x2c66667, 0x2c66767,
+    0x2c66867, 0x2c66c67, 0x2c66d67, 0x2c66e67, 0x2c67067, 0x2c67267, 0x2c67567,
+    0x1660067, 0x1660067, 0x1660067, 0x1660067, 0x1660067, 0x1660067, 0x1660067,
+    0x1660067, 0x1660067, 0x1660067, 0x1660067, 0x1660067, 0x1660067, 0x1660067,
+    0x1660067, 0x1660067, 0x1660067, 0x1660067, 0x2b63068, 0x2b63068, 0x2b63168,
+    0x2b63168, 0x2b63268, 0x2b63268, 0x2b66168, 0x2b66168, 0x2b66368, 0x2b66368,
+    0x2b66568, 0x2b66568, 0x2b66968, 0x2b66968, 0x2b66f68, 0x2b66f68, 0x2b67368,
+    0x2b67368, 0x2b67468, 0x2b67468, 0x2c62068, 0x2c62568, 0x2c62d68, 0x2c62e68,
+    0x2c62f68, 0x2c63368, 0x2c63468, 0x2c63568, 0x2c63668, 0x2c63768, 0x2c63868,
+    0x2c63968, 0x2c63d68, 0x2c64168, 0x2c65f68, 0x2c66268, 0x2c66468, 0x2c66668,
+    0x2c66768, 0x2c66868, 0x2c66c68, 0x2c66d68, 0x2c66e68, 0x2c67068, 0x2c67268,
+    0x2c67568, 0x1660068, 0x1660068, 0x1660068, 0x1660068, 0x1660068, 0x1660068,
+    0x1660068, 0x1660068, 0x1660068, 0x1660068, 0x1660068, 0x1660068, 0x1660068,
+    0x1660068, 0x1660068, 0x1660068, 0x1660068, 0x1660068, 0x2b6306c, 0x2b6306c,
+    0x2b6316c, 0x2b6316c, 0x2b6326c, 0x2b6326c, 0x2b6616c, 0x2b6616c, 0x2b6636c,
+    0x2b6636c, 0x2b6656c, 0x2b6656c, 0x2b6696c, 0x2b6696c, 0x2b66f6c, 0x2b66f6c,
+    0x2b6736c, 0x2b6736c, 0x2b6746c, 0x2b6746c, 0x2c6206c, 0x2c6256c, 0x2c62d6c,
+    0x2c62e6c, 0x2c62f6c, 0x2c6336c, 0x2c6346c, 0x2c6356c, 0x2c6366c, 0x2c6376c,
+    0x2c6386c, 0x2c6396c, 0x2c63d6c, 0x2c6416c, 0x2c65f6c, 0x2c6626c, 0x2c6646c,
+    0x2c6666c, 0x2c6676c, 0x2c6686c, 0x2c66c6c, 0x2c66d6c, 0x2c66e6c, 0x2c6706c,
+    0x2c6726c, 0x2c6756c, 0x166006c, 0x166006c, 0x166006c, 0x166006c, 0x166006c,
+    0x166006c, 0x166006c, 0x166006c, 0x166006c, 0x166006c, 0x166006c, 0x166006c,
+    0x166006c, 0x166006c, 0x166006c, 0x166006c, 0x166006c, 0x166006c, 0x2b6306d,
+    0x2b6306d, 0x2b6316d, 0x2b6316d, 0x2b6326d, 0x2b6326d, 0x2b6616d, 0x2b6616d,
+    0x2b6636d, 0x2b6636d, 0x2b6656d, 0x2b6656d, 0x2b6696d, 0x2b6696d, 0x2b66f6d,
+    0x2b66f6d, 0x2b6736d, 0x2b6736d, 0x2b6746d, 0x2b6746d, 0x2c6206d, 0x2c6256d,
+    0x2c62d6d, 0x2c62e6d, 0x2c62f6d, 0x2c6336d, 0x2c6346d, 0x2c6356d, 0x2c6366d,
+    0x2c6376d, 0x2c6386d, 0x2c6396d, 0x2c63d6d, 0x2c6416d, 0x2c65f6d, 0x2c6626d,
+    0x2c6646d, 0x2c6666d, 0x2c6676d, 0x2c6686d, 0x2c66c6d, 0x2c66d6d, 0x2c66e6d,
+    0x2c6706d, 0x2c6726d, 0x2c6756d, 0x166006d, 0x166006d, 0x166006d, 0x166006d,
+    0x166006d, 0x166006d, 0x166006d, 0x166006d, 0x166006d, 0x166006d, 0x166006d,
+    0x166006d, 0x166006d, 0x166006d, 0x166006d, 0x166006d, 0x166006d, 0x166006d,
+    0x2b6306e, 0x2b6306e, 0x2b6316e, 0x2b6316e, 0x2b6326e, 0x2b6326e, 0x2b6616e,
+    0x2b6616e, 0x2b6636e, 0x2b6636e, 0x2b6656e, 0x2b6656e, 0x2b6696e, 0x2b6696e,
+    0x2b66f6e, 0x2b66f6e, 0x2b6736e, 0x2b6736e, 0x2b6746e, 0x2b6746e, 0x2c6206e,
+    0x2c6256e, 0x2c62d6e, 0x2c62e6e, 0x2c62f6e, 0x2c6336e, 0x2c6346e, 0x2c6356e,
+    0x2c6366e, 0x2c6376e, 0x2c6386e, 0x2c6396e, 0x2c63d6e, 0x2c6416e, 0x2c65f6e,
+    0x2c6626e, 0x2c6646e, 0x2c6666e, 0x2c6676e, 0x2c6686e, 0x2c66c6e, 0x2c66d6e,
+    0x2c66e6e, 0x2c6706e, 0x2c6726e, 0x2c6756e, 0x166006e, 0x166006e, 0x166006e,
+    0x166006e, 0x166006e, 0x166006e, 0x166006e, 0x166006e, 0x166006e, 0x166006e,
+    0x166006e, 0x166006e, 0x166006e, 0x166006e, 0x166006e, 0x166006e, 0x166006e,
+    0x166006e, 0x2b63070, 0x2b63070, 0x2b63170, 0x2b63170, 0x2b63270, 0x2b63270,
+    0x2b66170, 0x2b66170, 0x2b66370, 0x2b66370, 0x2b66570, 0x2b66570, 0x2b66970,
+    0x2b66970, 0x2b66f70, 0x2b66f70, 0x2b67370, 0x2b67370, 0x2b67470, 0x2b67470,
+    0x2c62070, 0x2c62570, 0x2c62d70, 0x2c62e70, 0x2c62f70, 0x2c63370, 0x2c63470,
+    0x2c63570, 0x2c63670, 0x2c63770, 0x2c63870, 0x2c63970, 0x2c63d70, 0x2c64170,
+    0x2c65f70, 0x2c66270, 0x2c66470, 0x2c66670, 0x2c66770, 0x2c66870, 0x2c66c70,
+    0x2c66d70, 0x2c66e70, 0x2c67070, 0x2c67270, 0x2c67570, 0x1660070, 0x1660070,
+    0x1660070, 0x1660070, 0x1660070, 0x1660070, 0x1660070, 0x1660070, 0x1660070,
+    0x1660070, 0x1660070, 0x1660070, 0x1660070, 0x1660070, 0x1660070, 0x1660070,
+    0x1660070, 0x1660070, 0x2b63072, 0x2b63072, 0x2b63172, 0x2b63172, 0x2b63272,
+    0x2b63272, 0x2b66172, 0x2b66172, 0x2b66372, 0x2b66372, 0x2b66572, 0x2b66572,
+    0x2b66972, 0x2b66972, 0x2b66f72, 0x2b66f72, 0x2b67372, 0x2b67372, 0x2b67472,
+    0x2b67472, 0x2c62072, 0x2c62572, 0x2c62d72, 0x2c62e72, 0x2c62f72, 0x2c63372,
+    0x2c63472, 0x2c63572, 0x2c63672, 0x2c63772, 0x2c63872, 0x2c63972, 0x2c63d72,
+    0x2c64172, 0x2c65f72, 0x2c66272, 0x2c66472, 0x2c66672, 0x2c66772, 0x2c66872,
+    0x2c66c72, 0x2c66d72, 0x2c66e72, 0x2c67072, 0x2c67272, 0x2c67572, 0x1660072,
+    0x1660072, 0x1660072, 0x1660072, 0x1660072, 0x1660072, 0x1660072, 0x1660072,
+    0x1660072, 0x1660072, 0x1660072, 0x1660072, 0x1660072, 0x1660072, 0x1660072,
+    0x1660072, 0x1660072, 0x1660072, 0x2b63075, 0x2b63075, 0x2b63175, 0x2b63175,
+    0x2b63275, 0x2b63275, 0x2b66175, 0x2b66175, 0x2b66375, 0x2b66375, 0x2b66575,
+    0x2b66575, 0x2b66975, 0x2b66975, 0x2b66f75, 0x2b66f75, 0x2b67375, 0x2b67375,
+    0x2b67475, 0x2b67475, 0x2c62075, 0x2c62575, 0x2c62d75, 0x2c62e75, 0x2c62f75,
+    0x2c63375, 0x2c63475, 0x2c63575, 0x2c63675, 0x2c63775, 0x2c63875, 0x2c63975,
+    0x2c63d75, 0x2c64175, 0x2c65f75, 0x2c66275, 0x2c66475, 0x2c66675, 0x2c66775,
+    0x2c66875, 0x2c66c75, 0x2c66d75, 0x2c66e75, 0x2c67075, 0x2c67275, 0x2c67575,
+    0x1660075, 0x1660075, 0x1660075, 0x1660075, 0x1660075, 0x1660075, 0x1660075,
+    0x1660075, 0x1660075, 0x1660075, 0x1660075, 0x1660075, 0x1660075, 0x1660075,
+    0x1660075, 0x1660075, 0x1660075, 0x1660075, 0x2c7303a, 0x2c7313a, 0x2c7323a,
+    0x2c7613a, 0x2c7633a, 0x2c7653a, 0x2c7693a, 0x2c76f3a, 0x2c7733a, 0x2c7743a,
+    0x177003a, 0x177003a, 0x177003a, 0x177003a, 0x177003a, 0x177003a, 0x177003a,
+    0x177003a, 0x177003a, 0x177003a, 0x177003a, 0x177003a, 0x177003a, 0x177003a,
+    0x177003a, 0x177003a, 0x177003a, 0x177003a, 0x177003a, 0x177003a, 0x177003a,
+    0x177003a, 0x2c73042, 0x2c73142, 0x2c73242, 0x2c76142, 0x2c76342, 0x2c76542,
+    0x2c76942, 0x2c76f42, 0x2c77342, 0x2c77442, 0x1770042, 0x1770042, 0x1770042,
+    0x1770042, 0x1770042, 0x1770042, 0x1770042, 0x1770042, 0x1770042, 0x1770042,
+    0x1770042, 0x1770042, 0x1770042, 0x1770042, 0x1770042, 0x1770042, 0x1770042,
+    0x1770042, 0x1770042, 0x1770042, 0x1770042, 0x1770042, 0x2c73043, 0x2c73143,
+    0x2c73243, 0x2c76143, 0x2c76343, 0x2c76543, 0x2c76943, 0x2c76f43, 0x2c77343,
+    0x2c77443, 0x1770043, 0x1770043, 0x1770043, 0x1770043, 0x1770043, 0x1770043,
+    0x1770043, 0x1770043, 0x1770043, 0x1770043, 0x1770043, 0x1770043, 0x1770043,
+    0x1770043, 0x1770043, 0x1770043, 0x1770043, 0x1770043, 0x1770043, 0x1770043,
+    0x1770043, 0x1770043, 0x2c73044, 0x2c73144, 0x2c73244, 0x2c76144, 0x2c76344,
+    0x2c76544, 0x2c76944, 0x2c76f44, 0x2c77344, 0x2c77444, 0x1770044, 0x1770044,
+    0x1770044, 0x1770044, 0x1770044, 0x1770044, 0x1770044, 0x1770044, 0x1770044,
+    0x1770044, 0x1770044, 0x1770044, 0x1770044, 0x1770044, 0x1770044, 0x1770044,
+    0x1770044, 0x1770044, 0x1770044, 0x1770044, 0x1770044, 0x1770044, 0x2c73045,
+    0x2c73145, 0x2c73245, 0x2c76145, 0x2c76345, 0x2c76545, 0x2c76945, 0x2c76f45,
+    0x2c77345, 0x2c77445, 0x1770045, 0x1770045, 0x1770045, 0x1770045, 0x1770045,
+    0x1770045, 0x1770045, 0x1770045, 0x1770045, 0x1770045, 0x1770045, 0x1770045,
+    0x1770045, 0x1770045, 0x1770045, 0x1770045, 0x1770045, 0x1770045, 0x1770045,
+    0x1770045, 0x1770045, 0x1770045, 0x2c73046, 0x2c73146, 0x2c73246, 0x2c76146,
+    0x2c76346, 0x2c76546, 0x2c76946, 0x2c76f46, 0x2c77346, 0x2c77446, 0x1770046,
+    0x1770046, 0x1770046, 0x1770046, 0x1770046, 0x1770046, 0x1770046, 0x1770046,
+    0x1770046, 0x1770046, 0x1770046, 0x1770046, 0x1770046, 0x1770046, 0x1770046,
+    0x1770046, 0x1770046, 0x1770046, 0x1770046, 0x1770046, 0x1770046, 0x1770046,
+    0x2c73047, 0x2c73147, 0x2c73247, 0x2c76147, 0x2c76347, 0x2c76547, 0x2c76947,
+    0x2c76f47, 0x2c77347, 0x2c77447, 0x1770047, 0x1770047, 0x1770047, 0x1770047,
+    0x1770047, 0x1770047, 0x1770047, 0x1770047, 0x1770047, 0x1770047, 0x1770047,
+    0x1770047, 0x1770047, 0x1770047, 0x1770047, 0x1770047, 0x1770047, 0x1770047,
+    0x1770047, 0x1770047, 0x1770047, 0x1770047, 0x2c73048, 0x2c73148, 0x2c73248,
+    0x2c76148, 0x2c76348, 0x2c76548, 0x2c76948, 0x2c76f48, 0x2c77348, 0x2c77448,
+    0x1770048, 0x1770048, 0x1770048, 0x1770048, 0x1770048, 0x1770048, 0x1770048,
+    0x1770048, 0x1770048, 0x1770048, 0x1770048, 0x1770048, 0x1770048, 0x1770048,
+    0x1770048, 0x1770048, 0x1770048, 0x1770048, 0x1770048, 0x1770048, 0x1770048,
+    0x1770048, 0x2c73049, 0x2c73149, 0x2c73249, 0x2c76149, 0x2c76349, 0x2c76549,
+    0x2c76949, 0x2c76f49, 0x2c77349, 0x2c77449, 0x1770049, 0x1770049, 0x1770049,
+    0x1770049, 0x1770049, 0x1770049, 0x1770049, 0x1770049, 0x1770049, 0x1770049,
+    0x1770049, 0x1770049, 0x1770049, 0x1770049, 0x1770049, 0x1770049, 0x1770049,
+    0x1770049, 0x1770049, 0x1770049, 0x1770049, 0x1770049, 0x2c7304a, 0x2c7314a,
+    0x2c7324a, 0x2c7614a, 0x2c7634a, 0x2c7654a, 0x2c7694a, 0x2c76f4a, 0x2c7734a,
+    0x2c7744a, 0x177004a, 0x177004a, 0x177004a, 0x177004a, 0x177004a, 0x177004a,
+    0x177004a, 0x177004a, 0x177004a, 0x177004a, 0x177004a, 0x177004a, 0x177004a,
+    0x177004a, 0x177004a, 0x177004a, 0x177004a, 0x177004a, 0x177004a, 0x177004a,
+    0x177004a, 0x177004a, 0x2c7304b, 0x2c7314b, 0x2c7324b, 0x2c7614b, 0x2c7634b,
+    0x2c7654b, 0x2c7694b, 0x2c76f4b, 0x2c7734b, 0x2c7744b, 0x177004b, 0x177004b,
+    0x177004b, 0x177004b, 0x177004b, 0x177004b, 0x177004b, 0x177004b, 0x177004b,
+    0x177004b, 0x177004b, 0x177004b, 0x177004b, 0x177004b, 0x177004b, 0x177004b,
+    0x177004b, 0x177004b, 0x177004b, 0x177004b, 0x177004b, 0x177004b, 0x2c7304c,
+    0x2c7314c, 0x2c7324c, 0x2c7614c, 0x2c7634c, 0x2c7654c, 0x2c7694c, 0x2c76f4c,
+    0x2c7734c, 0x2c7744c, 0x177004c, 0x177004c, 0x177004c, 0x177004c, 0x177004c,
+    0x177004c, 0x177004c, 0x177004c, 0x177004c, 0x177004c, 0x177004c, 0x177004c,
+    0x177004c, 0x177004c, 0x177004c, 0x177004c, 0x177004c, 0x177004c, 0x177004c,
+    0x177004c, 0x177004c, 0x177004c, 0x2c7304d, 0x2c7314d, 0x2c7324d, 0x2c7614d,
+    0x2c7634d, 0x2c7654d, 0x2c7694d, 0x2c76f4d, 0x2c7734d, 0x2c7744d, 0x177004d,
+    0x177004d, 0x177004d, 0x177004d, 0x177004d, 0x177004d, 0x177004d, 0x177004d,
+    0x177004d, 0x177004d, 0x177004d, 0x177004d, 0x177004d, 0x177004d, 0x177004d,
+    0x177004d, 0x177004d, 0x177004d, 0x177004d, 0x177004d, 0x177004d, 0x177004d,
+    0x2c7304e, 0x2c7314e, 0x2c7324e, 0x2c7614e, 0x2c7634e, 0x2c7654e, 0x2c7694e,
+    0x2c76f4e, 0x2c7734e, 0x2c7744e, 0x177004e, 0x177004e, 0x177004e, 0x177004e,
+    0x177004e, 0x177004e, 0x177004e, 0x177004e, 0x177004e, 0x177004e, 0x177004e,
+    0x177004e, 0x177004e, 0x177004e, 0x177004e, 0x177004e, 0x177004e, 0x177004e,
+    0x177004e, 0x177004e, 0x177004e, 0x177004e, 0x2c7304f, 0x2c7314f, 0x2c7324f,
+    0x2c7614f, 0x2c7634f, 0x2c7654f, 0x2c7694f, 0x2c76f4f, 0x2c7734f, 0x2c7744f,
+    0x177004f, 0x177004f, 0x177004f, 0x177004f, 0x177004f, 0x177004f, 0x177004f,
+    0x177004f, 0x177004f, 0x177004f, 0x177004f, 0x177004f, 0x177004f, 0x177004f,
+    0x177004f, 0x177004f, 0x177004f, 0x177004f, 0x177004f, 0x177004f, 0x177004f,
+    0x177004f, 0x2c73050, 0x2c73150, 0x2c73250, 0x2c76150, 0x2c76350, 0x2c76550,
+    0x2c76950, 0x2c76f50, 0x2c77350, 0x2c77450, 0x1770050, 0x1770050, 0x1770050,
+    0x1770050, 0x1770050, 0x1770050, 0x1770050, 0x1770050, 0x1770050, 0x1770050,
+    0x1770050, 0x1770050, 0x1770050, 0x1770050, 0x1770050, 0x1770050, 0x1770050,
+    0x1770050, 0x1770050, 0x1770050, 0x1770050, 0x1770050, 0x2c73051, 0x2c73151,
+    0x2c73251, 0x2c76151, 0x2c76351, 0x2c76551, 0x2c76951, 0x2c76f51, 0x2c77351,
+    0x2c77451, 0x1770051, 0x1770051, 0x1770051, 0x1770051, 0x1770051, 0x1770051,
+    0x1770051, 0x1770051, 0x1770051, 0x1770051, 0x1770051, 0x1770051, 0x1770051,
+    0x1770051, 0x1770051, 0x1770051, 0x1770051, 0x1770051, 0x1770051, 0x1770051,
+    0x1770051, 0x1770051, 0x2c73052, 0x2c73152, 0x2c73252, 0x2c76152, 0x2c76352,
+    0x2c76552, 0x2c76952, 0x2c76f52, 0x2c77352, 0x2c77452, 0x1770052, 0x1770052,
+    0x1770052, 0x1770052, 0x1770052, 0x1770052, 0x1770052, 0x1770052, 0x1770052,
+    0x1770052, 0x1770052, 0x1770052, 0x1770052, 0x1770052, 0x1770052, 0x1770052,
+    0x1770052, 0x1770052, 0x1770052, 0x1770052, 0x1770052, 0x1770052, 0x2c73053,
+    0x2c73153, 0x2c73253, 0x2c76153, 0x2c76353, 0x2c76553, 0x2c76953, 0x2c76f53,
+    0x2c77353, 0x2c77453, 0x1770053, 0x1770053, 0x1770053, 0x1770053, 0x1770053,
+    0x1770053, 0x1770053, 0x1770053, 0x1770053, 0x1770053, 0x1770053, 0x1770053,
+    0x1770053, 0x1770053, 0x1770053, 0x1770053, 0x1770053, 0x1770053, 0x1770053,
+    0x1770053, 0x1770053, 0x1770053, 0x2c73054, 0x2c73154, 0x2c73254, 0x2c76154,
+    0x2c76354, 0x2c76554, 0x2c76954, 0x2c76f54, 0x2c77354, 0x2c77454, 0x1770054,
+    0x1770054, 0x1770054, 0x1770054, 0x1770054, 0x1770054, 0x1770054, 0x1770054,
+    0x1770054, 0x1770054, 0x1770054, 0x1770054, 0x1770054, 0x1770054, 0x1770054,
+    0x1770054, 0x1770054, 0x1770054, 0x1770054, 0x1770054, 0x1770054, 0x1770054,
+    0x2c73055, 0x2c73155, 0x2c73255, 0x2c76155, 0x2c76355, 0x2c76555, 0x2c76955,
+    0x2c76f55, 0x2c77355, 0x2c77455, 0x1770055, 0x1770055, 0x1770055, 0x1770055,
+    0x1770055, 0x1770055, 0x1770055, 0x1770055, 0x1770055, 0x1770055, 0x1770055,
+    0x1770055, 0x1770055, 0x1770055, 0x1770055, 0x1770055, 0x1770055, 0x1770055,
+    0x1770055, 0x1770055, 0x1770055, 0x1770055, 0x2c73056, 0x2c73156, 0x2c73256,
+    0x2c76156, 0x2c76356, 0x2c76556, 0x2c76956, 0x2c76f56, 0x2c77356, 0x2c77456,
+    0x1770056, 0x1770056, 0x1770056, 0x1770056, 0x1770056, 0x1770056, 0x1770056,
+    0x1770056, 0x1770056, 0x1770056, 0x1770056, 0x1770056, 0x1770056, 0x1770056,
+    0x1770056, 0x1770056, 0x1770056, 0x1770056, 0x1770056, 0x1770056, 0x1770056,
+    0x1770056, 0x2c73057, 0x2c73157, 0x2c73257, 0x2c76157, 0x2c76357, 0x2c76557,
+    0x2c76957, 0x2c76f57, 0x2c77357, 0x2c77457, 0x1770057, 0x1770057, 0x1770057,
+    0x1770057, 0x1770057, 0x1770057, 0x1770057, 0x1770057, 0x1770057, 0x1770057,
+    0x1770057, 0x1770057, 0x1770057, 0x1770057, 0x1770057, 0x1770057, 0x1770057,
+    0x1770057, 0x1770057, 0x1770057, 0x1770057, 0x1770057, 0x2c73059, 0x2c73159,
+    0x2c73259, 0x2c76159, 0x2c76359, 0x2c76559, 0x2c76959, 0x2c76f59, 0x2c77359,
+    0x2c77459, 0x1770059, 0x1770059, 0x1770059, 0x1770059, 0x1770059, 0x1770059,
+    0x1770059, 0x1770059, 0x1770059, 0x1770059, 0x1770059, 0x1770059, 0x1770059,
+    0x1770059, 0x1770059, 0x1770059, 0x1770059, 0x1770059, 0x1770059, 0x1770059,
+    0x1770059, 0x1770059, 0x2c7306a, 0x2c7316a, 0x2c7326a, 0x2c7616a, 0x2c7636a,
+    0x2c7656a, 0x2c7696a, 0x2c76f6a, 0x2c7736a, 0x2c7746a, 0x177006a, 0x177006a,
+    0x177006a, 0x177006a, 0x177006a, 0x177006a, 0x177006a, 0x177006a, 0x177006a,
+    0x177006a, 0x177006a, 0x177006a, 0x177006a, 0x177006a, 0x177006a, 0x177006a,
+    0x177006a, 0x177006a, 0x177006a, 0x177006a, 0x177006a, 0x177006a, 0x2c7306b,
+    0x2c7316b, 0x2c7326b, 0x2c7616b, 0x2c7636b, 0x2c7656b, 0x2c7696b, 0x2c76f6b,
+    0x2c7736b, 0x2c7746b, 0x177006b, 0x177006b, 0x177006b, 0x177006b, 0x177006b,
+    0x177006b, 0x177006b, 0x177006b, 0x177006b, 0x177006b, 0x177006b, 0x177006b,
+    0x177006b, 0x177006b, 0x177006b, 0x177006b, 0x177006b, 0x177006b, 0x177006b,
+    0x177006b, 0x177006b, 0x177006b, 0x2c73071, 0x2c73171, 0x2c73271, 0x2c76171,
+    0x2c76371, 0x2c76571, 0x2c76971, 0x2c76f71, 0x2c77371, 0x2c77471, 0x1770071,
+    0x1770071, 0x1770071, 0x1770071, 0x1770071, 0x1770071, 0x1770071, 0x1770071,
+    0x1770071, 0x1770071, 0x1770071, 0x1770071, 0x1770071, 0x1770071, 0x1770071,
+    0x1770071, 0x1770071, 0x1770071, 0x1770071, 0x1770071, 0x1770071, 0x1770071,
+    0x2c73076, 0x2c73176, 0x2c73276, 0x2c76176, 0x2c76376, 0x2c76576, 0x2c76976,
+    0x2c76f76, 0x2c77376, 0x2c77476, 0x1770076, 0x1770076, 0x1770076, 0x1770076,
+    0x1770076, 0x1770076, 0x1770076, 0x1770076, 0x1770076, 0x1770076, 0x1770076,
+    0x1770076, 0x1770076, 0x1770076, 0x1770076, 0x1770076, 0x1770076, 0x1770076,
+    0x1770076, 0x1770076, 0x1770076, 0x1770076, 0x2c73077, 0x2c73177, 0x2c73277,
+    0x2c76177, 0x2c76377, 0x2c76577, 0x2c76977, 0x2c76f77, 0x2c77377, 0x2c77477,
+    0x1770077, 0x1770077, 0x1770077, 0x1770077, 0x1770077, 0x1770077, 0x1770077,
+    0x1770077, 0x1770077, 0x1770077, 0x1770077, 0x1770077, 0x1770077, 0x1770077,
+    0x1770077, 0x1770077, 0x1770077, 0x1770077, 0x1770077, 0x1770077, 0x1770077,
+    0x1770077, 0x2c73078, 0x2c73178, 0x2c73278, 0x2c76178, 0x2c76378, 0x2c76578,
+    0x2c76978, 0x2c76f78, 0x2c77378, 0x2c77478, 0x1770078, 0x1770078, 0x1770078,
+    0x1770078, 0x1770078, 0x1770078, 0x1770078, 0x1770078, 0x1770078, 0x1770078,
+    0x1770078, 0x1770078, 0x1770078, 0x1770078, 0x1770078, 0x1770078, 0x1770078,
+    0x1770078, 0x1770078, 0x1770078, 0x1770078, 0x1770078, 0x2c73079, 0x2c73179,
+    0x2c73279, 0x2c76179, 0x2c76379, 0x2c76579, 0x2c76979, 0x2c76f79, 0x2c77379,
+    0x2c77479, 0x1770079, 0x1770079, 0x1770079, 0x1770079, 0x1770079, 0x1770079,
+    0x1770079, 0x1770079, 0x1770079, 0x1770079, 0x1770079, 0x1770079, 0x1770079,
+    0x1770079, 0x1770079, 0x1770079, 0x1770079, 0x1770079, 0x1770079, 0x1770079,
+    0x1770079, 0x1770079, 0x2c7307a, 0x2c7317a, 0x2c7327a, 0x2c7617a, 0x2c7637a,
+    0x2c7657a, 0x2c7697a, 0x2c76f7a, 0x2c7737a, 0x2c7747a, 0x177007a, 0x177007a,
+    0x177007a, 0x177007a, 0x177007a, 0x177007a, 0x177007a, 0x177007a, 0x177007a,
+    0x177007a, 0x177007a, 0x177007a, 0x177007a, 0x177007a, 0x177007a, 0x177007a,
+    0x177007a, 0x177007a, 0x177007a, 0x177007a, 0x177007a, 0x177007a, 0x1880026,
+    0x1880026, 0x1880026, 0x1880026, 0x1880026, 0x1880026, 0x1880026, 0x1880026,
+    0x1880026, 0x1880026, 0x1880026, 0x1880026, 0x1880026, 0x1880026, 0x1880026,
+    0x1880026, 0x188002a, 0x188002a, 0x188002a, 0x188002a, 0x188002a, 0x188002a,
+    0x188002a, 0x188002a, 0x188002a, 0x188002a, 0x188002a, 0x188002a, 0x188002a,
+    0x188002a, 0x188002a, 0x188002a, 0x188002c, 0x188002c, 0x188002c, 0x188002c,
+    0x188002c, 0x188002c, 0x188002c, 0x188002c, 0x188002c, 0x188002c, 0x188002c,
+    0x188002c, 0x188002c, 0x188002c, 0x188002c, 0x188002c, 0x188003b, 0x188003b,
+    0x188003b, 0x188003b, 0x188003b, 0x188003b, 0x188003b, 0x188003b, 0x188003b,
+    0x188003b, 0x188003b, 0x188003b, 0x188003b, 0x188003b, 0x188003b, 0x188003b,
+    0x1880058, 0x1880058, 0x1880058, 0x1880058, 0x1880058, 0x1880058, 0x1880058,
+    0x1880058, 0x1880058, 0x1880058, 0x1880058, 0x1880058, 0x1880058, 0x1880058,
+    0x1880058, 0x1880058, 0x188005a, 0x188005a, 0x188005a, 0x188005a, 0x188005a,
+    0x188005a, 0x188005a, 0x188005a, 0x188005a, 0x188005a, 0x188005a, 0x188005a,
+    0x188005a, 0x188005a, 0x188005a, 0x188005a, 0x1aa0021, 0x1aa0021, 0x1aa0021,
+    0x1aa0021, 0x1aa0022, 0x1aa0022, 0x1aa0022, 0x1aa0022, 0x1aa0028, 0x1aa0028,
+    0x1aa0028, 0x1aa0028, 0x1aa0029, 0x1aa0029, 0x1aa0029, 0x1aa0029, 0x1aa003f,
+    0x1aa003f, 0x1aa003f, 0x1aa003f, 0x1bb0027, 0x1bb0027, 0x1bb002b, 0x1bb002b,
+    0x1bb007c, 0x1bb007c, 0x1cc0023, 0x1cc003e, 0x0000000, 0x0000000, 0x0000000,
+    0x0000000,
+};
+
+/* decoding tables for codes longer than HUFF_FAST_BITS, indexed by code
+   length. The HPACK code is canonical, so the codes of each length are
+   consecutive from huff_long_first_code, and the symbol of a code is found
+   at huff_long_offset plus its distance from the first code.
+
+   generated by gen_hpack_tables.cc */
+#define MAX_HUFF_CODE_LENGTH 30
+static const uint32_t huff_long_first_code[31] = {
+    0,          0,          0,          0,          0,          0,
+    0,          0,          0,          0,          0,          0,
+    0,          8184,       16380,      32764,      65534,      131068,
+    262136,     524272,     1048550,    2097116,    4194258,    8388568,
+    16777194,   33554412,   67108832,   134217694,  268435426,  536870910,
+    1073741820,
+};
+static const uint8_t huff_long_count[31] = {
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  2,  3,  0,  0,  0,
+    3,  8,  13, 26, 29, 12, 4,  15, 19, 29, 0,  4,
+};
+static const uint8_t huff_long_offset[31] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,
+    8,   11,  11,  11,  11,  14,  22,  35,  61,  90,  102, 106, 121, 140, 169,
+    169,
+};
+static const uint16_t huff_long_syms[173] = {
+    0,   36,  64,  91,  93,  126, 94,  125, 60,  96,  123, 92,  195, 208, 128,
+    130, 131, 162, 184, 194, 224, 226, 153, 161, 167, 172, 176, 177, 179, 209,
+    216, 217, 227, 229, 230, 129, 132, 133, 134, 136, 146, 154, 156, 160, 163,
+    164, 169, 170, 173, 178, 181, 185, 186, 187, 189, 190, 196, 198, 228, 232,
+    233, 1,   135, 137, 138, 139, 140, 141, 143, 147, 149, 150, 151, 152, 155,
+    157, 158, 165, 166, 168, 174, 175, 180, 182, 183, 188, 191, 197, 231, 239,
+    9,   142, 144, 145, 148, 159, 171, 206, 215, 225, 236, 237, 199, 207, 234,
+    235, 192, 193, 200, 201, 202, 205, 210, 213, 218, 219, 238, 240, 242, 243,
+    255, 203, 204, 211, 212, 214, 221, 222, 223, 241, 244, 245, 246, 247, 248,
+    250, 251, 252, 253, 254, 2,   3,   4,   5,   6,   7,   8,   11,  12,  14,
+    15,  16,  17,  18,  19,  20,  21,  23,  24,  25,  26,  27,  28,  29,  30,
+    31,  127, 220, 249, 10,  13,  22,  256,
+};
+
 static const uint8_t inverse_base64[256] = {
     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
@@ -1253,10 +1890,9 @@ static grpc_error* parse_string_prefix(grpc_chttp2_hpack_parser* p,
   }
 }
 
-/* append some bytes to a string */
-static void append_bytes(grpc_chttp2_hpack_parser_string* str,
-                         const uint8_t* data, size_t length) {
-  if (length == 0) return;
+/* make room for length more bytes in a string */
+static void reserve_bytes(grpc_chttp2_hpack_parser_string* str,
+                          size_t length) {
   if (length + str->data.copied.length > str->data.copied.capacity) {
     GPR_ASSERT(str->data.copied.length + length <= UINT32_MAX);
     str->data.copied.capacity =
@@ -1264,11 +1900,33 @@ static void append_bytes(grpc_chttp2_hpack_parser_string* str,
     str->data.copied.str = static_cast<char*>(
         gpr_realloc(str->data.copied.str, str->data.copied.capacity));
   }
+}
+
+/* append some bytes to a string */
+static void append_bytes(grpc_chttp2_hpack_parser_string* str,
+                         const uint8_t* data, size_t length) {
+  if (length == 0) return;
+  reserve_bytes(str, length);
   memcpy(str->data.copied.str + str->data.copied.length, data, length);
   GPR_ASSERT(length <= UINT32_MAX - str->data.copied.length);
   str->data.copied.length += static_cast<uint32_t>(length);
 }
 
+/* decode as many whole base64 groups as the bulk decoder takes straight into
+   a string, returning the number of characters consumed */
+static size_t append_base64_blocks(grpc_chttp2_hpack_parser_string* str,
+                                   const uint8_t* cur, const uint8_t* end) {
+  const size_t groups = static_cast<size_t>(end - cur) / 4;
+  if (groups < 4) return 0;
+  reserve_bytes(str, groups * 3);
+  const size_t consumed = grpc_base64_decode_blocks(
+      reinterpret_cast<unsigned char*>(str->data.copied.str) +
+          str->data.copied.length,
+      reinterpret_cast<const char*>(cur), groups * 4, 0);
+  str->data.copied.length += static_cast<uint32_t>(consumed / 4 * 3);
+  return consumed;
+}
+
 static grpc_error* append_string(grpc_chttp2_hpack_parser* p,
                                  const uint8_t* cur, const uint8_t* end) {
   grpc_chttp2_hpack_parser_string* str = p->parsing.str;
@@ -1295,6 +1953,7 @@ static grpc_error* append_string(grpc_chttp2_hpack_parser* p,
     /* fallthrough */
     b64_byte0:
     case B64_BYTE0:
+      cur += append_base64_blocks(str, cur, end);
       if (cur == end) {
         p->binary = B64_BYTE0;
         return GRPC_ERROR_NONE;
@@ -1430,9 +2089,76 @@ static grpc_error* huff_nibble(grpc_chttp2_hpack_parser* p, uint8_t nibble) {
   return GRPC_ERROR_NONE;
 }
 
+/* decode a whole huffman encoded string, resolving up to two symbols per
+   table lookup. The output is exactly what feeding the same bytes through
+   huff_nibble would give: complete codes are decoded in order, EOS is
+   dropped, and trailing bits that do not make up a complete code are
+   ignored. */
+static grpc_error* add_huff_string(grpc_chttp2_hpack_parser* p,
+                                   const uint8_t* cur, const uint8_t* end) {
+  uint8_t decoded[256];
+  size_t decoded_length = 0;
+  /* input bits not decoded yet, most significant first */
+  uint64_t buffer = 0;
+  int buffer_bits = 0;
+  for (;;) {
+    while (buffer_bits <= 56 && cur != end) {
+      buffer |= static_cast<uint64_t>(*cur++) << (56 - buffer_bits);
+      buffer_bits += 8;
+    }
+    if (decoded_length > sizeof(decoded) - 2) {
+      grpc_error* err = append_string(p, decoded, decoded + decoded_length);
+      if (err != GRPC_ERROR_NONE) return err;
+      decoded_length = 0;
+    }
+    /* near the end of the string the low bits of the index may be past the
+       input; they are zero then, and any code reaching into them is not
+       complete */
+    const uint32_t entry = huff_fast_tbl[buffer >> (64 - HUFF_FAST_BITS)];
+    const uint32_t nsyms = entry >> 24;
+    if (nsyms != 0) {
+      const int first_length = (entry >> 16) & 0xf;
+      const int length = (entry >> 20) & 0xf;
+      if (first_length > buffer_bits) break;
+      decoded[decoded_length++] = static_cast<uint8_t>(entry);
+      if (nsyms == 2 && length <= buffer_bits) {
+        decoded[decoded_length++] = static_cast<uint8_t>(entry >> 8);
+        buffer <<= length;
+        buffer_bits -= length;
+      } else {
+        buffer <<= first_length;
+        buffer_bits -= first_length;
+      }
+      continue;
+    }
+    int length = HUFF_FAST_BITS + 1;
+    uint32_t code_index = 0;
+    for (; length <= MAX_HUFF_CODE_LENGTH && length <= buffer_bits; length++) {
+      code_index = static_cast<uint32_t>(buffer >> (64 - length)) -
+                   huff_long_first_code[length];
+      if (code_index < huff_long_count[length]) break;
+    }
+    if (length > MAX_HUFF_CODE_LENGTH || length > buffer_bits) break;
+    const uint16_t sym = huff_long_syms[huff_long_offset[length] + code_index];
+    if (sym != 256) {
+      decoded[decoded_length++] = static_cast<uint8_t>(sym);
+    }
+    buffer <<= length;
+    buffer_bits -= length;
+  }
+  return append_string(p, decoded, decoded + decoded_length);
+}
+
 /* decode full bytes from a huffman encoded stream */
 static grpc_error* add_huff_bytes(grpc_chttp2_hpack_parser* p,
                                   const uint8_t* cur, const uint8_t* end) {
+  /* the whole string is here: no decoder state needs to carry over into a
+     later call, so decode it in one go */
+  if (p->strgot == 0 && static_cast<size_t>(end - cur) == p->strlen) {
+    grpc_error* err = add_huff_string(p, cur, end);
+    if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
+    return GRPC_ERROR_NONE;
+  }
   for (; cur != end; ++cur) {
     grpc_error* err = huff_nibble(p, *cur >> 4);
     if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
@@ -56,6 +56,10 @@ typedef enum {
      with the stream */
   GRPC_CHTTP2_LIST_WRITABLE,
   GRPC_CHTTP2_LIST_WRITING,
+  /** writable streams with more than a write quantum pending, set aside
+      during grpc_chttp2_begin_write so that smaller streams are written
+      first (deficit round robin scheduling only) */
+  GRPC_CHTTP2_LIST_WRITABLE_DEFERRED,
   /* No additional ref is taken for the following refs. Make sure to remove the
      stream from these lists when the stream is removed. */
   GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT,
@@ -66,6 +70,17 @@ typedef enum {
   STREAM_LIST_COUNT /* must be last */
 } grpc_chttp2_stream_list_id;
 
+/* how grpc_chttp2_begin_write orders the writable streams of a transport */
+typedef enum {
+  /* streams are written in the order they became writable, each sending as
+     much as flow control allows */
+  GRPC_CHTTP2_WRITE_SCHEDULER_FIFO,
+  /* deficit round robin: streams with no more than a quantum of data pending
+     are written first, then the remaining streams take turns sending at most
+     a quantum each */
+  GRPC_CHTTP2_WRITE_SCHEDULER_DEFICIT_ROUND_ROBIN,
+} grpc_chttp2_write_scheduler;
+
 typedef enum {
   GRPC_CHTTP2_WRITE_STATE_IDLE,
   GRPC_CHTTP2_WRITE_STATE_WRITING,
@@ -219,6 +234,7 @@ class Chttp2IncomingByteStream : public ByteStream {
 
   bool Next(size_t max_size_hint, grpc_closure* on_complete) override;
   grpc_error* Pull(grpc_slice* slice) override;
+  grpc_error* PullAvailable(grpc_slice_buffer* slices) override;
   void Shutdown(grpc_error* error) override;
 
   // TODO(roth): When I converted this class to C++, I wanted to make it
@@ -356,6 +372,35 @@ struct grpc_chttp2_transport {
    */
   uint32_t write_buffer_size = grpc_core::chttp2::kDefaultWindow;
 
+  /** how streams share each write */
+  grpc_chttp2_write_scheduler write_scheduler =
+      GRPC_CHTTP2_WRITE_SCHEDULER_FIFO;
+  /** bytes of DATA a stream may send per turn under deficit round robin */
+  uint32_t write_quantum = 0;
+
+  /** how many bytes we would like to put on the wire during a single write */
+  uint32_t target_write_size = 1024 * 1024;
+  /** should target_write_size follow the socket's send buffer? */
+  bool adaptive_write_size = false;
+  /** writes left until target_write_size is next measured */
+  uint32_t writes_until_write_size_update = 0;
+
+  /** how long a small write may be held back to coalesce it with the ones
+      following it when writes are frequent, in microseconds; zero disables */
+  int write_cork_us = 0;
+  /** is the current write being held back? */
+  bool write_corked = false;
+  /** outbuf length when the current write was held back */
+  size_t write_cork_start_length = 0;
+  /** writes to let through without holding back, after holding back writes
+      turned out not to coalesce anything */
+  uint32_t write_cork_skip = 0;
+  uint32_t write_cork_backoff = 0;
+  /** when the last write was handed to the endpoint */
+  gpr_timespec last_write_time = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  grpc_timer write_cork_timer;
+  grpc_closure write_cork_timer_expired_locked;
+
   /** Set to a grpc_error object if a goaway frame is received. By default, set
    * to GRPC_ERROR_NONE */
   grpc_error* goaway_error = GRPC_ERROR_NONE;
@@ -636,6 +681,9 @@ struct grpc_chttp2_stream {
   grpc_chttp2_write_cb* on_write_finished_cbs = nullptr;
   grpc_chttp2_write_cb* finish_after_write = nullptr;
   size_t sending_bytes = 0;
+  /** deficit round robin: unused DATA allowance carried over to this stream's
+      next turn */
+  uint32_t write_deficit = 0;
 
   /* Stream compression method to be used. */
   grpc_stream_compression_method stream_compression_method =
@@ -711,6 +759,12 @@ bool grpc_chttp2_list_pop_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream** s);
 bool grpc_chttp2_list_remove_writable_stream(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s);
+/** Set aside a writable stream popped during grpc_chttp2_begin_write: it keeps
+    its writable ref, and must be popped again before the write begins */
+void grpc_chttp2_list_add_deferred_writable_stream(grpc_chttp2_transport* t,
+                                                   grpc_chttp2_stream* s);
+bool grpc_chttp2_list_pop_deferred_writable_stream(grpc_chttp2_transport* t,
+                                                   grpc_chttp2_stream** s);
 
 bool grpc_chttp2_list_add_writing_stream(grpc_chttp2_transport* t,
                                          grpc_chttp2_stream* s);
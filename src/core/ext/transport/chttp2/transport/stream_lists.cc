@@ -29,6 +29,8 @@ static const char* stream_list_id_string(grpc_chttp2_stream_list_id id) {
       return "writable";
     case GRPC_CHTTP2_LIST_WRITING:
       return "writing";
+    case GRPC_CHTTP2_LIST_WRITABLE_DEFERRED:
+      return "writable_deferred";
     case GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT:
       return "stalled_by_transport";
     case GRPC_CHTTP2_LIST_STALLED_BY_STREAM:
@@ -154,6 +156,16 @@ bool grpc_chttp2_list_remove_writable_stream(grpc_chttp2_transport* t,
   return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_WRITABLE);
 }
 
+void grpc_chttp2_list_add_deferred_writable_stream(grpc_chttp2_transport* t,
+                                                   grpc_chttp2_stream* s) {
+  stream_list_add_tail(t, s, GRPC_CHTTP2_LIST_WRITABLE_DEFERRED);
+}
+
+bool grpc_chttp2_list_pop_deferred_writable_stream(grpc_chttp2_transport* t,
+                                                   grpc_chttp2_stream** s) {
+  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_WRITABLE_DEFERRED);
+}
+
 bool grpc_chttp2_list_add_writing_stream(grpc_chttp2_transport* t,
                                          grpc_chttp2_stream* s) {
   return stream_list_add(t, s, GRPC_CHTTP2_LIST_WRITING);
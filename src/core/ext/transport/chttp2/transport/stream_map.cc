@@ -35,6 +35,22 @@ void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
   map->count = 0;
   map->free = 0;
   map->capacity = initial_capacity;
+  map->hashed = false;
+}
+
+void grpc_chttp2_stream_map_init_hashed(grpc_chttp2_stream_map* map,
+                                        size_t initial_capacity) {
+  size_t capacity = 4;
+  while (capacity < initial_capacity) capacity *= 2;
+  /* a zero key marks an empty slot; a non-zero key with a null value a
+     deleted one */
+  map->keys =
+      static_cast<uint32_t*>(gpr_zalloc(sizeof(uint32_t) * capacity));
+  map->values = static_cast<void**>(gpr_zalloc(sizeof(void*) * capacity));
+  map->count = 0;
+  map->free = 0;
+  map->capacity = capacity;
+  map->hashed = true;
 }
 
 void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map) {
@@ -56,8 +72,8 @@ static size_t compact(uint32_t* keys, void** values, size_t count) {
   return out;
 }
 
-void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
-                                void* value) {
+static void array_add(grpc_chttp2_stream_map* map, uint32_t key,
+                      void* value) {
   size_t count = map->count;
   size_t capacity = map->capacity;
   uint32_t* keys = map->keys;
@@ -126,7 +142,7 @@ static void** find(grpc_chttp2_stream_map* map, uint32_t key) {
   return nullptr;
 }
 
-void* grpc_chttp2_stream_map_delete(grpc_chttp2_stream_map* map, uint32_t key) {
+static void* array_delete(grpc_chttp2_stream_map* map, uint32_t key) {
   void** pvalue = find<true>(map, key);
   GPR_DEBUG_ASSERT(pvalue != nullptr);
   void* out = *pvalue;
@@ -142,8 +158,116 @@ void* grpc_chttp2_stream_map_delete(grpc_chttp2_stream_map* map, uint32_t key) {
   return out;
 }
 
+static void* array_rand(grpc_chttp2_stream_map* map) {
+  if (map->free != 0) {
+    map->count = compact(map->keys, map->values, map->count);
+    map->free = 0;
+    GPR_ASSERT(map->count > 0);
+  }
+  return map->values[(static_cast<size_t>(rand())) % map->count];
+}
+
+/* home slot of a key: fibonacci hashing spreads the runs of consecutive odd or
+   even ids that http2 produces evenly over the table */
+static size_t hash_slot(grpc_chttp2_stream_map* map, uint32_t key) {
+  return static_cast<size_t>(
+             (static_cast<uint64_t>(key) * 0x9e3779b97f4a7c15ull) >> 32) &
+         (map->capacity - 1);
+}
+
+static void** hash_find(grpc_chttp2_stream_map* map, uint32_t key) {
+  const size_t mask = map->capacity - 1;
+  uint32_t* keys = map->keys;
+  void** values = map->values;
+  for (size_t i = hash_slot(map, key);; i = (i + 1) & mask) {
+    if (keys[i] == key && values[i] != nullptr) return &values[i];
+    if (keys[i] == 0) return nullptr;
+  }
+}
+
+/* reinserts the live entries into a fresh table of the given capacity,
+   dropping deleted slots */
+static void hash_rehash(grpc_chttp2_stream_map* map, size_t capacity) {
+  uint32_t* old_keys = map->keys;
+  void** old_values = map->values;
+  const size_t old_capacity = map->capacity;
+  map->keys = static_cast<uint32_t*>(gpr_zalloc(sizeof(uint32_t) * capacity));
+  map->values = static_cast<void**>(gpr_zalloc(sizeof(void*) * capacity));
+  map->capacity = capacity;
+  const size_t mask = capacity - 1;
+  for (size_t i = 0; i < old_capacity; i++) {
+    if (old_values[i] == nullptr) continue;
+    size_t j = hash_slot(map, old_keys[i]);
+    while (map->keys[j] != 0) j = (j + 1) & mask;
+    map->keys[j] = old_keys[i];
+    map->values[j] = old_values[i];
+  }
+  map->count -= map->free;
+  map->free = 0;
+  gpr_free(old_keys);
+  gpr_free(old_values);
+}
+
+static void hash_add(grpc_chttp2_stream_map* map, uint32_t key, void* value) {
+  GPR_ASSERT(key != 0);
+  GPR_DEBUG_ASSERT(value);
+  GPR_DEBUG_ASSERT(grpc_chttp2_stream_map_find(map, key) == nullptr);
+
+  /* keep at least a quarter of the slots empty so probes stay short; double
+     the table if live entries would fill more than half of it, otherwise just
+     clear out deleted slots */
+  if (map->count + 1 > map->capacity / 4 * 3) {
+    hash_rehash(map, map->count - map->free + 1 > map->capacity / 2
+                         ? 2 * map->capacity
+                         : map->capacity);
+  }
+
+  /* take the first deleted or empty slot on the key's probe path */
+  const size_t mask = map->capacity - 1;
+  size_t i = hash_slot(map, key);
+  while (map->values[i] != nullptr) i = (i + 1) & mask;
+  if (map->keys[i] == 0) {
+    map->count++;
+  } else {
+    map->free--;
+  }
+  map->keys[i] = key;
+  map->values[i] = value;
+}
+
+static void* hash_delete(grpc_chttp2_stream_map* map, uint32_t key) {
+  void** pvalue = hash_find(map, key);
+  GPR_DEBUG_ASSERT(pvalue != nullptr);
+  if (pvalue == nullptr) return nullptr;
+  void* out = *pvalue;
+  *pvalue = nullptr;
+  map->free++;
+  GPR_DEBUG_ASSERT(grpc_chttp2_stream_map_find(map, key) == nullptr);
+  return out;
+}
+
+static void* hash_rand(grpc_chttp2_stream_map* map) {
+  const size_t mask = map->capacity - 1;
+  size_t i = static_cast<size_t>(rand()) & mask;
+  while (map->values[i] == nullptr) i = (i + 1) & mask;
+  return map->values[i];
+}
+
+void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
+                                void* value) {
+  if (map->hashed) {
+    hash_add(map, key, value);
+  } else {
+    array_add(map, key, value);
+  }
+}
+
+void* grpc_chttp2_stream_map_delete(grpc_chttp2_stream_map* map, uint32_t key) {
+  return map->hashed ? hash_delete(map, key) : array_delete(map, key);
+}
+
 void* grpc_chttp2_stream_map_find(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<false>(map, key);
+  void** pvalue = map->hashed ? hash_find(map, key) : find<false>(map, key);
   return pvalue != nullptr ? *pvalue : nullptr;
 }
 
@@ -155,12 +279,7 @@ void* grpc_chttp2_stream_map_rand(grpc_chttp2_stream_map* map) {
   if (map->count == map->free) {
     return nullptr;
   }
-  if (map->free != 0) {
-    map->count = compact(map->keys, map->values, map->count);
-    map->free = 0;
-    GPR_ASSERT(map->count > 0);
-  }
-  return map->values[(static_cast<size_t>(rand())) % map->count];
+  return map->hashed ? hash_rand(map) : array_rand(map);
 }
 
 void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
@@ -169,7 +288,9 @@ void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
                                      void* user_data) {
   size_t i;
 
-  for (i = 0; i < map->count; i++) {
+  /* the hash table never moves entries on deletion, so f may delete the
+     entry it is given from either representation */
+  for (i = 0; i < (map->hashed ? map->capacity : map->count); i++) {
     if (map->values[i]) {
       f(user_data, map->keys[i], map->values[i]);
     }
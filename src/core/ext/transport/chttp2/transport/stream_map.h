@@ -25,19 +25,28 @@
 
 /* Data structure to map a uint32_t to a data object (represented by a void*)
 
-   Represented as a sorted array of keys, and a corresponding array of values.
-   Lookups are performed with binary search.
+   Represented either as a sorted array of keys, and a corresponding array of
+   values, with lookups performed by binary search; or as an open addressing
+   hash table with linear probing, which keeps lookups and deletions constant
+   time when there are many thousands of streams.
    Adds are restricted to strictly higher keys than previously seen (this is
-   guaranteed by http2). */
+   guaranteed by http2), and to non-zero keys for the hash table. */
 struct grpc_chttp2_stream_map {
   uint32_t* keys;
   void** values;
+  /* slots in use: for the hash table, including deleted slots */
   size_t count;
+  /* deleted slots awaiting compaction (or rehashing) */
   size_t free;
   size_t capacity;
+  bool hashed;
 };
 void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
                                  size_t initial_capacity);
+/* Initialize as a hash table; for_each then visits entries in no particular
+   order */
+void grpc_chttp2_stream_map_init_hashed(grpc_chttp2_stream_map* map,
+                                        size_t initial_capacity);
 void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map);
 
 /* Add a new key: given http2 semantics, new keys must always be greater than
@@ -185,8 +185,8 @@ static void report_stall(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 }
 
 /* How many bytes would we like to put on the wire during a single syscall */
-static uint32_t target_write_size(grpc_chttp2_transport* /*t*/) {
-  return 1024 * 1024;
+static uint32_t target_write_size(grpc_chttp2_transport* t) {
+  return t->target_write_size;
 }
 
 // Returns true if initial_metadata contains only default headers.
@@ -194,6 +194,15 @@ static bool is_default_initial_metadata(grpc_metadata_batch* initial_metadata) {
   return initial_metadata->list.default_count == initial_metadata->list.count;
 }
 
+// Returns how many bytes of DATA the stream has ready to frame.
+static size_t pending_data_bytes(grpc_chttp2_stream* s) {
+  return s->flow_controlled_buffer.length +
+         (s->stream_compression_method ==
+                  GRPC_STREAM_COMPRESSION_IDENTITY_COMPRESS
+              ? 0
+              : s->compressed_data_buffer.length);
+}
+
 namespace {
 class StreamWriteContext;
 
@@ -280,14 +289,50 @@ class WriteContext {
       return nullptr;
     }
 
+    switch (t_->write_scheduler) {
+      case GRPC_CHTTP2_WRITE_SCHEDULER_FIFO: {
+        grpc_chttp2_stream* s;
+        if (!grpc_chttp2_list_pop_writable_stream(t_, &s)) {
+          return nullptr;
+        }
+        return s;
+      }
+      case GRPC_CHTTP2_WRITE_SCHEDULER_DEFICIT_ROUND_ROBIN:
+        return NextStreamDeficitRoundRobin();
+    }
+    GPR_UNREACHABLE_CODE(return nullptr);
+  }
+
+  // Streams that can finish within one quantum go first, in the order they
+  // became writable. The others wait on the deferred list and take turns: a
+  // stream that still has data after its turn comes back through the writable
+  // list to the tail of the deferred list.
+  grpc_chttp2_stream* NextStreamDeficitRoundRobin() {
     grpc_chttp2_stream* s;
-    if (!grpc_chttp2_list_pop_writable_stream(t_, &s)) {
+    while (grpc_chttp2_list_pop_writable_stream(t_, &s)) {
+      if (pending_data_bytes(s) <= t_->write_quantum) {
+        return s;
+      }
+      grpc_chttp2_list_add_deferred_writable_stream(t_, s);
+    }
+    if (!grpc_chttp2_list_pop_deferred_writable_stream(t_, &s)) {
       return nullptr;
     }
-
     return s;
   }
 
+  // Deferred streams that did not get a turn before the write filled up wait
+  // for the next write.
+  void RequeueDeferredStreams() {
+    grpc_chttp2_stream* s;
+    while (grpc_chttp2_list_pop_deferred_writable_stream(t_, &s)) {
+      if (t_->closed_with_error != GRPC_ERROR_NONE ||
+          !grpc_chttp2_list_add_writable_stream(t_, s)) {
+        GRPC_CHTTP2_STREAM_UNREF(s, "chttp2_writing:deferred");
+      }
+    }
+  }
+
   void IncInitialMetadataWrites() { ++initial_metadata_writes_; }
   void IncWindowUpdateWrites() { ++flow_control_writes_; }
   void IncMessageWrites() { ++message_writes_; }
@@ -321,7 +366,11 @@ class DataSendContext {
       : write_context_(write_context),
         t_(t),
         s_(s),
-        sending_bytes_before_(s_->sending_bytes) {}
+        sending_bytes_before_(s_->sending_bytes),
+        allowance_(t->write_scheduler ==
+                           GRPC_CHTTP2_WRITE_SCHEDULER_DEFICIT_ROUND_ROBIN
+                       ? s->write_deficit + t->write_quantum
+                       : UINT32_MAX) {}
 
   uint32_t stream_remote_window() const {
     return static_cast<uint32_t> GPR_MAX(
@@ -332,7 +381,8 @@ class DataSendContext {
 
   uint32_t max_outgoing() const {
     return static_cast<uint32_t> GPR_MIN(
-        t_->settings[GRPC_PEER_SETTINGS][GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],
+        GPR_MIN(allowance_, t_->settings[GRPC_PEER_SETTINGS]
+                                        [GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE]),
         GPR_MIN(stream_remote_window(), t_->flow_control->remote_window()));
   }
 
@@ -349,6 +399,7 @@ class DataSendContext {
                             is_last_frame_, &s_->stats.outgoing, &t_->outbuf);
     s_->flow_control->SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    allowance_ -= send_bytes;
   }
 
   void FlushCompressedBytes() {
@@ -386,6 +437,7 @@ class DataSendContext {
     if (s_->compressed_data_buffer.length == 0) {
       s_->sending_bytes += s_->uncompressed_data_size;
     }
+    allowance_ -= send_bytes;
   }
 
   void CompressMoreBytes() {
@@ -407,6 +459,18 @@ class DataSendContext {
 
   bool is_last_frame() const { return is_last_frame_; }
 
+  // Under deficit round robin a stream that still has data pending keeps what
+  // is left of its allowance, up to a quantum, for its next turn.
+  void UpdateDeficit() {
+    if (t_->write_scheduler !=
+        GRPC_CHTTP2_WRITE_SCHEDULER_DEFICIT_ROUND_ROBIN) {
+      return;
+    }
+    s_->write_deficit = pending_data_bytes(s_) > 0
+                            ? GPR_MIN(allowance_, t_->write_quantum)
+                            : 0;
+  }
+
   void CallCallbacks() {
     if (update_list(
             t_, s_,
@@ -422,6 +486,8 @@ class DataSendContext {
   grpc_chttp2_transport* t_;
   grpc_chttp2_stream* s_;
   const size_t sending_bytes_before_;
+  /* DATA bytes this stream may still send in this turn */
+  uint32_t allowance_;
   bool is_last_frame_ = false;
 };
 
@@ -536,6 +602,7 @@ class StreamWriteContext {
       }
     }
     grpc_chttp2_reset_ping_clock(t_);
+    data_send_context.UpdateDeficit();
     if (data_send_context.is_last_frame()) {
       SentLastFrame();
     }
@@ -671,6 +738,7 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
       GRPC_CHTTP2_STREAM_UNREF(s, "chttp2_writing:no_write");
     }
   }
+  ctx.RequeueDeferredStreams();
 
   ctx.FlushWindowUpdates();
 
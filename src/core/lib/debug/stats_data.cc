@@ -47,6 +47,8 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "syscall_read",
     "tcp_backup_pollers_created",
     "tcp_backup_poller_polls",
+    "tcp_read_copy_bytes",
+    "tcp_read_zerocopy_bytes",
     "http2_op_batches",
     "http2_op_cancel",
     "http2_op_send_initial_metadata",
@@ -118,9 +120,14 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "executor_scheduled_to_self",
     "executor_wakeup_initiated",
     "executor_queue_drained",
+    "executor_closures_stolen",
     "executor_push_retries",
     "server_requested_calls",
     "server_slowpath_requests_queued",
+    "tls_server_full_handshakes",
+    "tls_server_resumed_handshakes",
+    "tls_peer_verification_cache_hits",
+    "tls_peer_verification_cache_misses",
     "cq_ev_queue_trylock_failures",
     "cq_ev_queue_trylock_successes",
     "cq_ev_queue_transient_pop_failures",
@@ -156,6 +163,8 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
     "Number of times a backup poller has been created (this can be expensive)",
     "Number of polls performed on the backup poller",
+    "Number of bytes received by copying them out of the socket",
+    "Number of bytes received via TCP receive zerocopy",
     "Number of batches received by HTTP2 transport",
     "Number of cancelations received by HTTP2 transport",
     "Number of batches containing send initial metadata",
@@ -240,11 +249,18 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of closures scheduled by the executor to the executor",
     "Number of thread wakeups initiated within the executor",
     "Number of times an executor queue was drained",
+    "Number of closures stolen by idle executor threads",
     "Number of times we raced and were forced to retry pushing a closure to "
     "the executor",
     "How many calls were requested (not necessarily received) by the server",
     "How many times was the server slow path taken (indicates too few "
     "outstanding requests)",
+    "Number of TLS handshakes completed by servers with a full key exchange",
+    "Number of TLS handshakes completed by servers by resuming a session",
+    "Number of TLS peer certificate chains found in the peer verification "
+    "cache",
+    "Number of TLS peer certificate chains verified and added to the peer "
+    "verification cache",
     "Number of lock (trylock) acquisition failures on completion queue event "
     "queue. High value here indicates high contention on completion queues",
     "Number of lock (trylock) acquisition successes on completion queue event "
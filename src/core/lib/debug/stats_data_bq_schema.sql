@@ -19,6 +19,8 @@ syscall_write_per_iteration:FLOAT,
 syscall_read_per_iteration:FLOAT,
 tcp_backup_pollers_created_per_iteration:FLOAT,
 tcp_backup_poller_polls_per_iteration:FLOAT,
+tcp_read_copy_bytes_per_iteration:FLOAT,
+tcp_read_zerocopy_bytes_per_iteration:FLOAT,
 http2_op_batches_per_iteration:FLOAT,
 http2_op_cancel_per_iteration:FLOAT,
 http2_op_send_initial_metadata_per_iteration:FLOAT,
@@ -90,9 +92,14 @@ executor_scheduled_long_items_per_iteration:FLOAT,
 executor_scheduled_to_self_per_iteration:FLOAT,
 executor_wakeup_initiated_per_iteration:FLOAT,
 executor_queue_drained_per_iteration:FLOAT,
+executor_closures_stolen_per_iteration:FLOAT,
 executor_push_retries_per_iteration:FLOAT,
 server_requested_calls_per_iteration:FLOAT,
 server_slowpath_requests_queued_per_iteration:FLOAT,
+tls_server_full_handshakes_per_iteration:FLOAT,
+tls_server_resumed_handshakes_per_iteration:FLOAT,
+tls_peer_verification_cache_hits_per_iteration:FLOAT,
+tls_peer_verification_cache_misses_per_iteration:FLOAT,
 cq_ev_queue_trylock_failures_per_iteration:FLOAT,
 cq_ev_queue_trylock_successes_per_iteration:FLOAT,
 cq_ev_queue_transient_pop_failures_per_iteration:FLOAT
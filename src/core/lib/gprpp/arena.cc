@@ -25,10 +25,12 @@
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
 #include "src/core/lib/gpr/alloc.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/memory.h"
 
 namespace {
@@ -100,4 +102,71 @@ void* Arena::AllocZone(size_t size) {
   return reinterpret_cast<char*>(z) + zone_base_size;
 }
 
+ArenaPool::ArenaPool()
+    : num_shards_(GPR_CLAMP(static_cast<size_t>(gpr_cpu_num_cores()),
+                            size_t(1), kMaxShards)),
+      shards_(new Shard[num_shards_]) {}
+
+ArenaPool::~ArenaPool() {
+  for (size_t i = 0; i < num_shards_; i++) {
+    Shard& shard = shards_[i];
+    for (size_t j = 0; j < shard.count; j++) {
+      gpr_free_aligned(shard.cached[j].storage);
+    }
+  }
+  delete[] shards_;
+}
+
+ArenaPool::Shard* ArenaPool::CurrentShard() {
+  if (num_shards_ == 1) return shards_;
+  return &shards_[gpr_cpu_current_cpu() % num_shards_];
+}
+
+std::pair<Arena*, void*> ArenaPool::CreateWithAlloc(size_t initial_size,
+                                                    size_t alloc_size) {
+  static constexpr size_t base_size =
+      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
+  initial_size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size);
+  Shard* shard = CurrentShard();
+  void* storage = nullptr;
+  size_t zone_size = 0;
+  gpr_spinlock_lock(&shard->lock);
+  if (shard->count > 0) {
+    CachedArena& cached = shard->cached[--shard->count];
+    storage = cached.storage;
+    zone_size = cached.zone_size;
+  }
+  gpr_spinlock_unlock(&shard->lock);
+  // Reuse the cached buffer unless it is too small for the size we have been
+  // asked for, or so much larger that keeping it would pin memory that the
+  // call size estimate has since decided is not needed.
+  if (storage != nullptr &&
+      (zone_size < initial_size || zone_size / 2 > initial_size)) {
+    gpr_free_aligned(storage);
+    storage = nullptr;
+  }
+  if (storage == nullptr) {
+    storage = ArenaStorage(initial_size);
+    zone_size = initial_size;
+  }
+  auto* new_arena = new (storage) Arena(zone_size, alloc_size);
+  void* first_alloc = reinterpret_cast<char*>(new_arena) + base_size;
+  return std::make_pair(new_arena, first_alloc);
+}
+
+size_t ArenaPool::Release(Arena* arena) {
+  size_t size = arena->total_used_.Load(MemoryOrder::RELAXED);
+  size_t zone_size = arena->initial_zone_size_;
+  arena->~Arena();
+  Shard* shard = CurrentShard();
+  gpr_spinlock_lock(&shard->lock);
+  if (shard->count < kMaxCachedPerShard) {
+    shard->cached[shard->count++] = {arena, zone_size};
+    arena = nullptr;
+  }
+  gpr_spinlock_unlock(&shard->lock);
+  if (arena != nullptr) gpr_free_aligned(arena);
+  return size;
+}
+
 }  // namespace grpc_core
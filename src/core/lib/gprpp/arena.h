@@ -41,6 +41,8 @@
 
 namespace grpc_core {
 
+class ArenaPool;
+
 class Arena {
  public:
   // Create an arena, with \a initial_size bytes in the first allocated buffer.
@@ -79,6 +81,8 @@ class Arena {
   }
 
  private:
+  friend class ArenaPool;
+
   struct Zone {
     Zone* prev;
   };
@@ -115,6 +119,50 @@ class Arena {
   Zone* last_zone_ = nullptr;
 };
 
+// A cache of arena storage, so that objects creating and destroying many
+// arenas of similar size (such as a channel creating calls) can recycle the
+// first zone of each arena instead of going back to the allocator.
+// The cache is sharded by cpu, and each shard holds a handful of buffers.
+// Thread safe; must outlive every arena created from it.
+class ArenaPool {
+ public:
+  ArenaPool();
+  ~ArenaPool();
+
+  ArenaPool(const ArenaPool&) = delete;
+  ArenaPool& operator=(const ArenaPool&) = delete;
+
+  // As Arena::CreateWithAlloc(), but reuses a cached buffer when one of a
+  // suitable size is available. The resulting arena must be released with
+  // Release() rather than Arena::Destroy().
+  std::pair<Arena*, void*> CreateWithAlloc(size_t initial_size,
+                                           size_t alloc_size);
+
+  // Destroy an arena created by this pool, returning the total number of bytes
+  // allocated. The arena's first zone is kept for reuse if there is room.
+  size_t Release(Arena* arena);
+
+ private:
+  static constexpr size_t kMaxShards = 8;
+  static constexpr size_t kMaxCachedPerShard = 4;
+
+  struct CachedArena {
+    void* storage;
+    size_t zone_size;
+  };
+
+  struct Shard {
+    gpr_spinlock lock = GPR_SPINLOCK_STATIC_INITIALIZER;
+    size_t count = 0;
+    CachedArena cached[kMaxCachedPerShard];
+  };
+
+  Shard* CurrentShard();
+
+  size_t num_shards_;
+  Shard* shards_;
+};
+
 }  // namespace grpc_core
 
 #endif /* GRPC_CORE_LIB_GPRPP_ARENA_H */
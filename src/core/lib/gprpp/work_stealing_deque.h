@@ -0,0 +1,123 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_GPRPP_WORK_STEALING_DEQUE_H
+#define GRPC_CORE_LIB_GPRPP_WORK_STEALING_DEQUE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "src/core/lib/gprpp/atomic.h"
+
+namespace grpc_core {
+
+// Fixed capacity lock free work stealing deque of T*, based upon the
+// Chase-Lev deque with the C11 memory orderings from
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al.).
+//
+// A single owner thread pushes and pops at the bottom (LIFO); any number of
+// other threads may concurrently steal from the top (FIFO).
+template <typename T, size_t kCapacity = 1024>
+class WorkStealingDeque {
+  static_assert((kCapacity & (kCapacity - 1)) == 0,
+                "kCapacity must be a power of two");
+
+ public:
+  WorkStealingDeque() {}
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  // Push an element at the bottom. Returns false if the deque is full.
+  // Owner thread only.
+  bool Push(T* item) {
+    intptr_t b = bottom_.Load(MemoryOrder::RELAXED);
+    intptr_t t = top_.Load(MemoryOrder::ACQUIRE);
+    if (b - t >= static_cast<intptr_t>(kCapacity)) return false;
+    slots_[b & (kCapacity - 1)].Store(item, MemoryOrder::RELAXED);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.Store(b + 1, MemoryOrder::RELAXED);
+    return true;
+  }
+
+  // Pop the most recently pushed element, or nullptr if the deque is empty
+  // (or the last element was lost to a concurrent Steal).
+  // Owner thread only.
+  T* Pop() {
+    intptr_t b = bottom_.Load(MemoryOrder::RELAXED) - 1;
+    bottom_.Store(b, MemoryOrder::RELAXED);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    intptr_t t = top_.Load(MemoryOrder::RELAXED);
+    if (t > b) {
+      bottom_.Store(b + 1, MemoryOrder::RELAXED);
+      return nullptr;
+    }
+    T* item = slots_[b & (kCapacity - 1)].Load(MemoryOrder::RELAXED);
+    if (t == b) {
+      // Last element: race against thieves for it.
+      if (!top_.CompareExchangeStrong(&t, t + 1, MemoryOrder::SEQ_CST,
+                                      MemoryOrder::RELAXED)) {
+        item = nullptr;
+      }
+      bottom_.Store(b + 1, MemoryOrder::RELAXED);
+    }
+    return item;
+  }
+
+  // Take the oldest element, or nullptr if the deque is empty or the steal
+  // lost a race with the owner or another thief.
+  // Thread safe.
+  T* Steal() {
+    intptr_t t = top_.Load(MemoryOrder::ACQUIRE);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    intptr_t b = bottom_.Load(MemoryOrder::ACQUIRE);
+    if (t >= b) return nullptr;
+    T* item = slots_[t & (kCapacity - 1)].Load(MemoryOrder::RELAXED);
+    if (!top_.CompareExchangeStrong(&t, t + 1, MemoryOrder::SEQ_CST,
+                                    MemoryOrder::RELAXED)) {
+      return nullptr;
+    }
+    return item;
+  }
+
+  // Approximate number of elements. Thread safe.
+  size_t Size() const {
+    intptr_t b = bottom_.Load(MemoryOrder::RELAXED);
+    intptr_t t = top_.Load(MemoryOrder::RELAXED);
+    return b > t ? static_cast<size_t>(b - t) : 0;
+  }
+
+ private:
+  // Keep the owner's and the thieves' index on separate cachelines.
+  union {
+    char top_padding_[GPR_CACHELINE_SIZE];
+    Atomic<intptr_t> top_{0};
+  };
+  union {
+    char bottom_padding_[GPR_CACHELINE_SIZE];
+    Atomic<intptr_t> bottom_{0};
+  };
+  Atomic<T*> slots_[kCapacity];
+};
+
+}  // namespace grpc_core
+
+#endif /* GRPC_CORE_LIB_GPRPP_WORK_STEALING_DEQUE_H */
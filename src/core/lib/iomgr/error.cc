@@ -123,6 +123,130 @@ static const char* error_time_name(grpc_error_times key) {
   GPR_UNREACHABLE_CODE(return "unknown");
 }
 
+struct inline_error_msg {
+  const char* msg;
+  size_t len;
+};
+#define INLINE_ERROR_MSG(msg) \
+  { msg, sizeof(msg) - 1 }
+#define RST_STREAM_MSG(code) \
+  INLINE_ERROR_MSG("Received RST_STREAM with error code " #code)
+// GRPC_ERROR_STR_GRPC_MESSAGE of an inline RST_STREAM error, indexed by its
+// http2 error code.
+static const inline_error_msg
+    rst_stream_grpc_messages[GRPC_ERROR_INLINE_UNSET_HTTP2] = {
+        RST_STREAM_MSG(0),  RST_STREAM_MSG(1),  RST_STREAM_MSG(2),
+        RST_STREAM_MSG(3),  RST_STREAM_MSG(4),  RST_STREAM_MSG(5),
+        RST_STREAM_MSG(6),  RST_STREAM_MSG(7),  RST_STREAM_MSG(8),
+        RST_STREAM_MSG(9),  RST_STREAM_MSG(10), RST_STREAM_MSG(11),
+        RST_STREAM_MSG(12), RST_STREAM_MSG(13), RST_STREAM_MSG(14),
+};
+#undef RST_STREAM_MSG
+
+struct inline_error_desc {
+  const char* msg;
+  size_t len;
+  // If set, the GRPC_ERROR_STR_GRPC_MESSAGE for each http2 error code.
+  const inline_error_msg* grpc_messages;
+};
+#define INLINE_ERROR_DESC(msg) \
+  { msg, sizeof(msg) - 1, nullptr }
+static const inline_error_desc inline_error_descs[GRPC_ERROR_INLINE_MAX] = {
+    INLINE_ERROR_DESC("Deadline Exceeded"),
+    INLINE_ERROR_DESC("No status received"),
+    INLINE_ERROR_DESC("Server shutdown"),
+    INLINE_ERROR_DESC("Transport destroyed"),
+    INLINE_ERROR_DESC("Truncated message"),
+    INLINE_ERROR_DESC("Buffers full"),
+    INLINE_ERROR_DESC("endpoint destroyed"),
+    {"RST_STREAM", sizeof("RST_STREAM") - 1, rst_stream_grpc_messages},
+    INLINE_ERROR_DESC("Socket closed"),
+    INLINE_ERROR_DESC("EOF"),
+};
+#undef INLINE_ERROR_DESC
+#undef INLINE_ERROR_MSG
+
+static uintptr_t inline_error_field(grpc_error* err, int shift,
+                                    uintptr_t mask) {
+  return (reinterpret_cast<uintptr_t>(err) >> shift) & mask;
+}
+
+static grpc_error* inline_error_with_field(grpc_error* err, int shift,
+                                           uintptr_t mask, uintptr_t value) {
+  uintptr_t bits = reinterpret_cast<uintptr_t>(err);
+  bits = (bits & ~(mask << shift)) | (value << shift);
+  return reinterpret_cast<grpc_error*>(bits);
+}
+
+static uintptr_t inline_error_status(grpc_error* err) {
+  return inline_error_field(err, GRPC_ERROR_INLINE_STATUS_SHIFT,
+                            GRPC_ERROR_INLINE_UNSET_STATUS);
+}
+
+static uintptr_t inline_error_http2(grpc_error* err) {
+  return inline_error_field(err, GRPC_ERROR_INLINE_HTTP2_SHIFT,
+                            GRPC_ERROR_INLINE_UNSET_HTTP2);
+}
+
+static const inline_error_desc& inline_error_description(grpc_error* err) {
+  uintptr_t desc = reinterpret_cast<uintptr_t>(err) >>
+                   GRPC_ERROR_INLINE_DESC_SHIFT;
+  GPR_DEBUG_ASSERT(desc < GRPC_ERROR_INLINE_MAX);
+  return inline_error_descs[desc];
+}
+
+// Returns the GRPC_ERROR_STR_GRPC_MESSAGE of \a err, or nullptr if it has none.
+static const inline_error_msg* inline_error_grpc_message(grpc_error* err) {
+  const inline_error_desc& desc = inline_error_description(err);
+  uintptr_t http2 = inline_error_http2(err);
+  if (desc.grpc_messages == nullptr ||
+      http2 == GRPC_ERROR_INLINE_UNSET_HTTP2) {
+    return nullptr;
+  }
+  return &desc.grpc_messages[http2];
+}
+
+static bool inline_error_get_int(grpc_error* err, grpc_error_ints which,
+                                 intptr_t* p) {
+  uintptr_t value;
+  switch (which) {
+    case GRPC_ERROR_INT_GRPC_STATUS:
+      value = inline_error_status(err);
+      if (value == GRPC_ERROR_INLINE_UNSET_STATUS) return false;
+      break;
+    case GRPC_ERROR_INT_HTTP2_ERROR:
+      value = inline_error_http2(err);
+      if (value == GRPC_ERROR_INLINE_UNSET_HTTP2) return false;
+      break;
+    default:
+      return false;
+  }
+  if (p != nullptr) *p = static_cast<intptr_t>(value);
+  return true;
+}
+
+// Returns the inline error with \a which set to \a value, or nullptr if the
+// result cannot be represented inline.
+static grpc_error* inline_error_set_int(grpc_error* err, grpc_error_ints which,
+                                        intptr_t value) {
+  switch (which) {
+    case GRPC_ERROR_INT_GRPC_STATUS:
+      if (value < GRPC_STATUS_OK || value > GRPC_STATUS_UNAUTHENTICATED) {
+        return nullptr;
+      }
+      return inline_error_with_field(err, GRPC_ERROR_INLINE_STATUS_SHIFT,
+                                     GRPC_ERROR_INLINE_UNSET_STATUS,
+                                     static_cast<uintptr_t>(value));
+    case GRPC_ERROR_INT_HTTP2_ERROR:
+      if (value < 0 || value >= GRPC_ERROR_INLINE_UNSET_HTTP2) return nullptr;
+      return inline_error_with_field(err, GRPC_ERROR_INLINE_HTTP2_SHIFT,
+                                     GRPC_ERROR_INLINE_UNSET_HTTP2,
+                                     static_cast<uintptr_t>(value));
+    default:
+      return nullptr;
+  }
+}
+
 #ifndef NDEBUG
 grpc_error* grpc_error_do_ref(grpc_error* err, const char* file, int line) {
   if (grpc_trace_error_refcount.enabled()) {
@@ -392,7 +516,24 @@ static void ref_errs(grpc_error* err) {
 static grpc_error* copy_error_and_unref(grpc_error* in) {
   GPR_TIMER_SCOPE("copy_error_and_unref", 0);
   grpc_error* out;
-  if (grpc_error_is_special(in)) {
+  if (grpc_error_is_inline(in)) {
+    // Inline errors have no room for anything else: move to the heap.
+    out = GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        inline_error_description(in).msg);
+    intptr_t value;
+    if (inline_error_get_int(in, GRPC_ERROR_INT_GRPC_STATUS, &value)) {
+      internal_set_int(&out, GRPC_ERROR_INT_GRPC_STATUS, value);
+    }
+    if (inline_error_get_int(in, GRPC_ERROR_INT_HTTP2_ERROR, &value)) {
+      internal_set_int(&out, GRPC_ERROR_INT_HTTP2_ERROR, value);
+    }
+    const inline_error_msg* grpc_message = inline_error_grpc_message(in);
+    if (grpc_message != nullptr) {
+      internal_set_str(&out, GRPC_ERROR_STR_GRPC_MESSAGE,
+                       grpc_slice_from_static_buffer(grpc_message->msg,
+                                                     grpc_message->len));
+    }
+  } else if (grpc_error_is_special(in)) {
     out = GRPC_ERROR_CREATE_FROM_STATIC_STRING("unknown");
     if (in == GRPC_ERROR_NONE) {
       internal_set_str(&out, GRPC_ERROR_STR_DESCRIPTION,
@@ -442,6 +583,10 @@ static grpc_error* copy_error_and_unref(grpc_error* in) {
 grpc_error* grpc_error_set_int(grpc_error* src, grpc_error_ints which,
                                intptr_t value) {
   GPR_TIMER_SCOPE("grpc_error_set_int", 0);
+  if (grpc_error_is_inline(src)) {
+    grpc_error* inline_err = inline_error_set_int(src, which, value);
+    if (inline_err != nullptr) return inline_err;
+  }
   grpc_error* new_err = copy_error_and_unref(src);
   internal_set_int(&new_err, which, value);
   return new_err;
@@ -464,6 +609,9 @@ const special_error_status_map error_status_map[] = {
 
 bool grpc_error_get_int(grpc_error* err, grpc_error_ints which, intptr_t* p) {
   GPR_TIMER_SCOPE("grpc_error_get_int", 0);
+  if (grpc_error_is_inline(err)) {
+    return inline_error_get_int(err, which, p);
+  }
   if (grpc_error_is_special(err)) {
     if (which != GRPC_ERROR_INT_GRPC_STATUS) return false;
     *p = error_status_map[reinterpret_cast<size_t>(err)].code;
@@ -487,6 +635,27 @@ grpc_error* grpc_error_set_str(grpc_error* src, grpc_error_strs which,
 
 bool grpc_error_get_str(grpc_error* err, grpc_error_strs which,
                         grpc_slice* str) {
+  if (grpc_error_is_inline(err)) {
+    const char* msg;
+    size_t len;
+    if (which == GRPC_ERROR_STR_DESCRIPTION) {
+      const inline_error_desc& desc = inline_error_description(err);
+      msg = desc.msg;
+      len = desc.len;
+    } else if (which == GRPC_ERROR_STR_GRPC_MESSAGE) {
+      const inline_error_msg* grpc_message = inline_error_grpc_message(err);
+      if (grpc_message == nullptr) return false;
+      msg = grpc_message->msg;
+      len = grpc_message->len;
+    } else {
+      return false;
+    }
+    str->refcount = &grpc_core::kNoopRefcount;
+    str->data.refcounted.bytes =
+        reinterpret_cast<uint8_t*>(const_cast<char*>(msg));
+    str->data.refcounted.length = len;
+    return true;
+  }
   if (grpc_error_is_special(err)) {
     if (which != GRPC_ERROR_STR_GRPC_MESSAGE) return false;
     const special_error_status_map& msg =
@@ -738,11 +907,66 @@ static char* finish_kvs(kv_pairs* kvs) {
   return s;
 }
 
+// Inline errors have nowhere to cache their string, so the strings are cached
+// here instead, one per distinct inline error. Statuses above
+// GRPC_STATUS_UNAUTHENTICATED are never kept inline, which leaves the slot
+// after it free for "no status".
+#define INLINE_ERROR_STATUS_SLOTS (GRPC_STATUS_UNAUTHENTICATED + 2)
+static gpr_atm g_inline_error_strings[GRPC_ERROR_INLINE_MAX]
+                                     [INLINE_ERROR_STATUS_SLOTS]
+                                     [GRPC_ERROR_INLINE_UNSET_HTTP2 + 1];
+
+static const char* inline_error_string(grpc_error* err) {
+  uintptr_t status = inline_error_status(err);
+  size_t status_slot = status == GRPC_ERROR_INLINE_UNSET_STATUS
+                           ? INLINE_ERROR_STATUS_SLOTS - 1
+                           : status;
+  gpr_atm* cache =
+      &g_inline_error_strings[reinterpret_cast<uintptr_t>(err) >>
+                              GRPC_ERROR_INLINE_DESC_SHIFT][status_slot]
+                             [inline_error_http2(err)];
+  void* p = (void*)gpr_atm_acq_load(cache);
+  if (p != nullptr) {
+    return static_cast<const char*>(p);
+  }
+
+  kv_pairs kvs;
+  memset(&kvs, 0, sizeof(kvs));
+
+  grpc_slice desc;
+  grpc_error_get_str(err, GRPC_ERROR_STR_DESCRIPTION, &desc);
+  append_kv(&kvs, key_str(GRPC_ERROR_STR_DESCRIPTION), fmt_str(desc));
+  grpc_slice grpc_message;
+  if (grpc_error_get_str(err, GRPC_ERROR_STR_GRPC_MESSAGE, &grpc_message)) {
+    append_kv(&kvs, key_str(GRPC_ERROR_STR_GRPC_MESSAGE),
+              fmt_str(grpc_message));
+  }
+  intptr_t value;
+  if (inline_error_get_int(err, GRPC_ERROR_INT_GRPC_STATUS, &value)) {
+    append_kv(&kvs, key_int(GRPC_ERROR_INT_GRPC_STATUS), fmt_int(value));
+  }
+  if (inline_error_get_int(err, GRPC_ERROR_INT_HTTP2_ERROR, &value)) {
+    append_kv(&kvs, key_int(GRPC_ERROR_INT_HTTP2_ERROR), fmt_int(value));
+  }
+
+  qsort(kvs.kvs, kvs.num_kvs, sizeof(kv_pair), cmp_kvs);
+
+  char* out = finish_kvs(&kvs);
+
+  if (!gpr_atm_rel_cas(cache, 0, (gpr_atm)out)) {
+    gpr_free(out);
+    out = (char*)gpr_atm_acq_load(cache);
+  }
+
+  return out;
+}
+
 const char* grpc_error_string(grpc_error* err) {
   GPR_TIMER_SCOPE("grpc_error_string", 0);
   if (err == GRPC_ERROR_NONE) return no_error_string;
   if (err == GRPC_ERROR_OOM) return oom_error_string;
   if (err == GRPC_ERROR_CANCELLED) return cancelled_error_string;
+  if (grpc_error_is_inline(err)) return inline_error_string(err);
 
   void* p = (void*)gpr_atm_acq_load(&err->atomics.error_string);
   if (p != nullptr) {
@@ -128,9 +128,69 @@ typedef enum {
 #define GRPC_ERROR_CANCELLED ((grpc_error*)4)
 #define GRPC_ERROR_SPECIAL_MAX GRPC_ERROR_CANCELLED
 
+/// Descriptions that an inline error can carry. Inline errors encode one of
+/// these, a grpc status and an http2 error code directly in the grpc_error
+/// pointer value, so creating, ref-ing and unref-ing them never allocates.
+/// They are meant for the frequent, non-fatal conditions on hot paths
+/// (deadlines, stream resets, shutdown); anything that needs richer
+/// diagnostics should use GRPC_ERROR_CREATE_FROM_* instead.
+typedef enum {
+  GRPC_ERROR_INLINE_DEADLINE_EXCEEDED,
+  GRPC_ERROR_INLINE_NO_STATUS_RECEIVED,
+  GRPC_ERROR_INLINE_SERVER_SHUTDOWN,
+  GRPC_ERROR_INLINE_TRANSPORT_DESTROYED,
+  GRPC_ERROR_INLINE_TRUNCATED_MESSAGE,
+  GRPC_ERROR_INLINE_BUFFERS_FULL,
+  GRPC_ERROR_INLINE_ENDPOINT_DESTROYED,
+  /// Also carries a GRPC_ERROR_STR_GRPC_MESSAGE naming the http2 error code
+  /// once GRPC_ERROR_INT_HTTP2_ERROR is set.
+  GRPC_ERROR_INLINE_RST_STREAM,
+  GRPC_ERROR_INLINE_SOCKET_CLOSED,
+  GRPC_ERROR_INLINE_EOF,
+
+  /// Must always be last
+  GRPC_ERROR_INLINE_MAX,
+} grpc_error_inline_descs;
+
+/// Layout of an inline error (low bits first):
+///   3 bits tag (always 0b110, so bit 0 stays free as for special errors),
+///   5 bits grpc status (GRPC_ERROR_INLINE_UNSET_STATUS if unset),
+///   4 bits http2 error code (GRPC_ERROR_INLINE_UNSET_HTTP2 if unset),
+///   the remaining bits hold the grpc_error_inline_descs value.
+/// Heap allocated errors are at least 8 byte aligned and so never carry the
+/// tag.
+#define GRPC_ERROR_INLINE_TAG_MASK ((uintptr_t)7)
+#define GRPC_ERROR_INLINE_TAG ((uintptr_t)6)
+#define GRPC_ERROR_INLINE_STATUS_SHIFT 3
+#define GRPC_ERROR_INLINE_UNSET_STATUS 31
+#define GRPC_ERROR_INLINE_HTTP2_SHIFT 8
+#define GRPC_ERROR_INLINE_UNSET_HTTP2 15
+#define GRPC_ERROR_INLINE_DESC_SHIFT 12
+
+inline bool grpc_error_is_inline(struct grpc_error* err) {
+  return (reinterpret_cast<uintptr_t>(err) & GRPC_ERROR_INLINE_TAG_MASK) ==
+         GRPC_ERROR_INLINE_TAG;
+}
+
+/// Special and inline errors are not refcounted and own no memory.
 inline bool grpc_error_is_special(struct grpc_error* err) {
-  return err <= GRPC_ERROR_SPECIAL_MAX;
+  return err <= GRPC_ERROR_SPECIAL_MAX || grpc_error_is_inline(err);
+}
+
+/// Create an inline error with no status and no http2 error code attached.
+/// grpc_error_set_int() keeps the result inline when it sets
+/// GRPC_ERROR_INT_GRPC_STATUS or GRPC_ERROR_INT_HTTP2_ERROR; setting anything
+/// else (or adding a child) converts it to a regular heap allocated error.
+inline grpc_error* grpc_error_create_inline(grpc_error_inline_descs desc) {
+  return reinterpret_cast<grpc_error*>(
+      GRPC_ERROR_INLINE_TAG |
+      (static_cast<uintptr_t>(GRPC_ERROR_INLINE_UNSET_STATUS)
+       << GRPC_ERROR_INLINE_STATUS_SHIFT) |
+      (static_cast<uintptr_t>(GRPC_ERROR_INLINE_UNSET_HTTP2)
+       << GRPC_ERROR_INLINE_HTTP2_SHIFT) |
+      (static_cast<uintptr_t>(desc) << GRPC_ERROR_INLINE_DESC_SHIFT));
 }
+#define GRPC_ERROR_CREATE_INLINE(desc) grpc_error_create_inline(desc)
 
 // debug only toggles that allow for a sanity to check that ensures we will
 // never create any errors in the per-RPC hotpath.
@@ -52,26 +52,37 @@
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/iomgr/block_annotate.h"
+#include "src/core/lib/iomgr/ev_io_uring_linux.h"
 #include "src/core/lib/iomgr/ev_posix.h"
 #include "src/core/lib/iomgr/iomgr_internal.h"
 #include "src/core/lib/iomgr/lockfree_event.h"
 #include "src/core/lib/iomgr/wakeup_fd_posix.h"
 #include "src/core/lib/profiling/timers.h"
 
-static grpc_wakeup_fd global_wakeup_fd;
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_epoll1_num_sets, 1,
+    "Number of epoll sets used by the epoll1 polling engine. With more than "
+    "one, fds are spread across per-core-group epoll sets and pollers prefer "
+    "the set of the core group they run on.");
 
 /*******************************************************************************
- * Singleton epoll set related fields
+ * Epoll set related fields
  */
 
 #define MAX_EPOLL_EVENTS 100
 #define MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION 1
 
+/* In sharded mode, the longest a poller blocks before checking again for epoll
+   sets that have no designated poller (see do_epoll_wait()) */
+#define SHARDED_MAX_POLL_TIMEOUT_MS 100
+
 /* NOTE ON SYNCHRONIZATION:
- * - Fields in this struct are only modified by the designated poller. Hence
- *   there is no need for any locks to protect the struct.
+ * - Fields in this struct are only modified by the designated poller of the
+ *   set (or are immutable after init). Hence there is no need for any locks to
+ *   protect the struct.
  * - num_events and cursor fields have to be of atomic type to provide memory
  *   visibility guarantees only. i.e In case of multiple pollers, the designated
  *   polling thread keeps changing; the thread that wrote these values may be
@@ -80,6 +91,17 @@ static grpc_wakeup_fd global_wakeup_fd;
 typedef struct epoll_set {
   int epfd;
 
+  /* Used to kick the designated poller of this set */
+  grpc_wakeup_fd wakeup_fd;
+
+  /* The designated poller of this set */
+  gpr_atm active_poller;
+
+  /* Pollsets in neighborhoods [first_neighborhood,
+     first_neighborhood + num_neighborhoods) poll this set */
+  size_t first_neighborhood;
+  size_t num_neighborhoods;
+
   /* The epoll_events after the last call to epoll_wait() */
   struct epoll_event events[MAX_EPOLL_EVENTS];
 
@@ -91,8 +113,59 @@ typedef struct epoll_set {
   gpr_atm cursor;
 } epoll_set;
 
-/* The global singleton epoll set */
-static epoll_set g_epoll_set;
+/* The epoll sets. Unless GRPC_EPOLL1_NUM_SETS asks for more there is a single
+ * global one. Otherwise every fd is registered with exactly one set ("sharded
+ * mode"), chosen by the CPU that received its traffic, and each set has its own
+ * designated poller drawn from the pollsets of its core group. */
+static epoll_set* g_epoll_sets;
+static size_t g_num_epoll_sets;
+
+/* Sharded mode only: an epoll set watching the epfd of every other set. A set
+ * whose core group currently runs no poller would never be polled, so while any
+ * set lacks a designated poller one worker at a time (the "root poller") waits
+ * on this set instead of its own and services the unattended sets too. */
+static int g_root_epfd = -1;
+static gpr_atm g_root_poller_active;
+
+/* Round robin cursor for fds whose receiving CPU is unknown */
+static gpr_atm g_next_epoll_set;
+
+/* Set when the engine runs as "io_uring": the single epoll set is then backed
+   by the io_uring instance of ev_io_uring_linux.h. Every fd and wakeup fd is
+   registered with a multishot poll request instead of epoll_ctl(), and
+   do_epoll_wait() waits on the ring, translating its completions into
+   set->events so that everything else is shared with epoll. */
+static bool g_use_io_uring;
+
+/* Poll events of the io_uring requests. Multishot poll requests are edge
+   triggered, like the EPOLLET registrations. */
+#define IO_URING_FD_EVENTS (EPOLLIN | EPOLLOUT)
+#define IO_URING_WAKEUP_FD_EVENTS EPOLLIN
+
+/* io_uring only: the poll request of an fd is tagged with the index of a slot
+   of g_io_uring_slots, shifted left by one and with the low bit set. Wakeup
+   fds are tagged with their (aligned) epoll set. A slot is only reused once
+   the kernel delivered the last completion of its request, so a completion
+   still in flight is never attributed to the next user of a recycled grpc_fd
+   or slot. */
+struct io_uring_fd_slot {
+  /* nullptr once fd_orphan() ran */
+  grpc_fd* fd;
+  /* What an epoll registration of fd stores in ev.data.ptr */
+  void* data_ptr;
+  /* Whether the kernel may still deliver completions of the request */
+  bool armed;
+  uint32_t next_free;
+};
+
+#define IO_URING_NO_SLOT UINT32_MAX
+
+/* Protects the slot table. Also serializes re-arming a terminated poll
+   request with fd_orphan() cancelling it. */
+static gpr_mu g_io_uring_mu;
+static io_uring_fd_slot* g_io_uring_slots;
+static uint32_t g_io_uring_slots_capacity;
+static uint32_t g_io_uring_free_slot;
 
 static int epoll_create_and_cloexec() {
 #ifdef GRPC_LINUX_EPOLL_CREATE1
@@ -112,25 +185,104 @@ static int epoll_create_and_cloexec() {
   return fd;
 }
 
+static void epoll_set_shutdown();
+
 /* Must be called *only* once */
 static bool epoll_set_init() {
-  g_epoll_set.epfd = epoll_create_and_cloexec();
-  if (g_epoll_set.epfd < 0) {
-    return false;
+  int num_sets =
+      g_use_io_uring ? 1 : GPR_GLOBAL_CONFIG_GET(grpc_epoll1_num_sets);
+  g_num_epoll_sets = static_cast<size_t>(
+      GPR_CLAMP(num_sets, 1, static_cast<int>(gpr_cpu_num_cores())));
+  g_epoll_sets = static_cast<epoll_set*>(
+      gpr_zalloc(sizeof(*g_epoll_sets) * g_num_epoll_sets));
+  for (size_t i = 0; i < g_num_epoll_sets; i++) {
+    g_epoll_sets[i].epfd = -1;
+    g_epoll_sets[i].wakeup_fd.read_fd = -1;
+  }
+  for (size_t i = 0; i < g_num_epoll_sets; i++) {
+    epoll_set* set = &g_epoll_sets[i];
+    gpr_atm_no_barrier_store(&set->active_poller, 0);
+    gpr_atm_no_barrier_store(&set->num_events, 0);
+    gpr_atm_no_barrier_store(&set->cursor, 0);
+  }
+  if (g_use_io_uring) {
+    gpr_mu_init(&g_io_uring_mu);
+    g_io_uring_slots = nullptr;
+    g_io_uring_slots_capacity = 0;
+    g_io_uring_free_slot = IO_URING_NO_SLOT;
+    if (!grpc_io_uring_init()) {
+      epoll_set_shutdown();
+      return false;
+    }
+    return true;
+  }
+  for (size_t i = 0; i < g_num_epoll_sets; i++) {
+    epoll_set* set = &g_epoll_sets[i];
+    set->epfd = epoll_create_and_cloexec();
+    if (set->epfd < 0) {
+      epoll_set_shutdown();
+      return false;
+    }
+  }
+  gpr_log(GPR_INFO, "grpc epoll fd: %d", g_epoll_sets[0].epfd);
+
+  gpr_atm_no_barrier_store(&g_root_poller_active, 0);
+  gpr_atm_no_barrier_store(&g_next_epoll_set, 0);
+  if (g_num_epoll_sets > 1) {
+    g_root_epfd = epoll_create_and_cloexec();
+    if (g_root_epfd < 0) {
+      epoll_set_shutdown();
+      return false;
+    }
+    for (size_t i = 0; i < g_num_epoll_sets; i++) {
+      struct epoll_event ev;
+      ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLET);
+      ev.data.ptr = &g_epoll_sets[i];
+      if (epoll_ctl(g_root_epfd, EPOLL_CTL_ADD, g_epoll_sets[i].epfd, &ev) !=
+          0) {
+        gpr_log(GPR_ERROR, "epoll_ctl failed: %s", strerror(errno));
+        epoll_set_shutdown();
+        return false;
+      }
+    }
+    gpr_log(GPR_INFO, "grpc epoll1 sharded across %" PRIuPTR " epoll sets",
+            g_num_epoll_sets);
   }
-
-  gpr_log(GPR_INFO, "grpc epoll fd: %d", g_epoll_set.epfd);
-  gpr_atm_no_barrier_store(&g_epoll_set.num_events, 0);
-  gpr_atm_no_barrier_store(&g_epoll_set.cursor, 0);
   return true;
 }
 
 /* epoll_set_init() MUST be called before calling this. */
 static void epoll_set_shutdown() {
-  if (g_epoll_set.epfd >= 0) {
-    close(g_epoll_set.epfd);
-    g_epoll_set.epfd = -1;
+  if (g_use_io_uring) {
+    grpc_io_uring_shutdown();
+    gpr_free(g_io_uring_slots);
+    g_io_uring_slots = nullptr;
+    gpr_mu_destroy(&g_io_uring_mu);
+  }
+  if (g_root_epfd >= 0) {
+    close(g_root_epfd);
+    g_root_epfd = -1;
   }
+  if (g_epoll_sets != nullptr) {
+    for (size_t i = 0; i < g_num_epoll_sets; i++) {
+      if (g_epoll_sets[i].epfd >= 0) {
+        close(g_epoll_sets[i].epfd);
+        g_epoll_sets[i].epfd = -1;
+      }
+    }
+    gpr_free(g_epoll_sets);
+    g_epoll_sets = nullptr;
+  }
+}
+
+/* Returns the set whose wakeup fd is registered with data_ptr, or nullptr if
+   data_ptr refers to a grpc_fd */
+static epoll_set* wakeup_fd_epoll_set(void* data_ptr) {
+  uintptr_t addr = reinterpret_cast<uintptr_t>(data_ptr);
+  uintptr_t begin = reinterpret_cast<uintptr_t>(g_epoll_sets);
+  uintptr_t end = reinterpret_cast<uintptr_t>(g_epoll_sets + g_num_epoll_sets);
+  return addr >= begin && addr < end ? static_cast<epoll_set*>(data_ptr)
+                                     : nullptr;
 }
 
 /*******************************************************************************
@@ -147,6 +299,12 @@ struct grpc_fork_fd_list {
 struct grpc_fd {
   int fd;
 
+  /* The epoll set this fd is registered with */
+  epoll_set* set;
+
+  /* io_uring only: the slot naming this fd in its poll request's tag */
+  uint32_t io_uring_slot;
+
   grpc_core::ManualConstructor<grpc_core::LockfreeEvent> read_closure;
   grpc_core::ManualConstructor<grpc_core::LockfreeEvent> write_closure;
   grpc_core::ManualConstructor<grpc_core::LockfreeEvent> error_closure;
@@ -161,6 +319,7 @@ struct grpc_fd {
 
 static void fd_global_init(void);
 static void fd_global_shutdown(void);
+static epoll_set* choose_epoll_set_for_fd(int fd);
 
 /*******************************************************************************
  * Pollset Declarations
@@ -184,6 +343,8 @@ struct grpc_pollset_worker {
   kick_state state;
   int kick_state_mutator;  // which line of code last changed kick state
   bool initialized_cv;
+  /* The epoll set this worker polls if it becomes the designated poller */
+  epoll_set* set;
   grpc_pollset_worker* next;
   grpc_pollset_worker* prev;
   gpr_cv cv;
@@ -204,6 +365,8 @@ typedef struct pollset_neighborhood {
     struct {
       gpr_mu mu;
       grpc_pollset* active_root;
+      /* The epoll set polled by pollsets in this neighborhood */
+      epoll_set* set;
     };
   };
 } pollset_neighborhood;
@@ -329,6 +492,39 @@ static void fork_fd_list_remove_grpc_fd(grpc_fd* fd) {
   }
 }
 
+static uint64_t io_uring_slot_user_data(uint32_t slot) {
+  return (static_cast<uint64_t>(slot) << 1) | 1;
+}
+
+/* g_io_uring_mu must be held */
+static uint32_t io_uring_slot_alloc(grpc_fd* fd, void* data_ptr) {
+  if (g_io_uring_free_slot == IO_URING_NO_SLOT) {
+    uint32_t old_capacity = g_io_uring_slots_capacity;
+    g_io_uring_slots_capacity = old_capacity == 0 ? 64 : 2 * old_capacity;
+    GPR_ASSERT(g_io_uring_slots_capacity > old_capacity &&
+               g_io_uring_slots_capacity < IO_URING_NO_SLOT);
+    g_io_uring_slots = static_cast<io_uring_fd_slot*>(
+        gpr_realloc(g_io_uring_slots,
+                    sizeof(*g_io_uring_slots) * g_io_uring_slots_capacity));
+    for (uint32_t i = g_io_uring_slots_capacity; i > old_capacity; i--) {
+      g_io_uring_slots[i - 1].next_free = g_io_uring_free_slot;
+      g_io_uring_free_slot = i - 1;
+    }
+  }
+  uint32_t slot = g_io_uring_free_slot;
+  g_io_uring_free_slot = g_io_uring_slots[slot].next_free;
+  g_io_uring_slots[slot].fd = fd;
+  g_io_uring_slots[slot].data_ptr = data_ptr;
+  g_io_uring_slots[slot].armed = false;
+  return slot;
+}
+
+/* g_io_uring_mu must be held */
+static void io_uring_slot_free(uint32_t slot) {
+  g_io_uring_slots[slot].next_free = g_io_uring_free_slot;
+  g_io_uring_free_slot = slot;
+}
+
 static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
   grpc_fd* new_fd = nullptr;
 
@@ -346,6 +542,7 @@ static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
     new_fd->error_closure.Init();
   }
   new_fd->fd = fd;
+  new_fd->set = choose_epoll_set_for_fd(fd);
   new_fd->read_closure->InitEvent();
   new_fd->write_closure->InitEvent();
   new_fd->error_closure->InitEvent();
@@ -370,7 +567,16 @@ static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
    * returned to the free list at that point. */
   ev.data.ptr = reinterpret_cast<void*>(reinterpret_cast<intptr_t>(new_fd) |
                                         (track_err ? 1 : 0));
-  if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+  if (g_use_io_uring) {
+    gpr_mu_lock(&g_io_uring_mu);
+    new_fd->io_uring_slot = io_uring_slot_alloc(new_fd, ev.data.ptr);
+    grpc_error* err = grpc_io_uring_poll_add(
+        fd, IO_URING_FD_EVENTS, io_uring_slot_user_data(new_fd->io_uring_slot),
+        true);
+    g_io_uring_slots[new_fd->io_uring_slot].armed = err == GRPC_ERROR_NONE;
+    gpr_mu_unlock(&g_io_uring_mu);
+    GRPC_LOG_IF_ERROR("fd_create", err);
+  } else if (epoll_ctl(new_fd->set->epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
     gpr_log(GPR_ERROR, "epoll_ctl failed: %s", strerror(errno));
   }
 
@@ -387,11 +593,10 @@ static void fd_shutdown_internal(grpc_fd* fd, grpc_error* why,
   if (fd->read_closure->SetShutdown(GRPC_ERROR_REF(why))) {
     if (!releasing_fd) {
       shutdown(fd->fd, SHUT_RDWR);
-    } else {
+    } else if (!g_use_io_uring) { /* fd_orphan() cancels the poll request */
       /* we need a dummy event for earlier linux versions. */
       epoll_event dummy_event;
-      if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_DEL, fd->fd, &dummy_event) !=
-          0) {
+      if (epoll_ctl(fd->set->epfd, EPOLL_CTL_DEL, fd->fd, &dummy_event) != 0) {
         gpr_log(GPR_ERROR, "epoll_ctl failed: %s", strerror(errno));
       }
     }
@@ -416,6 +621,28 @@ static void fd_orphan(grpc_fd* fd, grpc_closure* on_done, int* release_fd,
                          is_release_fd);
   }
 
+  /* Unlike an epoll registration, a poll request keeps the file alive, so it
+     has to be cancelled before fd->fd is closed or released. Clearing the
+     slot stops the poller from re-arming it and from delivering the
+     completions still in flight; the slot is freed with the last of them.
+     After a fork the slot belongs to a table that no longer exists. */
+  if (g_use_io_uring) {
+    gpr_mu_lock(&g_io_uring_mu);
+    uint32_t slot = fd->io_uring_slot;
+    if (slot < g_io_uring_slots_capacity &&
+        g_io_uring_slots[slot].fd == fd) {
+      g_io_uring_slots[slot].fd = nullptr;
+      if (g_io_uring_slots[slot].armed) {
+        append_error(&error,
+                     grpc_io_uring_poll_remove(io_uring_slot_user_data(slot)),
+                     "fd_orphan");
+      } else {
+        io_uring_slot_free(slot);
+      }
+    }
+    gpr_mu_unlock(&g_io_uring_mu);
+  }
+
   /* If release_fd is not NULL, we should be relinquishing control of the file
      descriptor fd->fd (but we still own the grpc_fd structure). */
   if (is_release_fd) {
@@ -424,7 +651,7 @@ static void fd_orphan(grpc_fd* fd, grpc_closure* on_done, int* release_fd,
     close(fd->fd);
   }
 
-  grpc_core::ExecCtx::Run(DEBUG_LOCATION, on_done, GRPC_ERROR_REF(error));
+  grpc_core::ExecCtx::Run(DEBUG_LOCATION, on_done, error);
 
   grpc_iomgr_unregister_object(&fd->iomgr_object);
   fork_fd_list_remove_grpc_fd(fd);
@@ -467,9 +694,6 @@ static void fd_has_errors(grpc_fd* fd) { fd->error_closure->SetReady(); }
 GPR_TLS_DECL(g_current_thread_pollset);
 GPR_TLS_DECL(g_current_thread_worker);
 
-/* The designated poller */
-static gpr_atm g_active_poller;
-
 static pollset_neighborhood* g_neighborhoods;
 static size_t g_num_neighborhoods;
 
@@ -514,25 +738,59 @@ static size_t choose_neighborhood(void) {
   return static_cast<size_t>(gpr_cpu_current_cpu()) % g_num_neighborhoods;
 }
 
+/* Picks the epoll set of the core group that received the connection's
+   traffic (SO_INCOMING_CPU) so that the poller handling it runs on the same
+   cores. Listeners and not yet connected sockets report no CPU and are spread
+   round robin. */
+static epoll_set* choose_epoll_set_for_fd(int fd) {
+  if (g_num_epoll_sets == 1) return &g_epoll_sets[0];
+#ifdef SO_INCOMING_CPU
+  int cpu = -1;
+  socklen_t len = sizeof(cpu);
+  if (getsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &len) == 0 &&
+      cpu >= 0) {
+    return g_neighborhoods[static_cast<size_t>(cpu) % g_num_neighborhoods].set;
+  }
+#else
+  (void)fd;
+#endif
+  size_t idx = static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
+      &g_next_epoll_set, static_cast<gpr_atm>(1)));
+  return &g_epoll_sets[idx % g_num_epoll_sets];
+}
+
 static grpc_error* pollset_global_init(void) {
   gpr_tls_init(&g_current_thread_pollset);
   gpr_tls_init(&g_current_thread_worker);
-  gpr_atm_no_barrier_store(&g_active_poller, 0);
-  global_wakeup_fd.read_fd = -1;
-  grpc_error* err = grpc_wakeup_fd_init(&global_wakeup_fd);
-  if (err != GRPC_ERROR_NONE) return err;
-  struct epoll_event ev;
-  ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLET);
-  ev.data.ptr = &global_wakeup_fd;
-  if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_ADD, global_wakeup_fd.read_fd,
-                &ev) != 0) {
-    return GRPC_OS_ERROR(errno, "epoll_ctl");
+  for (size_t i = 0; i < g_num_epoll_sets; i++) {
+    epoll_set* set = &g_epoll_sets[i];
+    grpc_error* err = grpc_wakeup_fd_init(&set->wakeup_fd);
+    if (err != GRPC_ERROR_NONE) return err;
+    if (g_use_io_uring) {
+      err = grpc_io_uring_poll_add(set->wakeup_fd.read_fd,
+                                   IO_URING_WAKEUP_FD_EVENTS,
+                                   reinterpret_cast<uint64_t>(set), true);
+      if (err != GRPC_ERROR_NONE) return err;
+      continue;
+    }
+    struct epoll_event ev;
+    ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLET);
+    ev.data.ptr = set;
+    if (epoll_ctl(set->epfd, EPOLL_CTL_ADD, set->wakeup_fd.read_fd, &ev) !=
+        0) {
+      return GRPC_OS_ERROR(errno, "epoll_ctl");
+    }
   }
   g_num_neighborhoods = GPR_CLAMP(gpr_cpu_num_cores(), 1, MAX_NEIGHBORHOODS);
   g_neighborhoods = static_cast<pollset_neighborhood*>(
       gpr_zalloc(sizeof(*g_neighborhoods) * g_num_neighborhoods));
   for (size_t i = 0; i < g_num_neighborhoods; i++) {
     gpr_mu_init(&g_neighborhoods[i].mu);
+    /* Consecutive neighborhoods (i.e. cores) form the core group of a set */
+    epoll_set* set = &g_epoll_sets[i * g_num_epoll_sets / g_num_neighborhoods];
+    if (set->num_neighborhoods == 0) set->first_neighborhood = i;
+    set->num_neighborhoods++;
+    g_neighborhoods[i].set = set;
   }
   return GRPC_ERROR_NONE;
 }
@@ -540,7 +798,12 @@ static grpc_error* pollset_global_init(void) {
 static void pollset_global_shutdown(void) {
   gpr_tls_destroy(&g_current_thread_pollset);
   gpr_tls_destroy(&g_current_thread_worker);
-  if (global_wakeup_fd.read_fd != -1) grpc_wakeup_fd_destroy(&global_wakeup_fd);
+  for (size_t i = 0; i < g_num_epoll_sets; i++) {
+    if (g_epoll_sets[i].wakeup_fd.read_fd != -1) {
+      grpc_wakeup_fd_destroy(&g_epoll_sets[i].wakeup_fd);
+      g_epoll_sets[i].wakeup_fd.read_fd = -1;
+    }
+  }
   for (size_t i = 0; i < g_num_neighborhoods; i++) {
     gpr_mu_destroy(&g_neighborhoods[i].mu);
   }
@@ -610,7 +873,7 @@ static grpc_error* pollset_kick_all(grpc_pollset* pollset) {
         case DESIGNATED_POLLER:
           GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
           SET_KICK_STATE(worker, KICKED);
-          append_error(&error, grpc_wakeup_fd_wakeup(&global_wakeup_fd),
+          append_error(&error, grpc_wakeup_fd_wakeup(&worker->set->wakeup_fd),
                        "pollset_kick_all");
           break;
       }
@@ -655,84 +918,269 @@ static int poll_deadline_to_millis_timeout(grpc_millis millis) {
   }
 }
 
+/* Dispatches a single epoll event to the fd (or wakeup fd) it refers to */
+static void process_epoll_event(struct epoll_event* ev, grpc_error** error) {
+  static const char* err_desc = "process_events";
+  void* data_ptr = ev->data.ptr;
+  epoll_set* wakeup_set = wakeup_fd_epoll_set(data_ptr);
+
+  if (wakeup_set != nullptr) {
+    append_error(error, grpc_wakeup_fd_consume_wakeup(&wakeup_set->wakeup_fd),
+                 err_desc);
+  } else {
+    grpc_fd* fd = reinterpret_cast<grpc_fd*>(
+        reinterpret_cast<intptr_t>(data_ptr) & ~static_cast<intptr_t>(1));
+    bool track_err =
+        reinterpret_cast<intptr_t>(data_ptr) & static_cast<intptr_t>(1);
+    bool cancel = (ev->events & EPOLLHUP) != 0;
+    bool error = (ev->events & EPOLLERR) != 0;
+    bool read_ev = (ev->events & (EPOLLIN | EPOLLPRI)) != 0;
+    bool write_ev = (ev->events & EPOLLOUT) != 0;
+    bool err_fallback = error && !track_err;
+
+    if (error && !err_fallback) {
+      fd_has_errors(fd);
+    }
+
+    if (read_ev || cancel || err_fallback) {
+      fd_become_readable(fd);
+    }
+
+    if (write_ev || cancel || err_fallback) {
+      fd_become_writable(fd);
+    }
+  }
+}
+
 /* Process the epoll events found by do_epoll_wait() function.
-   - g_epoll_set.cursor points to the index of the first event to be processed
-   - This function then processes up-to MAX_EPOLL_EVENTS_PER_ITERATION and
-     updates the g_epoll_set.cursor
+   - set->cursor points to the index of the first event to be processed
+   - This function then processes up-to MAX_EPOLL_EVENTS_PER_ITERATION (all of
+     them in sharded mode, where each set has its own designated poller) and
+     updates the set->cursor
 
    NOTE ON SYNCRHONIZATION: Similar to do_epoll_wait(), this function is only
-   called by g_active_poller thread. So there is no need for synchronization
-   when accessing fields in g_epoll_set */
-static grpc_error* process_epoll_events(grpc_pollset* /*pollset*/) {
+   called by the designated poller of the set. So there is no need for
+   synchronization when accessing fields in set */
+static grpc_error* process_epoll_events(grpc_pollset* /*pollset*/,
+                                        epoll_set* set) {
   GPR_TIMER_SCOPE("process_epoll_events", 0);
 
-  static const char* err_desc = "process_events";
   grpc_error* error = GRPC_ERROR_NONE;
-  long num_events = gpr_atm_acq_load(&g_epoll_set.num_events);
-  long cursor = gpr_atm_acq_load(&g_epoll_set.cursor);
-  for (int idx = 0;
-       (idx < MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION) && cursor != num_events;
-       idx++) {
+  long num_events = gpr_atm_acq_load(&set->num_events);
+  long cursor = gpr_atm_acq_load(&set->cursor);
+  int max_events = g_num_epoll_sets > 1
+                       ? MAX_EPOLL_EVENTS
+                       : MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION;
+  for (int idx = 0; (idx < max_events) && cursor != num_events; idx++) {
     long c = cursor++;
-    struct epoll_event* ev = &g_epoll_set.events[c];
-    void* data_ptr = ev->data.ptr;
+    process_epoll_event(&set->events[c], &error);
+  }
+  gpr_atm_rel_store(&set->cursor, cursor);
+  return error;
+}
 
-    if (data_ptr == &global_wakeup_fd) {
-      append_error(&error, grpc_wakeup_fd_consume_wakeup(&global_wakeup_fd),
-                   err_desc);
+static int epoll_wait_no_eintr(int epfd, struct epoll_event* events,
+                               int timeout) {
+  int r;
+  do {
+    GRPC_STATS_INC_SYSCALL_POLL();
+    r = epoll_wait(epfd, events, MAX_EPOLL_EVENTS, timeout);
+  } while (r < 0 && errno == EINTR);
+  return r;
+}
+
+/* Returns what an epoll registration of the fd whose poll request produced c
+   stores in ev.data.ptr, or nullptr if the fd was orphaned. Re-arms the
+   request if the kernel terminated it (e.g. after a CQ overflow); it is then
+   submitted with the next wait. g_io_uring_mu must be held. */
+static void* io_uring_fd_completion(const grpc_io_uring_completion* c,
+                                    grpc_error** error) {
+  uint32_t slot = static_cast<uint32_t>(c->user_data >> 1);
+  io_uring_fd_slot* s = &g_io_uring_slots[slot];
+  if (!c->more) s->armed = false;
+  if (s->fd == nullptr) {
+    if (!s->armed) io_uring_slot_free(slot);
+    return nullptr;
+  }
+  if (!s->armed && !fd_is_shutdown(s->fd)) {
+    grpc_error* err = grpc_io_uring_poll_add(s->fd->fd, IO_URING_FD_EVENTS,
+                                             c->user_data, false);
+    s->armed = err == GRPC_ERROR_NONE;
+    append_error(error, err, "io_uring_wait");
+  }
+  return s->data_ptr;
+}
+
+/* io_uring counterpart of epoll_wait() on the set: translates the
+   completions into set->events, dropping those of orphaned fds */
+static int io_uring_wait_no_eintr(epoll_set* set, int timeout,
+                                  grpc_error** error) {
+  static const char* err_desc = "io_uring_wait";
+  grpc_io_uring_completion completions[MAX_EPOLL_EVENTS];
+  int r = grpc_io_uring_wait(completions, MAX_EPOLL_EVENTS, timeout);
+  if (r < 0) return r;
+  int n = 0;
+  gpr_mu_lock(&g_io_uring_mu);
+  for (int i = 0; i < r; i++) {
+    const grpc_io_uring_completion* c = &completions[i];
+    void* data_ptr;
+    if (c->user_data & 1) {
+      data_ptr = io_uring_fd_completion(c, error);
+      if (data_ptr == nullptr) continue;
     } else {
-      grpc_fd* fd = reinterpret_cast<grpc_fd*>(
-          reinterpret_cast<intptr_t>(data_ptr) & ~static_cast<intptr_t>(1));
-      bool track_err =
-          reinterpret_cast<intptr_t>(data_ptr) & static_cast<intptr_t>(1);
-      bool cancel = (ev->events & EPOLLHUP) != 0;
-      bool error = (ev->events & EPOLLERR) != 0;
-      bool read_ev = (ev->events & (EPOLLIN | EPOLLPRI)) != 0;
-      bool write_ev = (ev->events & EPOLLOUT) != 0;
-      bool err_fallback = error && !track_err;
-
-      if (error && !err_fallback) {
-        fd_has_errors(fd);
+      data_ptr = reinterpret_cast<void*>(c->user_data);
+      if (!c->more && c->res != -ECANCELED) {
+        append_error(error,
+                     grpc_io_uring_poll_add(set->wakeup_fd.read_fd,
+                                            IO_URING_WAKEUP_FD_EVENTS,
+                                            c->user_data, false),
+                     err_desc);
+      }
+    }
+    if (c->res < 0) {
+      if (c->res != -ECANCELED && GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+        gpr_log(GPR_INFO, "poll request %p failed: %s", data_ptr,
+                strerror(-c->res));
       }
+      continue;
+    }
+    set->events[n].events = static_cast<uint32_t>(c->res);
+    set->events[n].data.ptr = data_ptr;
+    n++;
+  }
+  gpr_mu_unlock(&g_io_uring_mu);
+  return n;
+}
 
-      if (read_ev || cancel || err_fallback) {
-        fd_become_readable(fd);
+static bool any_epoll_set_unattended() {
+  for (size_t i = 0; i < g_num_epoll_sets; i++) {
+    if (gpr_atm_no_barrier_load(&g_epoll_sets[i].active_poller) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/* Processes everything pending in a set that has no designated poller. Several
+   threads may drain the same set concurrently: the kernel hands every
+   (edge-triggered) event to only one of them, and the events are copied to a
+   local buffer rather than to set->events. */
+static grpc_error* drain_unattended_epoll_set(epoll_set* set) {
+  grpc_error* error = GRPC_ERROR_NONE;
+  struct epoll_event events[MAX_EPOLL_EVENTS];
+  int r;
+  do {
+    r = epoll_wait_no_eintr(set->epfd, events, 0);
+    if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
+    GRPC_STATS_INC_POLL_EVENTS_RETURNED(r);
+    for (int i = 0; i < r; i++) {
+      process_epoll_event(&events[i], &error);
+    }
+  } while (r == MAX_EPOLL_EVENTS);
+  return error;
+}
+
+/* Sharded mode: waits on g_root_epfd, which reports the sets with pending
+   events. The worker's own set is harvested into set->events as usual; sets
+   without a designated poller are drained on the spot. */
+static grpc_error* do_root_epoll_wait(grpc_pollset* ps, epoll_set* set,
+                                      int timeout) {
+  GPR_TIMER_SCOPE("do_root_epoll_wait", 0);
+  static const char* err_desc = "do_root_epoll_wait";
+  grpc_error* error = GRPC_ERROR_NONE;
+
+  /* Readiness edges on g_root_epfd may have been consumed while the sets were
+     polled directly, so check for anything already pending first. */
+  int r = epoll_wait_no_eintr(set->epfd, set->events, 0);
+  if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
+  if (r == 0) {
+    for (size_t i = 0; i < g_num_epoll_sets; i++) {
+      epoll_set* other = &g_epoll_sets[i];
+      if (other != set && gpr_atm_no_barrier_load(&other->active_poller) == 0) {
+        append_error(&error, drain_unattended_epoll_set(other), err_desc);
       }
+    }
 
-      if (write_ev || cancel || err_fallback) {
-        fd_become_writable(fd);
+    struct epoll_event root_events[MAX_EPOLL_EVENTS];
+    if (timeout != 0) {
+      GRPC_SCHEDULING_START_BLOCKING_REGION;
+    }
+    int nroot = epoll_wait_no_eintr(g_root_epfd, root_events, timeout);
+    if (timeout != 0) {
+      GRPC_SCHEDULING_END_BLOCKING_REGION;
+    }
+    if (nroot < 0) {
+      append_error(&error, GRPC_OS_ERROR(errno, "epoll_wait"), err_desc);
+      nroot = 0;
+    }
+    for (int i = 0; i < nroot; i++) {
+      epoll_set* ready = static_cast<epoll_set*>(root_events[i].data.ptr);
+      if (ready == set) {
+        r = epoll_wait_no_eintr(set->epfd, set->events, 0);
+        if (r < 0) {
+          append_error(&error, GRPC_OS_ERROR(errno, "epoll_wait"), err_desc);
+          r = 0;
+        }
+      } else if (gpr_atm_no_barrier_load(&ready->active_poller) == 0) {
+        append_error(&error, drain_unattended_epoll_set(ready), err_desc);
       }
     }
   }
-  gpr_atm_rel_store(&g_epoll_set.cursor, cursor);
+
+  GRPC_STATS_INC_POLL_EVENTS_RETURNED(r);
+
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+    gpr_log(GPR_INFO, "ps: %p root poll got %d events", ps, r);
+  }
+
+  gpr_atm_rel_store(&set->num_events, r);
+  gpr_atm_rel_store(&set->cursor, 0);
   return error;
 }
 
-/* Do epoll_wait and store the events in g_epoll_set.events field. This does not
+/* Do epoll_wait and store the events in set->events field. This does not
    "process" any of the events yet; that is done in process_epoll_events().
    *See process_epoll_events() function for more details.
 
-   NOTE ON SYNCHRONIZATION: At any point of time, only the g_active_poller
-   (i.e the designated poller thread) will be calling this function. So there is
-   no need for any synchronization when accesing fields in g_epoll_set */
-static grpc_error* do_epoll_wait(grpc_pollset* ps, grpc_millis deadline) {
+   In sharded mode the wait is bounded by SHARDED_MAX_POLL_TIMEOUT_MS, and if
+   some set has no designated poller (because no thread is polling on its core
+   group) the wait is done on g_root_epfd instead, by one worker at a time.
+   With io_uring the wait is done on the ring (see io_uring_wait_no_eintr()).
+
+   NOTE ON SYNCHRONIZATION: At any point of time, only the designated poller
+   of the set will be calling this function. So there is no need for any
+   synchronization when accesing fields in set */
+static grpc_error* do_epoll_wait(grpc_pollset* ps, epoll_set* set,
+                                 grpc_millis deadline) {
   GPR_TIMER_SCOPE("do_epoll_wait", 0);
 
+  grpc_error* error = GRPC_ERROR_NONE;
   int r;
   int timeout = poll_deadline_to_millis_timeout(deadline);
+  if (g_num_epoll_sets > 1) {
+    if (timeout < 0 || timeout > SHARDED_MAX_POLL_TIMEOUT_MS) {
+      timeout = SHARDED_MAX_POLL_TIMEOUT_MS;
+    }
+    if (any_epoll_set_unattended() &&
+        gpr_atm_no_barrier_cas(&g_root_poller_active, 0, 1)) {
+      grpc_error* error = do_root_epoll_wait(ps, set, timeout);
+      gpr_atm_no_barrier_store(&g_root_poller_active, 0);
+      return error;
+    }
+  }
   if (timeout != 0) {
     GRPC_SCHEDULING_START_BLOCKING_REGION;
   }
-  do {
-    GRPC_STATS_INC_SYSCALL_POLL();
-    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
-                   timeout);
-  } while (r < 0 && errno == EINTR);
+  r = g_use_io_uring ? io_uring_wait_no_eintr(set, timeout, &error)
+                     : epoll_wait_no_eintr(set->epfd, set->events, timeout);
   if (timeout != 0) {
     GRPC_SCHEDULING_END_BLOCKING_REGION;
   }
 
-  if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
+  if (r < 0) {
+    return GRPC_OS_ERROR(errno,
+                         g_use_io_uring ? "io_uring_enter" : "epoll_wait");
+  }
 
   GRPC_STATS_INC_POLL_EVENTS_RETURNED(r);
 
@@ -740,10 +1188,10 @@ static grpc_error* do_epoll_wait(grpc_pollset* ps, grpc_millis deadline) {
     gpr_log(GPR_INFO, "ps: %p poll got %d events", ps, r);
   }
 
-  gpr_atm_rel_store(&g_epoll_set.num_events, r);
-  gpr_atm_rel_store(&g_epoll_set.cursor, 0);
+  gpr_atm_rel_store(&set->num_events, r);
+  gpr_atm_rel_store(&set->cursor, 0);
 
-  return GRPC_ERROR_NONE;
+  return error;
 }
 
 static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
@@ -752,6 +1200,7 @@ static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
   GPR_TIMER_SCOPE("begin_worker", 0);
   if (worker_hdl != nullptr) *worker_hdl = worker;
   worker->initialized_cv = false;
+  worker->set = pollset->neighborhood->set;
   SET_KICK_STATE(worker, UNKICKED);
   worker->schedule_on_end_work = (grpc_closure_list)GRPC_CLOSURE_LIST_INIT;
   pollset->begin_refs++;
@@ -797,13 +1246,15 @@ static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
          at this point is if it were "kicked specifically". Since the worker has
          not added itself to the pollset yet (by calling worker_insert()), it is
          not visible in the "kick any" path yet */
+      worker->set = neighborhood->set;
       if (worker->state == UNKICKED) {
         pollset->seen_inactive = false;
         if (neighborhood->active_root == nullptr) {
           neighborhood->active_root = pollset->next = pollset->prev = pollset;
           /* Make this the designated poller if there isn't one already */
           if (worker->state == UNKICKED &&
-              gpr_atm_no_barrier_cas(&g_active_poller, 0, (gpr_atm)worker)) {
+              gpr_atm_no_barrier_cas(&neighborhood->set->active_poller, 0,
+                                     (gpr_atm)worker)) {
             SET_KICK_STATE(worker, DESIGNATED_POLLER);
           }
         } else {
@@ -823,7 +1274,8 @@ static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
   worker_insert(pollset, worker);
   pollset->begin_refs--;
   if (worker->state == UNKICKED && !pollset->kicked_without_poller) {
-    GPR_ASSERT(gpr_atm_no_barrier_load(&g_active_poller) != (gpr_atm)worker);
+    GPR_ASSERT(gpr_atm_no_barrier_load(&worker->set->active_poller) !=
+               (gpr_atm)worker);
     worker->initialized_cv = true;
     gpr_cv_init(&worker->cv);
     while (worker->state == UNKICKED && !pollset->shutting_down) {
@@ -885,7 +1337,7 @@ static bool check_neighborhood_for_available_poller(
       do {
         switch (inspect_worker->state) {
           case UNKICKED:
-            if (gpr_atm_no_barrier_cas(&g_active_poller, 0,
+            if (gpr_atm_no_barrier_cas(&neighborhood->set->active_poller, 0,
                                        (gpr_atm)inspect_worker)) {
               if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
                 gpr_log(GPR_INFO, " .. choose next poller to be %p",
@@ -944,13 +1396,15 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
   SET_KICK_STATE(worker, KICKED);
   grpc_closure_list_move(&worker->schedule_on_end_work,
                          grpc_core::ExecCtx::Get()->closure_list());
-  if (gpr_atm_no_barrier_load(&g_active_poller) == (gpr_atm)worker) {
+  epoll_set* set = worker->set;
+  if (gpr_atm_no_barrier_load(&set->active_poller) == (gpr_atm)worker) {
     if (worker->next != worker && worker->next->state == UNKICKED) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
         gpr_log(GPR_INFO, " .. choose next poller to be peer %p", worker);
       }
       GPR_ASSERT(worker->next->initialized_cv);
-      gpr_atm_no_barrier_store(&g_active_poller, (gpr_atm)worker->next);
+      GPR_ASSERT(worker->next->set == set);
+      gpr_atm_no_barrier_store(&set->active_poller, (gpr_atm)worker->next);
       SET_KICK_STATE(worker->next, DESIGNATED_POLLER);
       GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
       gpr_cv_signal(&worker->next->cv);
@@ -960,16 +1414,22 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
         gpr_mu_lock(&pollset->mu);
       }
     } else {
-      gpr_atm_no_barrier_store(&g_active_poller, 0);
+      gpr_atm_no_barrier_store(&set->active_poller, 0);
+      /* Look for the next poller among the neighborhoods of this set,
+         starting from the pollset's own one */
       size_t poller_neighborhood_idx =
           static_cast<size_t>(pollset->neighborhood - g_neighborhoods);
+      size_t scan_start =
+          poller_neighborhood_idx >= set->first_neighborhood
+              ? poller_neighborhood_idx - set->first_neighborhood
+              : 0;
       gpr_mu_unlock(&pollset->mu);
       bool found_worker = false;
       bool scan_state[MAX_NEIGHBORHOODS];
-      for (size_t i = 0; !found_worker && i < g_num_neighborhoods; i++) {
+      for (size_t i = 0; !found_worker && i < set->num_neighborhoods; i++) {
         pollset_neighborhood* neighborhood =
-            &g_neighborhoods[(poller_neighborhood_idx + i) %
-                             g_num_neighborhoods];
+            &g_neighborhoods[set->first_neighborhood +
+                             (scan_start + i) % set->num_neighborhoods];
         if (gpr_mu_trylock(&neighborhood->mu)) {
           found_worker = check_neighborhood_for_available_poller(neighborhood);
           gpr_mu_unlock(&neighborhood->mu);
@@ -978,11 +1438,11 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
           scan_state[i] = false;
         }
       }
-      for (size_t i = 0; !found_worker && i < g_num_neighborhoods; i++) {
+      for (size_t i = 0; !found_worker && i < set->num_neighborhoods; i++) {
         if (scan_state[i]) continue;
         pollset_neighborhood* neighborhood =
-            &g_neighborhoods[(poller_neighborhood_idx + i) %
-                             g_num_neighborhoods];
+            &g_neighborhoods[set->first_neighborhood +
+                             (scan_start + i) % set->num_neighborhoods];
         gpr_mu_lock(&neighborhood->mu);
         found_worker = check_neighborhood_for_available_poller(neighborhood);
         gpr_mu_unlock(&neighborhood->mu);
@@ -1004,7 +1464,7 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
   if (EMPTIED == worker_remove(pollset, worker)) {
     pollset_maybe_finish_shutdown(pollset);
   }
-  GPR_ASSERT(gpr_atm_no_barrier_load(&g_active_poller) != (gpr_atm)worker);
+  GPR_ASSERT(gpr_atm_no_barrier_load(&set->active_poller) != (gpr_atm)worker);
 }
 
 /* pollset->po.mu lock must be held by the caller before calling this.
@@ -1044,11 +1504,11 @@ static grpc_error* pollset_work(grpc_pollset* ps,
        accurately grpc_core::ExecCtx::Get()->Flush() happens in end_worker()
        AFTER selecting a designated poller). So we are not waiting long periods
        without a designated poller */
-    if (gpr_atm_acq_load(&g_epoll_set.cursor) ==
-        gpr_atm_acq_load(&g_epoll_set.num_events)) {
-      append_error(&error, do_epoll_wait(ps, deadline), err_desc);
+    epoll_set* set = worker.set;
+    if (gpr_atm_acq_load(&set->cursor) == gpr_atm_acq_load(&set->num_events)) {
+      append_error(&error, do_epoll_wait(ps, set, deadline), err_desc);
     }
-    append_error(&error, process_epoll_events(ps), err_desc);
+    append_error(&error, process_epoll_events(ps, set), err_desc);
 
     gpr_mu_lock(&ps->mu); /* lock */
 
@@ -1116,13 +1576,13 @@ static grpc_error* pollset_kick(grpc_pollset* pollset,
       } else if (root_worker == next_worker &&  // only try and wake up a poller
                                                 // if there is no next worker
                  root_worker == (grpc_pollset_worker*)gpr_atm_no_barrier_load(
-                                    &g_active_poller)) {
+                                    &root_worker->set->active_poller)) {
         GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
         if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
           gpr_log(GPR_INFO, " .. kicked %p", root_worker);
         }
         SET_KICK_STATE(root_worker, KICKED);
-        ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+        ret_err = grpc_wakeup_fd_wakeup(&root_worker->set->wakeup_fd);
         goto done;
       } else if (next_worker->state == UNKICKED) {
         GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
@@ -1154,7 +1614,7 @@ static grpc_error* pollset_kick(grpc_pollset* pollset,
                     root_worker);
           }
           SET_KICK_STATE(next_worker, KICKED);
-          ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+          ret_err = grpc_wakeup_fd_wakeup(&next_worker->set->wakeup_fd);
           goto done;
         }
       } else {
@@ -1188,13 +1648,14 @@ static grpc_error* pollset_kick(grpc_pollset* pollset,
     SET_KICK_STATE(specific_worker, KICKED);
     goto done;
   } else if (specific_worker ==
-             (grpc_pollset_worker*)gpr_atm_no_barrier_load(&g_active_poller)) {
+             (grpc_pollset_worker*)gpr_atm_no_barrier_load(
+                 &specific_worker->set->active_poller)) {
     GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
     if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
       gpr_log(GPR_INFO, " .. kick active poller");
     }
     SET_KICK_STATE(specific_worker, KICKED);
-    ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+    ret_err = grpc_wakeup_fd_wakeup(&specific_worker->set->wakeup_fd);
     goto done;
   } else if (specific_worker->initialized_cv) {
     GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
@@ -1307,7 +1768,7 @@ static const grpc_event_engine_vtable vtable = {
 };
 
 /* Called by the child process's post-fork handler to close open fds, including
- * the global epoll fd. This allows gRPC to shutdown in the child process
+ * the epoll fds. This allows gRPC to shutdown in the child process
  * without interfering with connections or RPCs ongoing in the parent. */
 static void reset_event_manager_on_fork() {
   gpr_mu_lock(&fork_fd_list_mu);
@@ -1318,16 +1779,18 @@ static void reset_event_manager_on_fork() {
   }
   gpr_mu_unlock(&fork_fd_list_mu);
   shutdown_engine();
-  grpc_init_epoll1_linux(true);
+  if (g_use_io_uring) {
+    grpc_init_io_uring_linux(true);
+  } else {
+    grpc_init_epoll1_linux(true);
+  }
 }
 
-/* It is possible that GLIBC has epoll but the underlying kernel doesn't.
- * Create epoll_fd (epoll_set_init() takes care of that) to make sure epoll
- * support is available */
-const grpc_event_engine_vtable* grpc_init_epoll1_linux(
-    bool /*explicit_request*/) {
+static const grpc_event_engine_vtable* init_engine(bool use_io_uring) {
+  g_use_io_uring = use_io_uring;
   if (!grpc_has_wakeup_fd()) {
-    gpr_log(GPR_ERROR, "Skipping epoll1 because of no wakeup fd.");
+    gpr_log(GPR_ERROR, "Skipping %s because of no wakeup fd.",
+            use_io_uring ? "io_uring" : "epoll1");
     return nullptr;
   }
 
@@ -1351,6 +1814,26 @@ const grpc_event_engine_vtable* grpc_init_epoll1_linux(
   return &vtable;
 }
 
+/* It is possible that GLIBC has epoll but the underlying kernel doesn't.
+ * Create epoll_fd (epoll_set_init() takes care of that) to make sure epoll
+ * support is available */
+const grpc_event_engine_vtable* grpc_init_epoll1_linux(
+    bool /*explicit_request*/) {
+  return init_engine(false);
+}
+
+/* The kernel headers may know about io_uring even though the running kernel
+ * does not (or lacks multishot poll); epoll_set_init() probes the running
+ * kernel. The engine is experimental and only used when explicitly requested
+ * through GRPC_POLL_STRATEGY. */
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(
+    bool explicit_request) {
+  if (!explicit_request) {
+    return nullptr;
+  }
+  return init_engine(true);
+}
+
 #else /* defined(GRPC_LINUX_EPOLL) */
 #if defined(GRPC_POSIX_SOCKET_EV_EPOLL1)
 #include "src/core/lib/iomgr/ev_epoll1_linux.h"
@@ -1360,5 +1843,10 @@ const grpc_event_engine_vtable* grpc_init_epoll1_linux(
     bool /*explicit_request*/) {
   return nullptr;
 }
+
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(
+    bool /*explicit_request*/) {
+  return nullptr;
+}
 #endif /* defined(GRPC_POSIX_SOCKET_EV_EPOLL1) */
 #endif /* !defined(GRPC_LINUX_EPOLL) */
@@ -28,4 +28,9 @@
 
 const grpc_event_engine_vtable* grpc_init_epoll1_linux(bool explicit_request);
 
+// the same engine waiting on a singleton io_uring instance (multishot poll
+// requests batched with the wait) instead of its epoll set. Experimental, only
+// used when requested explicitly.
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(bool explicit_request);
+
 #endif /* GRPC_CORE_LIB_IOMGR_EV_EPOLL1_LINUX_H */
@@ -0,0 +1,340 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#include "src/core/lib/iomgr/ev_io_uring_linux.h"
+
+#include <grpc/support/log.h>
+
+#ifdef GRPC_LINUX_IO_URING
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/gpr/useful.h"
+
+#define IO_URING_ENTRIES 4096
+
+/* NOTE ON SYNCHRONIZATION:
+ * - The submission queue may be written by any thread (fd_create, fd_orphan
+ *   and the designated poller re-arming terminated poll requests). Producers
+ *   are serialized by sq_mu.
+ * - The completion queue is only consumed by the thread in
+ *   grpc_io_uring_wait(), i.e. the designated poller.
+ */
+typedef struct io_uring_ring {
+  int ring_fd;
+
+  /* Submission ring (shared with the kernel) */
+  void* sq_ring_ptr;
+  size_t sq_ring_size;
+  unsigned* sq_head;
+  unsigned* sq_tail;
+  unsigned* sq_ring_mask;
+  unsigned* sq_ring_entries;
+  unsigned* sq_array;
+  struct io_uring_sqe* sqes;
+  size_t sqes_size;
+  gpr_mu sq_mu;
+
+  /* Completion ring (shared with the kernel) */
+  void* cq_ring_ptr;
+  size_t cq_ring_size;
+  unsigned* cq_head;
+  unsigned* cq_tail;
+  unsigned* cq_ring_mask;
+  struct io_uring_cqe* cqes;
+} io_uring_ring;
+
+static io_uring_ring g_ring;
+
+static int sys_io_uring_setup(unsigned entries, struct io_uring_params* p) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+}
+
+static int sys_io_uring_enter(int ring_fd, unsigned to_submit,
+                              unsigned min_complete, unsigned flags, void* arg,
+                              size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+static void io_uring_unmap_rings() {
+  if (g_ring.sqes != nullptr && g_ring.sqes != MAP_FAILED) {
+    munmap(g_ring.sqes, g_ring.sqes_size);
+  }
+  if (g_ring.cq_ring_ptr != nullptr && g_ring.cq_ring_ptr != MAP_FAILED &&
+      g_ring.cq_ring_ptr != g_ring.sq_ring_ptr) {
+    munmap(g_ring.cq_ring_ptr, g_ring.cq_ring_size);
+  }
+  if (g_ring.sq_ring_ptr != nullptr && g_ring.sq_ring_ptr != MAP_FAILED) {
+    munmap(g_ring.sq_ring_ptr, g_ring.sq_ring_size);
+  }
+  g_ring.sqes = nullptr;
+  g_ring.cq_ring_ptr = nullptr;
+  g_ring.sq_ring_ptr = nullptr;
+}
+
+bool grpc_io_uring_init() {
+  struct io_uring_params p;
+  memset(&p, 0, sizeof(p));
+  memset(&g_ring, 0, sizeof(g_ring));
+  g_ring.ring_fd = sys_io_uring_setup(IO_URING_ENTRIES, &p);
+  if (g_ring.ring_fd < 0) {
+    gpr_log(GPR_ERROR, "io_uring_setup unavailable: %s", strerror(errno));
+    return false;
+  }
+  /* Timed waits need IORING_ENTER_EXT_ARG (5.11). Multishot poll requests
+     landed in 5.13, the same release that introduced IORING_FEAT_RSRC_TAGS, so
+     that flag is used as the feature probe. */
+  const unsigned required =
+      IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG | IORING_FEAT_RSRC_TAGS;
+  if ((p.features & required) != required) {
+    gpr_log(GPR_ERROR, "io_uring features 0x%x lack required 0x%x", p.features,
+            required);
+    close(g_ring.ring_fd);
+    g_ring.ring_fd = -1;
+    return false;
+  }
+
+  g_ring.sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  g_ring.cq_ring_size =
+      p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    g_ring.sq_ring_size = g_ring.cq_ring_size =
+        GPR_MAX(g_ring.sq_ring_size, g_ring.cq_ring_size);
+  }
+  g_ring.sq_ring_ptr =
+      mmap(nullptr, g_ring.sq_ring_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, g_ring.ring_fd, IORING_OFF_SQ_RING);
+  if (g_ring.sq_ring_ptr == MAP_FAILED) goto fail;
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    g_ring.cq_ring_ptr = g_ring.sq_ring_ptr;
+  } else {
+    g_ring.cq_ring_ptr =
+        mmap(nullptr, g_ring.cq_ring_size, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, g_ring.ring_fd, IORING_OFF_CQ_RING);
+    if (g_ring.cq_ring_ptr == MAP_FAILED) goto fail;
+  }
+  g_ring.sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+  g_ring.sqes = static_cast<struct io_uring_sqe*>(
+      mmap(nullptr, g_ring.sqes_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, g_ring.ring_fd, IORING_OFF_SQES));
+  if (g_ring.sqes == MAP_FAILED) goto fail;
+
+  {
+    char* sq = static_cast<char*>(g_ring.sq_ring_ptr);
+    g_ring.sq_head = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+    g_ring.sq_tail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+    g_ring.sq_ring_mask = reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+    g_ring.sq_ring_entries =
+        reinterpret_cast<unsigned*>(sq + p.sq_off.ring_entries);
+    g_ring.sq_array = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+    char* cq = static_cast<char*>(g_ring.cq_ring_ptr);
+    g_ring.cq_head = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+    g_ring.cq_tail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+    g_ring.cq_ring_mask = reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+    g_ring.cqes = reinterpret_cast<struct io_uring_cqe*>(cq + p.cq_off.cqes);
+  }
+
+  gpr_mu_init(&g_ring.sq_mu);
+  gpr_log(GPR_INFO, "grpc io_uring fd: %d", g_ring.ring_fd);
+  return true;
+
+fail:
+  gpr_log(GPR_ERROR, "io_uring mmap failed: %s", strerror(errno));
+  io_uring_unmap_rings();
+  close(g_ring.ring_fd);
+  g_ring.ring_fd = -1;
+  return false;
+}
+
+void grpc_io_uring_shutdown() {
+  if (g_ring.ring_fd >= 0) {
+    io_uring_unmap_rings();
+    close(g_ring.ring_fd);
+    g_ring.ring_fd = -1;
+    gpr_mu_destroy(&g_ring.sq_mu);
+  }
+}
+
+/* Number of SQEs published to the ring but not yet consumed by the kernel */
+static unsigned io_uring_sq_pending() {
+  return __atomic_load_n(g_ring.sq_tail, __ATOMIC_ACQUIRE) -
+         __atomic_load_n(g_ring.sq_head, __ATOMIC_ACQUIRE);
+}
+
+/* Hands every published SQE to the kernel without waiting for completions.
+   g_ring.sq_mu must be held. */
+static grpc_error* io_uring_submit_locked() {
+  unsigned pending;
+  while ((pending = io_uring_sq_pending()) > 0) {
+    int r = sys_io_uring_enter(g_ring.ring_fd, pending, 0, 0, nullptr, 0);
+    if (r < 0) {
+      if (errno == EINTR) continue;
+      return GRPC_OS_ERROR(errno, "io_uring_enter");
+    }
+  }
+  return GRPC_ERROR_NONE;
+}
+
+/* Claims the next free SQE, flushing the ring to the kernel if it is full.
+   g_ring.sq_mu must be held. Returns nullptr if no entry could be freed. */
+static struct io_uring_sqe* io_uring_get_sqe_locked() {
+  unsigned tail = *g_ring.sq_tail;
+  if (tail - __atomic_load_n(g_ring.sq_head, __ATOMIC_ACQUIRE) >=
+      *g_ring.sq_ring_entries) {
+    GRPC_LOG_IF_ERROR("io_uring_get_sqe", io_uring_submit_locked());
+    if (tail - __atomic_load_n(g_ring.sq_head, __ATOMIC_ACQUIRE) >=
+        *g_ring.sq_ring_entries) {
+      return nullptr;
+    }
+  }
+  unsigned idx = tail & *g_ring.sq_ring_mask;
+  struct io_uring_sqe* sqe = &g_ring.sqes[idx];
+  memset(sqe, 0, sizeof(*sqe));
+  g_ring.sq_array[idx] = idx;
+  return sqe;
+}
+
+/* Makes the SQE returned by the last io_uring_get_sqe_locked() call visible to
+   the kernel. g_ring.sq_mu must be held. */
+static void io_uring_publish_sqe_locked() {
+  __atomic_store_n(g_ring.sq_tail, *g_ring.sq_tail + 1, __ATOMIC_RELEASE);
+}
+
+static uint32_t io_uring_poll_mask(uint32_t events) {
+#if __BYTE_ORDER == __BIG_ENDIAN
+  /* poll32_events is word-reversed on big endian machines */
+  events = (events << 16) | (events >> 16);
+#endif
+  return events;
+}
+
+grpc_error* grpc_io_uring_poll_add(int fd, uint32_t events, uint64_t user_data,
+                                   bool submit_now) {
+  GPR_DEBUG_ASSERT(user_data != 0);
+  grpc_error* error = GRPC_ERROR_NONE;
+  gpr_mu_lock(&g_ring.sq_mu);
+  struct io_uring_sqe* sqe = io_uring_get_sqe_locked();
+  if (sqe == nullptr) {
+    error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("io_uring submission full");
+  } else {
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = io_uring_poll_mask(events);
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->user_data = user_data;
+    io_uring_publish_sqe_locked();
+    if (submit_now) error = io_uring_submit_locked();
+  }
+  gpr_mu_unlock(&g_ring.sq_mu);
+  return error;
+}
+
+grpc_error* grpc_io_uring_poll_remove(uint64_t user_data) {
+  grpc_error* error = GRPC_ERROR_NONE;
+  gpr_mu_lock(&g_ring.sq_mu);
+  struct io_uring_sqe* sqe = io_uring_get_sqe_locked();
+  if (sqe == nullptr) {
+    error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("io_uring submission full");
+  } else {
+    /* The removal's own completion carries user_data 0 and is dropped by
+       grpc_io_uring_wait() */
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = user_data;
+    io_uring_publish_sqe_locked();
+    error = io_uring_submit_locked();
+  }
+  gpr_mu_unlock(&g_ring.sq_mu);
+  return error;
+}
+
+int grpc_io_uring_wait(grpc_io_uring_completion* completions,
+                       int max_completions, int timeout) {
+  unsigned head = *g_ring.cq_head;
+  if (head == __atomic_load_n(g_ring.cq_tail, __ATOMIC_ACQUIRE) ||
+      io_uring_sq_pending() > 0) {
+    struct __kernel_timespec ts;
+    struct io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    if (timeout >= 0) {
+      ts.tv_sec = timeout / GPR_MS_PER_SEC;
+      ts.tv_nsec = static_cast<long long>(timeout % GPR_MS_PER_SEC) *
+                   GPR_NS_PER_MS;
+      arg.ts = reinterpret_cast<uint64_t>(&ts);
+    }
+    int r;
+    do {
+      GRPC_STATS_INC_SYSCALL_POLL();
+      r = sys_io_uring_enter(g_ring.ring_fd, io_uring_sq_pending(),
+                             timeout == 0 ? 0 : 1,
+                             IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                             &arg, sizeof(arg));
+    } while (r < 0 && errno == EINTR);
+    if (r < 0 && errno != ETIME) return -1;
+  }
+
+  unsigned tail = __atomic_load_n(g_ring.cq_tail, __ATOMIC_ACQUIRE);
+  int n = 0;
+  for (; head != tail && n < max_completions; head++) {
+    const struct io_uring_cqe* cqe = &g_ring.cqes[head & *g_ring.cq_ring_mask];
+    if (cqe->user_data == 0) continue;
+    completions[n].user_data = cqe->user_data;
+    completions[n].res = cqe->res;
+    completions[n].more = (cqe->flags & IORING_CQE_F_MORE) != 0;
+    n++;
+  }
+  __atomic_store_n(g_ring.cq_head, head, __ATOMIC_RELEASE);
+  return n;
+}
+
+#else /* defined(GRPC_LINUX_IO_URING) */
+
+bool grpc_io_uring_init() {
+  gpr_log(GPR_ERROR, "io_uring unavailable: built against pre-5.13 headers");
+  return false;
+}
+
+void grpc_io_uring_shutdown() {}
+
+grpc_error* grpc_io_uring_poll_add(int /*fd*/, uint32_t /*events*/,
+                                   uint64_t /*user_data*/,
+                                   bool /*submit_now*/) {
+  GPR_UNREACHABLE_CODE(return GRPC_ERROR_NONE);
+}
+
+grpc_error* grpc_io_uring_poll_remove(uint64_t /*user_data*/) {
+  GPR_UNREACHABLE_CODE(return GRPC_ERROR_NONE);
+}
+
+int grpc_io_uring_wait(grpc_io_uring_completion* /*completions*/,
+                       int /*max_completions*/, int /*timeout*/) {
+  GPR_UNREACHABLE_CODE(return -1);
+}
+
+#endif /* !defined(GRPC_LINUX_IO_URING) */
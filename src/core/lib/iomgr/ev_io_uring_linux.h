@@ -0,0 +1,66 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_IOMGR_EV_IO_URING_LINUX_H
+#define GRPC_CORE_LIB_IOMGR_EV_IO_URING_LINUX_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/port.h"
+
+// a singleton io_uring instance carrying multishot poll requests. The epoll1
+// engine waits on it instead of its epoll set when GRPC_POLL_STRATEGY is
+// io_uring; fds are still read and written with regular syscalls.
+
+typedef struct grpc_io_uring_completion {
+  uint64_t user_data;
+  /* The poll events, or a negative errno */
+  int32_t res;
+  /* False if the kernel terminated the request with this completion */
+  bool more;
+} grpc_io_uring_completion;
+
+/* Sets up the ring. Returns false if the running kernel can't provide it
+   (multishot poll requests need Linux 5.13). Must be called *only* once. */
+bool grpc_io_uring_init();
+
+void grpc_io_uring_shutdown();
+
+/* Queues a multishot poll request for fd. Completions carry user_data, which
+   must not be 0. Unless submit_now is set, the request is handed to the kernel
+   together with the next grpc_io_uring_wait(). */
+grpc_error* grpc_io_uring_poll_add(int fd, uint32_t events, uint64_t user_data,
+                                   bool submit_now);
+
+/* Cancels the poll request registered with user_data. The request holds a
+   reference on the file, so this has to reach the kernel before the fd is
+   closed or handed back to its owner. */
+grpc_error* grpc_io_uring_poll_remove(uint64_t user_data);
+
+/* Submits the queued requests and waits up to timeout milliseconds (forever
+   if negative) for completions, copying at most max_completions of them.
+   Completions already in the ring are reaped without entering the kernel.
+   Returns the number copied, or -1 with errno set. Only one thread may wait
+   at a time. */
+int grpc_io_uring_wait(grpc_io_uring_completion* completions,
+                       int max_completions, int timeout);
+
+#endif /* GRPC_CORE_LIB_IOMGR_EV_IO_URING_LINUX_H */
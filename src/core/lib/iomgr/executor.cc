@@ -149,16 +149,14 @@ void Executor::SetThreading(bool threading) {
 
     GPR_ASSERT(num_threads_ == 0);
     gpr_atm_rel_store(&num_threads_, 1);
-    thd_state_ = static_cast<ThreadState*>(
-        gpr_zalloc(sizeof(ThreadState) * max_threads_));
+    thd_state_ = new ThreadState[max_threads_]();
 
     for (size_t i = 0; i < max_threads_; i++) {
       gpr_mu_init(&thd_state_[i].mu);
       gpr_cv_init(&thd_state_[i].cv);
       thd_state_[i].id = i;
       thd_state_[i].name = name_;
-      thd_state_[i].thd = grpc_core::Thread();
-      thd_state_[i].elems = GRPC_CLOSURE_LIST_INIT;
+      thd_state_[i].executor = this;
     }
 
     thd_state_[0].thd =
@@ -172,7 +170,7 @@ void Executor::SetThreading(bool threading) {
 
     for (size_t i = 0; i < max_threads_; i++) {
       gpr_mu_lock(&thd_state_[i].mu);
-      thd_state_[i].shutdown = true;
+      thd_state_[i].shutdown.Store(true, MemoryOrder::RELAXED);
       gpr_cv_signal(&thd_state_[i].cv);
       gpr_mu_unlock(&thd_state_[i].mu);
     }
@@ -191,12 +189,25 @@ void Executor::SetThreading(bool threading) {
 
     gpr_atm_rel_store(&num_threads_, 0);
     for (size_t i = 0; i < max_threads_; i++) {
-      gpr_mu_destroy(&thd_state_[i].mu);
-      gpr_cv_destroy(&thd_state_[i].cv);
-      RunClosures(thd_state_[i].name, thd_state_[i].elems);
+      ThreadState* ts = &thd_state_[i];
+      gpr_mu_destroy(&ts->mu);
+      gpr_cv_destroy(&ts->cv);
+      // All threads are joined: drain whatever is still queued from here.
+      grpc_closure_list closures = GRPC_CLOSURE_LIST_INIT;
+      grpc_closure* c;
+      while ((c = ts->local.Pop()) != nullptr) {
+        grpc_closure_list_append(&closures, c, c->error_data.error);
+      }
+      while ((c = reinterpret_cast<grpc_closure*>(ts->inbox.Pop())) !=
+             nullptr) {
+        grpc_closure_list_append(&closures, c, c->error_data.error);
+      }
+      RunClosures(ts->name, closures);
     }
+    num_pending_.Store(0, MemoryOrder::RELAXED);
+    num_sleeping_.Store(0, MemoryOrder::RELAXED);
 
-    gpr_free(thd_state_);
+    delete[] thd_state_;
 
     // grpc_iomgr_shutdown_background_closure() will close all the registered
     // fds in the background poller, and wait for all pending closures to
@@ -214,169 +225,211 @@ void Executor::Shutdown() { SetThreading(false); }
 
 void Executor::ThreadMain(void* arg) {
   ThreadState* ts = static_cast<ThreadState*>(arg);
+  Executor* executor = ts->executor;
   gpr_tls_set(&g_this_thread_state, reinterpret_cast<intptr_t>(ts));
 
   grpc_core::ExecCtx exec_ctx(GRPC_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
 
-  size_t subtract_depth = 0;
   for (;;) {
-    EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: step (sub_depth=%" PRIdPTR ")",
-                   ts->name, ts->id, subtract_depth);
+    EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: execute", ts->name, ts->id);
+
+    grpc_core::ExecCtx::Get()->InvalidateNow();
+    if (executor->RunQueued(ts) > 0) {
+      GRPC_STATS_INC_EXECUTOR_QUEUE_DRAINED();
+    }
 
     gpr_mu_lock(&ts->mu);
-    ts->depth -= subtract_depth;
-    // Wait for closures to be enqueued or for the executor to be shutdown
-    while (grpc_closure_list_empty(ts->elems) && !ts->shutdown) {
-      ts->queued_long_job = false;
-      gpr_cv_wait(&ts->cv, &ts->mu, gpr_inf_future(GPR_CLOCK_MONOTONIC));
+    if (!ts->shutdown.Load(MemoryOrder::RELAXED)) {
+      // Announce that we are going to sleep before the final check for
+      // pending work: an Enqueue() racing with us either sees num_sleeping_
+      // and wakes us up, or its closure is visible in num_pending_ here.
+      ts->sleeping.Store(true, MemoryOrder::RELAXED);
+      executor->num_sleeping_.FetchAdd(1, MemoryOrder::SEQ_CST);
+      if (executor->num_pending_.Load(MemoryOrder::SEQ_CST) == 0) {
+        while (ts->sleeping.Load(MemoryOrder::RELAXED) &&
+               !ts->shutdown.Load(MemoryOrder::RELAXED)) {
+          gpr_cv_wait(&ts->cv, &ts->mu, gpr_inf_future(GPR_CLOCK_MONOTONIC));
+        }
+      }
+      if (ts->sleeping.Load(MemoryOrder::RELAXED)) {
+        ts->sleeping.Store(false, MemoryOrder::RELAXED);
+        executor->num_sleeping_.FetchSub(1, MemoryOrder::SEQ_CST);
+      }
     }
+    bool shutdown = ts->shutdown.Load(MemoryOrder::RELAXED);
+    gpr_mu_unlock(&ts->mu);
 
-    if (ts->shutdown) {
+    if (shutdown) {
       EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: shutdown", ts->name, ts->id);
-      gpr_mu_unlock(&ts->mu);
       break;
     }
+  }
 
-    GRPC_STATS_INC_EXECUTOR_QUEUE_DRAINED();
-    grpc_closure_list closures = ts->elems;
-    ts->elems = GRPC_CLOSURE_LIST_INIT;
-    gpr_mu_unlock(&ts->mu);
+  gpr_tls_set(&g_this_thread_state, reinterpret_cast<intptr_t>(nullptr));
+}
 
-    EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: execute", ts->name, ts->id);
+size_t Executor::RunQueued(ThreadState* ts) {
+  size_t n = 0;
+  while (!ts->shutdown.Load(MemoryOrder::RELAXED)) {
+    grpc_closure* c = PopLocal(ts);
+    if (c == nullptr) {
+      c = Steal(ts);
+      if (c == nullptr) break;
+    }
+    // See RunClosures() for why there is no new ExecCtx here.
+    grpc_core::ApplicationCallbackExecCtx callback_exec_ctx(
+        GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
+    grpc_error* error = c->error_data.error;
+#ifndef NDEBUG
+    EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: run %p [created by %s:%d]", ts->name,
+                   ts->id, c, c->file_created, c->line_created);
+    c->scheduled = false;
+#else
+    EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: run %p", ts->name, ts->id, c);
+#endif
+    c->cb(c->cb_arg, error);
+    GRPC_ERROR_UNREF(error);
+    n++;
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  return n;
+}
 
-    grpc_core::ExecCtx::Get()->InvalidateNow();
-    subtract_depth = RunClosures(ts->name, closures);
+grpc_closure* Executor::PopLocal(ThreadState* ts) {
+  grpc_closure* c = ts->local.Pop();
+  if (c == nullptr) {
+    c = reinterpret_cast<grpc_closure*>(ts->inbox.TryPop());
+    if (c == nullptr) return nullptr;
   }
+  ts->depth.FetchSub(1, MemoryOrder::RELAXED);
+  num_pending_.FetchSub(1, MemoryOrder::RELAXED);
+  return c;
+}
 
-  gpr_tls_set(&g_this_thread_state, reinterpret_cast<intptr_t>(nullptr));
+grpc_closure* Executor::Steal(ThreadState* ts) {
+  size_t num_threads = static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
+  for (size_t i = 1; i < num_threads; i++) {
+    ThreadState* victim = &thd_state_[(ts->id + i) % num_threads];
+    if (victim->depth.Load(MemoryOrder::RELAXED) == 0) continue;
+    grpc_closure* c = victim->local.Steal();
+    if (c == nullptr) {
+      c = reinterpret_cast<grpc_closure*>(victim->inbox.TryPop());
+      if (c == nullptr) continue;
+    }
+    victim->depth.FetchSub(1, MemoryOrder::RELAXED);
+    num_pending_.FetchSub(1, MemoryOrder::RELAXED);
+    GRPC_STATS_INC_EXECUTOR_CLOSURES_STOLEN();
+    EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: stole %p from thread %" PRIdPTR,
+                   ts->name, ts->id, c, victim->id);
+    return c;
+  }
+  return nullptr;
+}
+
+void Executor::WakeOne(ThreadState* ts) {
+  size_t num_threads = static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
+  for (size_t i = 0; i < num_threads; i++) {
+    ThreadState* candidate = &thd_state_[(ts->id + i) % num_threads];
+    if (!candidate->sleeping.Load(MemoryOrder::RELAXED)) continue;
+    gpr_mu_lock(&candidate->mu);
+    bool woken = candidate->sleeping.Load(MemoryOrder::RELAXED);
+    if (woken) {
+      candidate->sleeping.Store(false, MemoryOrder::RELAXED);
+      num_sleeping_.FetchSub(1, MemoryOrder::SEQ_CST);
+      GRPC_STATS_INC_EXECUTOR_WAKEUP_INITIATED();
+      gpr_cv_signal(&candidate->cv);
+    }
+    gpr_mu_unlock(&candidate->mu);
+    if (woken) return;
+  }
 }
 
 void Executor::Enqueue(grpc_closure* closure, grpc_error* error,
                        bool is_short) {
-  bool retry_push;
   if (is_short) {
     GRPC_STATS_INC_EXECUTOR_SCHEDULED_SHORT_ITEMS();
   } else {
     GRPC_STATS_INC_EXECUTOR_SCHEDULED_LONG_ITEMS();
   }
 
-  do {
-    retry_push = false;
-    size_t cur_thread_count =
-        static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
+  size_t cur_thread_count =
+      static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
 
-    // If the number of threads is zero(i.e either the executor is not threaded
-    // or already shutdown), then queue the closure on the exec context itself
-    if (cur_thread_count == 0) {
+  // If the number of threads is zero(i.e either the executor is not threaded
+  // or already shutdown), then queue the closure on the exec context itself
+  if (cur_thread_count == 0) {
 #ifndef NDEBUG
-      EXECUTOR_TRACE("(%s) schedule %p (created %s:%d) inline", name_, closure,
-                     closure->file_created, closure->line_created);
+    EXECUTOR_TRACE("(%s) schedule %p (created %s:%d) inline", name_, closure,
+                   closure->file_created, closure->line_created);
 #else
-      EXECUTOR_TRACE("(%s) schedule %p inline", name_, closure);
+    EXECUTOR_TRACE("(%s) schedule %p inline", name_, closure);
 #endif
-      grpc_closure_list_append(grpc_core::ExecCtx::Get()->closure_list(),
-                               closure, error);
-      return;
-    }
-
-    if (grpc_iomgr_add_closure_to_background_poller(closure, error)) {
-      return;
-    }
+    grpc_closure_list_append(grpc_core::ExecCtx::Get()->closure_list(),
+                             closure, error);
+    return;
+  }
 
-    ThreadState* ts = (ThreadState*)gpr_tls_get(&g_this_thread_state);
-    if (ts == nullptr) {
-      ts = &thd_state_[GPR_HASH_POINTER(grpc_core::ExecCtx::Get(),
-                                        cur_thread_count)];
-    } else {
-      GRPC_STATS_INC_EXECUTOR_SCHEDULED_TO_SELF();
-    }
+  if (grpc_iomgr_add_closure_to_background_poller(closure, error)) {
+    return;
+  }
 
-    ThreadState* orig_ts = ts;
-    bool try_new_thread = false;
+  closure->error_data.error = error;
+  // Executor threads queue their own closures on their work stealing deque,
+  // everybody else picks a thread by hashing and uses its inbox. Either way
+  // idle threads will steal the closure if the chosen thread is busy (e.g.
+  // running a long job).
+  ThreadState* ts = (ThreadState*)gpr_tls_get(&g_this_thread_state);
+  bool pushed = false;
+  if (ts != nullptr && ts->executor == this) {
+    GRPC_STATS_INC_EXECUTOR_SCHEDULED_TO_SELF();
+    pushed = ts->local.Push(closure);
+  } else {
+    ts = &thd_state_[GPR_HASH_POINTER(grpc_core::ExecCtx::Get(),
+                                      cur_thread_count)];
+  }
+  if (!pushed) {
+    ts->inbox.Push(closure->next_data.mpscq_node.get());
+  }
 
-    for (;;) {
 #ifndef NDEBUG
-      EXECUTOR_TRACE(
-          "(%s) try to schedule %p (%s) (created %s:%d) to thread "
-          "%" PRIdPTR,
-          name_, closure, is_short ? "short" : "long", closure->file_created,
-          closure->line_created, ts->id);
+  EXECUTOR_TRACE(
+      "(%s) scheduled %p (%s) (created %s:%d) to thread %" PRIdPTR, name_,
+      closure, is_short ? "short" : "long", closure->file_created,
+      closure->line_created, ts->id);
 #else
-      EXECUTOR_TRACE("(%s) try to schedule %p (%s) to thread %" PRIdPTR, name_,
-                     closure, is_short ? "short" : "long", ts->id);
+  EXECUTOR_TRACE("(%s) scheduled %p (%s) to thread %" PRIdPTR, name_, closure,
+                 is_short ? "short" : "long", ts->id);
 #endif
 
-      gpr_mu_lock(&ts->mu);
-      if (ts->queued_long_job) {
-        // if there's a long job queued, we never queue anything else to this
-        // queue (since long jobs can take 'infinite' time and we need to
-        // guarantee no starvation). Spin through queues and try again
-        gpr_mu_unlock(&ts->mu);
-        size_t idx = ts->id;
-        ts = &thd_state_[(idx + 1) % cur_thread_count];
-        if (ts == orig_ts) {
-          // We cycled through all the threads. Retry enqueue again by creating
-          // a new thread
-          //
-          // TODO (sreek): There is a potential issue here. We are
-          // unconditionally setting try_new_thread to true here. What if the
-          // executor is shutdown OR if cur_thread_count is already equal to
-          // max_threads ?
-          // (Fortunately, this is not an issue yet (as of july 2018) because
-          // there is only one instance of long job in gRPC and hence we will
-          // not hit this code path)
-          retry_push = true;
-          try_new_thread = true;
-          break;
-        }
-
-        continue;  // Try the next thread-state
-      }
-
-      // == Found the thread state (i.e thread) to enqueue this closure! ==
-
-      // Also, if this thread has been waiting for closures, wake it up.
-      // - If grpc_closure_list_empty() is true and the Executor is not
-      //   shutdown, it means that the thread must be waiting in ThreadMain()
-      // - Note that gpr_cv_signal() won't immediately wakeup the thread. That
-      //   happens after we release the mutex &ts->mu a few lines below
-      if (grpc_closure_list_empty(ts->elems) && !ts->shutdown) {
-        GRPC_STATS_INC_EXECUTOR_WAKEUP_INITIATED();
-        gpr_cv_signal(&ts->cv);
-      }
+  size_t depth = ts->depth.FetchAdd(1, MemoryOrder::RELAXED) + 1;
+  num_pending_.FetchAdd(1, MemoryOrder::SEQ_CST);
 
-      grpc_closure_list_append(&ts->elems, closure, error);
-
-      // If we already queued more than MAX_DEPTH number of closures on this
-      // thread, use this as a hint to create more threads
-      ts->depth++;
-      try_new_thread = ts->depth > MAX_DEPTH &&
-                       cur_thread_count < max_threads_ && !ts->shutdown;
-
-      ts->queued_long_job = !is_short;
-
-      gpr_mu_unlock(&ts->mu);
-      break;
-    }
-
-    if (try_new_thread && gpr_spinlock_trylock(&adding_thread_lock_)) {
-      cur_thread_count = static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
-      if (cur_thread_count < max_threads_) {
-        // Increment num_threads (safe to do a store instead of a cas because we
-        // always increment num_threads under the 'adding_thread_lock')
-        gpr_atm_rel_store(&num_threads_, cur_thread_count + 1);
+  // Wake up an idle thread if there is one, so that it picks up the closure
+  // (stealing it if needed). Otherwise, if this thread is backed up or is
+  // about to be tied up by a long job, use that as a hint to create more
+  // threads.
+  bool try_new_thread = false;
+  if (num_sleeping_.Load(MemoryOrder::SEQ_CST) > 0) {
+    WakeOne(ts);
+  } else {
+    try_new_thread = (depth > MAX_DEPTH || !is_short) &&
+                     cur_thread_count < max_threads_ &&
+                     !ts->shutdown.Load(MemoryOrder::RELAXED);
+  }
 
-        thd_state_[cur_thread_count].thd = grpc_core::Thread(
-            name_, &Executor::ThreadMain, &thd_state_[cur_thread_count]);
-        thd_state_[cur_thread_count].thd.Start();
-      }
-      gpr_spinlock_unlock(&adding_thread_lock_);
-    }
+  if (try_new_thread && gpr_spinlock_trylock(&adding_thread_lock_)) {
+    cur_thread_count = static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
+    if (cur_thread_count < max_threads_) {
+      // Increment num_threads (safe to do a store instead of a cas because we
+      // always increment num_threads under the 'adding_thread_lock')
+      gpr_atm_rel_store(&num_threads_, cur_thread_count + 1);
 
-    if (retry_push) {
-      GRPC_STATS_INC_EXECUTOR_PUSH_RETRIES();
+      thd_state_[cur_thread_count].thd = grpc_core::Thread(
+          name_, &Executor::ThreadMain, &thd_state_[cur_thread_count]);
+      thd_state_[cur_thread_count].thd.Start();
     }
-  } while (retry_push);
+    gpr_spinlock_unlock(&adding_thread_lock_);
+  }
 }
 
 // Executor::InitAll() and Executor::ShutdownAll() functions are called in the
@@ -22,20 +22,30 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/gpr/spinlock.h"
+#include "src/core/lib/gprpp/atomic.h"
+#include "src/core/lib/gprpp/mpscq.h"
 #include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/gprpp/work_stealing_deque.h"
 #include "src/core/lib/iomgr/closure.h"
 
 namespace grpc_core {
 
+class Executor;
+
 struct ThreadState {
   gpr_mu mu;
   size_t id;         // For debugging purposes
   const char* name;  // Thread state name
+  Executor* executor;
   gpr_cv cv;
-  grpc_closure_list elems;
-  size_t depth;  // Number of closures in the closure list
-  bool shutdown;
-  bool queued_long_job;
+  // Closures the thread enqueued for itself. Only the owning thread pushes
+  // and pops; idle threads steal from the other end.
+  WorkStealingDeque<grpc_closure> local;
+  // Closures enqueued by threads outside of this executor.
+  LockedMultiProducerSingleConsumerQueue inbox;
+  Atomic<size_t> depth;  // Number of closures queued on local and inbox
+  Atomic<bool> shutdown;
+  Atomic<bool> sleeping;  // Only written with mu held
   grpc_core::Thread thd;
 };
 
@@ -107,11 +117,25 @@ class Executor {
   static size_t RunClosures(const char* executor_name, grpc_closure_list list);
   static void ThreadMain(void* arg);
 
+  // Runs closures queued on ts or stolen from other threads until there are
+  // none left or ts is shut down. Returns the number of closures run.
+  size_t RunQueued(ThreadState* ts);
+  // Pops a closure queued on ts itself. Must be called by ts's thread.
+  grpc_closure* PopLocal(ThreadState* ts);
+  // Takes a closure queued on another thread than ts.
+  grpc_closure* Steal(ThreadState* ts);
+  // Wakes up a sleeping thread, preferring ts.
+  void WakeOne(ThreadState* ts);
+
   const char* name_;
   ThreadState* thd_state_;
   size_t max_threads_;
   gpr_atm num_threads_;
   gpr_spinlock adding_thread_lock_;
+  // Closures queued across all threads
+  Atomic<size_t> num_pending_{0};
+  // Threads waiting for work
+  Atomic<size_t> num_sleeping_{0};
 };
 
 // Global initializer for executor
@@ -20,6 +20,8 @@
 
 #include "src/core/lib/iomgr/executor/mpmcqueue.h"
 
+#include <atomic>
+
 namespace grpc_core {
 
 DebugOnlyTraceFlag grpc_thread_pool_trace(false, "thread_pool");
@@ -180,4 +182,143 @@ void InfLenFIFOQueue::RemoveWaiter(Waiter* waiter) {
 
 InfLenFIFOQueue::Waiter* InfLenFIFOQueue::TopWaiter() { return waiters_.next; }
 
+LockFreeBoundedQueue::LockFreeBoundedQueue(size_t capacity)
+    : mask_([capacity] {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        return size - 1;
+      }()) {
+  cells_ = new Cell[mask_ + 1];
+  for (size_t i = 0; i <= mask_; ++i) {
+    cells_[i].sequence.Store(i, MemoryOrder::RELAXED);
+    cells_[i].content = nullptr;
+  }
+}
+
+LockFreeBoundedQueue::~LockFreeBoundedQueue() {
+  GPR_ASSERT(count() == 0);
+  GPR_ASSERT(num_get_waiters_.Load(MemoryOrder::RELAXED) == 0);
+  GPR_ASSERT(num_put_waiters_.Load(MemoryOrder::RELAXED) == 0);
+  delete[] cells_;
+}
+
+int LockFreeBoundedQueue::count() const {
+  size_t head = dequeue_pos_.Load(MemoryOrder::RELAXED);
+  size_t tail = enqueue_pos_.Load(MemoryOrder::RELAXED);
+  intptr_t size = static_cast<intptr_t>(tail - head);
+  if (size < 0) return 0;
+  if (size > static_cast<intptr_t>(capacity())) {
+    return static_cast<int>(capacity());
+  }
+  return static_cast<int>(size);
+}
+
+bool LockFreeBoundedQueue::TryPut(void* elem) {
+  Cell* cell;
+  size_t pos = enqueue_pos_.Load(MemoryOrder::RELAXED);
+  while (true) {
+    cell = &cells_[pos & mask_];
+    size_t seq = cell->sequence.Load(MemoryOrder::ACQUIRE);
+    intptr_t diff = static_cast<intptr_t>(seq - pos);
+    if (diff == 0) {
+      // The cell is free for this round, claim it.
+      if (enqueue_pos_.CompareExchangeWeak(&pos, pos + 1, MemoryOrder::RELAXED,
+                                           MemoryOrder::RELAXED)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // The cell still holds the element from the previous round: full.
+      return false;
+    } else {
+      // Another producer claimed the cell, retry with the new tail.
+      pos = enqueue_pos_.Load(MemoryOrder::RELAXED);
+    }
+  }
+  cell->content = elem;
+  cell->sequence.Store(pos + 1, MemoryOrder::RELEASE);
+  return true;
+}
+
+bool LockFreeBoundedQueue::TryGet(void** elem) {
+  Cell* cell;
+  size_t pos = dequeue_pos_.Load(MemoryOrder::RELAXED);
+  while (true) {
+    cell = &cells_[pos & mask_];
+    size_t seq = cell->sequence.Load(MemoryOrder::ACQUIRE);
+    intptr_t diff = static_cast<intptr_t>(seq - (pos + 1));
+    if (diff == 0) {
+      if (dequeue_pos_.CompareExchangeWeak(&pos, pos + 1, MemoryOrder::RELAXED,
+                                           MemoryOrder::RELAXED)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // The cell has not been filled yet: empty.
+      return false;
+    } else {
+      pos = dequeue_pos_.Load(MemoryOrder::RELAXED);
+    }
+  }
+  *elem = cell->content;
+  // Hand the cell over to the producer of the next round.
+  cell->sequence.Store(pos + mask_ + 1, MemoryOrder::RELEASE);
+  return true;
+}
+
+void LockFreeBoundedQueue::WakeOne(Atomic<int>* num_waiters, CondVar* cv) {
+  // Pairs with the fence after a waiter registers itself: either the waiter
+  // sees the cell we just published or we see the waiter.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (num_waiters->Load(MemoryOrder::RELAXED) > 0) {
+    MutexLock l(&mu_);
+    cv->Signal();
+  }
+}
+
+void LockFreeBoundedQueue::Put(void* elem) {
+  bool done = false;
+  for (int i = 0; i < kSpinCount && !done; ++i) {
+    done = TryPut(elem);
+  }
+  if (!done) {
+    MutexLock l(&mu_);
+    num_put_waiters_.FetchAdd(1, MemoryOrder::RELAXED);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!TryPut(elem)) {
+      not_full_.Wait(&mu_);
+    }
+    num_put_waiters_.FetchSub(1, MemoryOrder::RELAXED);
+  }
+  WakeOne(&num_get_waiters_, &not_empty_);
+}
+
+void* LockFreeBoundedQueue::Get(gpr_timespec* wait_time) {
+  void* elem = nullptr;
+  bool done = false;
+  for (int i = 0; i < kSpinCount && !done; ++i) {
+    done = TryGet(&elem);
+  }
+  if (!done) {
+    gpr_timespec start_time;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_thread_pool_trace) &&
+        wait_time != nullptr) {
+      start_time = gpr_now(GPR_CLOCK_MONOTONIC);
+    }
+    {
+      MutexLock l(&mu_);
+      num_get_waiters_.FetchAdd(1, MemoryOrder::RELAXED);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      while (!TryGet(&elem)) {
+        not_empty_.Wait(&mu_);
+      }
+      num_get_waiters_.FetchSub(1, MemoryOrder::RELAXED);
+    }
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_thread_pool_trace) &&
+        wait_time != nullptr) {
+      *wait_time = gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start_time);
+    }
+  }
+  WakeOne(&num_put_waiters_, &not_full_);
+  return elem;
+}
+
 }  // namespace grpc_core
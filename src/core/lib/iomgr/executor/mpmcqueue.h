@@ -170,6 +170,80 @@ class InfLenFIFOQueue : public MPMCQueueInterface {
   Node* AllocateNodes(int num);
 };
 
+// A bounded, lock free MPMC queue. Elements live in a fixed size ring buffer
+// of cells, each carrying a sequence number that tells producers and consumers
+// whether the cell is ready for them (D. Vyukov's bounded MPMC queue), so Put
+// and Get only contend on a single CAS of the head or tail index. Threads that
+// find the queue empty (Get) or full (Put) spin for a short while and then
+// park on a condition variable; the mutex is only touched when somebody is
+// parked.
+class LockFreeBoundedQueue : public MPMCQueueInterface {
+ public:
+  // Creates a queue that holds up to "capacity" elements, rounded up to the
+  // next power of two.
+  explicit LockFreeBoundedQueue(size_t capacity = kDefaultCapacity);
+
+  // Releases all resources held by the queue. The queue must be empty, and no
+  // one waits on conditional variables.
+  ~LockFreeBoundedQueue() override;
+
+  // Puts elem into queue at the end of queue. Blocks while the queue is full.
+  void Put(void* elem) override;
+
+  // Removes the oldest element from the queue and returns it.
+  // This routine will cause the thread to block if queue is currently empty.
+  // Argument wait_time should be passed in when trace flag turning on (for
+  // collecting stats info purpose.)
+  void* Get(gpr_timespec* wait_time = nullptr) override;
+
+  // Returns number of elements in queue currently.
+  // There might be concurrently add/remove on queue, so count might change
+  // quickly.
+  int count() const override;
+
+  // Returns the maximum number of elements the queue can hold.
+  size_t capacity() const { return mask_ + 1; }
+
+  static const size_t kDefaultCapacity = 4096;
+
+ private:
+  struct Cell {
+    Atomic<size_t> sequence;
+    void* content;
+  };
+
+  // Non-blocking versions of Put and Get. Return false if the queue is full
+  // (respectively empty).
+  bool TryPut(void* elem);
+  bool TryGet(void** elem);
+
+  // Wakes up one thread parked on cv if num_waiters says there is any.
+  void WakeOne(Atomic<int>* num_waiters, CondVar* cv);
+
+  // Number of failed attempts before a thread parks itself.
+  static const int kSpinCount = 128;
+
+  Cell* cells_;
+  const size_t mask_;
+
+  // Producers and consumers each get their own cacheline.
+  union {
+    char enqueue_padding_[GPR_CACHELINE_SIZE];
+    Atomic<size_t> enqueue_pos_{0};
+  };
+  union {
+    char dequeue_padding_[GPR_CACHELINE_SIZE];
+    Atomic<size_t> dequeue_pos_{0};
+  };
+
+  // Parking lot for threads blocked on an empty or full queue.
+  Mutex mu_;
+  CondVar not_empty_;
+  CondVar not_full_;
+  Atomic<int> num_get_waiters_{0};
+  Atomic<int> num_put_waiters_{0};
+};
+
 }  // namespace grpc_core
 
 #endif /* GRPC_CORE_LIB_IOMGR_EXECUTOR_MPMCQUEUE_H */
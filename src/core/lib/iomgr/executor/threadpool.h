@@ -96,6 +96,16 @@ class ThreadPoolWorker {
 // capacity of closure queue is unlimited.
 class ThreadPool : public ThreadPoolInterface {
  public:
+  // Closure queue shared by the worker threads.
+  enum class QueueType {
+    // Unbounded queue protected by a single mutex (InfLenFIFOQueue).
+    kInfiniteLength,
+    // Lock free ring buffer (LockFreeBoundedQueue). Scales better with the
+    // number of threads adding and running closures, but Add() blocks while
+    // LockFreeBoundedQueue::kDefaultCapacity closures are pending.
+    kLockFreeBounded,
+  };
+
   // Creates a thread pool with size of "num_threads", with default thread name
   // "ThreadPoolWorker" and all thread options set to default. If the given size
   // is 0 or less, there will be 1 worker thread created inside pool.
@@ -115,11 +125,18 @@ class ThreadPool : public ThreadPoolInterface {
   ThreadPool(int num_threads, const char* thd_name,
              const Thread::Options& thread_options);
 
+  // Same as ThreadPool(int num_threads, const char* thd_name,
+  // const Thread::Options& thread_options) constructor, except that it also
+  // selects the type of the closure queue. The other constructors use
+  // QueueType::kInfiniteLength.
+  ThreadPool(int num_threads, const char* thd_name,
+             const Thread::Options& thread_options, QueueType queue_type);
+
   // Waits for all pending closures to complete, then shuts down thread pool.
   ~ThreadPool() override;
 
-  // Adds given closure into pending queue immediately. Since closure queue has
-  // infinite length, this routine will not block.
+  // Adds given closure into pending queue immediately. With the default
+  // infinite length closure queue, this routine will not block.
   void Add(grpc_experimental_completion_queue_functor* closure) override;
 
   int num_pending_closures() const override;
@@ -131,6 +148,7 @@ class ThreadPool : public ThreadPoolInterface {
   int num_threads_ = 0;
   const char* thd_name_ = nullptr;
   Thread::Options thread_options_;
+  QueueType queue_type_ = QueueType::kInfiniteLength;
   ThreadPoolWorker** threads_ = nullptr;  // Array of worker threads
   MPMCQueueInterface* queue_ = nullptr;   // Closure queue
 
@@ -60,6 +60,19 @@
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
 #endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0) */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 18, 0)
+#define GRPC_LINUX_TCP_ZEROCOPY_RECEIVE 1
+#endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(4, 18, 0) */
+/* Kernel TLS can encrypt since 4.13 and decrypt since 4.17; only the two
+   together are useful. The running kernel may still lack the tls module. */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 17, 0)
+#define GRPC_LINUX_KTLS 1
+#endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(4, 17, 0) */
+/* Multishot poll requests were added to io_uring in 5.13. The running kernel
+   is probed again when the io_uring polling engine is initialized. */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 13, 0)
+#define GRPC_LINUX_IO_URING 1
+#endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(5, 13, 0) */
 #endif /* LINUX_VERSION_CODE */
 #define GRPC_LINUX_MULTIPOLL_WITH_EPOLL 1
 #define GRPC_POSIX_FORK 1
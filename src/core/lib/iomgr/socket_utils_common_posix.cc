@@ -147,6 +147,32 @@ grpc_error* grpc_set_socket_rcvbuf(int fd, int buffer_size_bytes) {
              : GRPC_OS_ERROR(errno, "setsockopt(SO_RCVBUF)");
 }
 
+grpc_error* grpc_get_socket_write_capacity(int fd, int* bytes) {
+  socklen_t len;
+#ifdef TCP_NOTSENT_LOWAT
+  /* unset, the threshold reads back as UINT_MAX */
+  int lowat;
+  len = sizeof(lowat);
+  if (0 == getsockopt(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &lowat, &len) &&
+      lowat > 0 && lowat < INT_MAX) {
+    *bytes = lowat;
+    return GRPC_ERROR_NONE;
+  }
+#endif
+  int sndbuf;
+  len = sizeof(sndbuf);
+  if (0 != getsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, &len)) {
+    return GRPC_OS_ERROR(errno, "getsockopt(SO_SNDBUF)");
+  }
+#if GPR_LINUX == 1
+  /* linux reports twice the payload it will hold, the rest being reserved for
+     bookkeeping */
+  sndbuf /= 2;
+#endif
+  *bytes = sndbuf;
+  return GRPC_ERROR_NONE;
+}
+
 /* set a socket to close on exec */
 grpc_error* grpc_set_socket_cloexec(int fd, int close_on_exec) {
   int oldflags = fcntl(fd, F_GETFD, 0);
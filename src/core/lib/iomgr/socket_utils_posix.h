@@ -100,6 +100,11 @@ grpc_error* grpc_set_socket_sndbuf(int fd, int buffer_size_bytes);
 /* Tries to set the socket's receive buffer to given size. */
 grpc_error* grpc_set_socket_rcvbuf(int fd, int buffer_size_bytes);
 
+/* Gets how many bytes a single write can usefully queue on the socket: its
+   TCP_NOTSENT_LOWAT threshold if one is set, otherwise the usable part of its
+   send buffer. */
+grpc_error* grpc_get_socket_write_capacity(int fd, int* bytes);
+
 /* Tries to set the socket using a grpc_socket_mutator */
 grpc_error* grpc_set_socket_with_mutator(int fd, grpc_socket_mutator* mutator);
 
@@ -32,6 +32,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -69,6 +70,17 @@
 #define TCP_CM_INQ TCP_INQ
 #endif
 
+#ifdef GRPC_LINUX_KTLS
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TLS_GET_RECORD_TYPE
+#define TLS_GET_RECORD_TYPE 2
+#endif
+/* TLS ContentType of the records that carry the connection's data. */
+#define TLS_RECORD_TYPE_APPLICATION_DATA 23
+#endif /* GRPC_LINUX_KTLS */
+
 #ifdef GRPC_HAVE_MSG_NOSIGNAL
 #define SENDMSG_FLAGS MSG_NOSIGNAL
 #else
@@ -84,6 +96,12 @@
 #define MSG_ZEROCOPY 0x4000000
 #endif
 
+// TCP zero copy receive socket option. Defined here for the same reason as
+// MSG_ZEROCOPY above.
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+
 #ifdef GRPC_MSG_IOVLEN_TYPE
 typedef GRPC_MSG_IOVLEN_TYPE msg_iovlen_type;
 #else
@@ -375,6 +393,18 @@ struct grpc_tcp {
   int inq;          /* bytes pending on the socket from the last read. */
   bool inq_capable; /* cache whether kernel supports inq */
 
+  /* Whether to map received pages instead of copying them when at least
+     rx_zerocopy_threshold bytes are pending. Requires inq_capable. */
+  bool rx_zerocopy_enabled;
+  int rx_zerocopy_threshold;
+
+  /* Whether kernel TLS decrypts the records received on fd. It then returns
+     records other than application data, e.g. alerts, one at a time and
+     tagged with their type. */
+  bool kernel_tls;
+  /* Set once such a record has been received: it ends the stream. */
+  bool kernel_tls_eof;
+
   grpc_slice_buffer* outgoing_buffer;
   /* byte within outgoing_buffer->slices[0] to write next */
   size_t outgoing_byte_idx;
@@ -428,12 +458,21 @@ struct backup_poller {
 }  // namespace
 
 static void ZerocopyDisableAndWaitForRemaining(grpc_tcp* tcp);
+static bool tcp_do_read_zerocopy(grpc_tcp* tcp);
 
 #define BACKUP_POLLER_POLLSET(b) ((grpc_pollset*)((b) + 1))
 
 static gpr_atm g_uncovered_notifications_pending;
 static gpr_atm g_backup_poller; /* backup_poller* */
 
+/* Orderly closes are common enough to stay inline: they carry the UNAVAILABLE
+ * status but not the fd or peer address. */
+static grpc_error* tcp_closed_error(grpc_error_inline_descs desc) {
+  return grpc_error_set_int(GRPC_ERROR_CREATE_INLINE(desc),
+                            GRPC_ERROR_INT_GRPC_STATUS,
+                            GRPC_STATUS_UNAVAILABLE);
+}
+
 static void tcp_handle_read(void* arg /* grpc_tcp */, grpc_error* error);
 static void tcp_handle_write(void* arg /* grpc_tcp */, grpc_error* error);
 static void tcp_drop_uncovered_then_handle_write(void* arg /* grpc_tcp */,
@@ -631,7 +670,7 @@ static void tcp_free(grpc_tcp* tcp) {
   gpr_mu_lock(&tcp->tb_mu);
   grpc_core::TracedBuffer::Shutdown(
       &tcp->tb_head, tcp->outgoing_buffer_arg,
-      GRPC_ERROR_CREATE_FROM_STATIC_STRING("endpoint destroyed"));
+      GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_ENDPOINT_DESTROYED));
   gpr_mu_unlock(&tcp->tb_mu);
   tcp->outgoing_buffer_arg = nullptr;
   gpr_mu_destroy(&tcp->tb_mu);
@@ -700,6 +739,21 @@ static void call_read_cb(grpc_tcp* tcp, grpc_error* error) {
   grpc_core::Closure::Run(DEBUG_LOCATION, cb, error);
 }
 
+#ifdef GRPC_LINUX_KTLS
+/* Returns false if the bytes just received by a kernel TLS socket are the
+   content of a record other than application data. */
+static bool tcp_read_is_application_data(msghdr* msg) {
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(msg);
+  for (; cmsg != nullptr; cmsg = CMSG_NXTHDR(msg, cmsg)) {
+    if (cmsg->cmsg_level == SOL_TLS && cmsg->cmsg_type == TLS_GET_RECORD_TYPE &&
+        cmsg->cmsg_len == CMSG_LEN(sizeof(unsigned char))) {
+      return *CMSG_DATA(cmsg) == TLS_RECORD_TYPE_APPLICATION_DATA;
+    }
+  }
+  return true;
+}
+#endif /* GRPC_LINUX_KTLS */
+
 #define MAX_READ_IOVEC 4
 static void tcp_do_read(grpc_tcp* tcp) {
   GPR_TIMER_SCOPE("tcp_do_read", 0);
@@ -711,11 +765,23 @@ static void tcp_do_read(grpc_tcp* tcp) {
       std::min<size_t>(MAX_READ_IOVEC, tcp->incoming_buffer->count);
 #ifdef GRPC_LINUX_ERRQUEUE
   constexpr size_t cmsg_alloc_space =
-      CMSG_SPACE(sizeof(grpc_core::scm_timestamping)) + CMSG_SPACE(sizeof(int));
+      CMSG_SPACE(sizeof(grpc_core::scm_timestamping)) +
+      CMSG_SPACE(sizeof(int)) + CMSG_SPACE(sizeof(unsigned char));
 #else
-  constexpr size_t cmsg_alloc_space = 24 /* CMSG_SPACE(sizeof(int)) */;
+  constexpr size_t cmsg_alloc_space =
+      24 /* CMSG_SPACE(sizeof(int)) */ +
+      16 /* CMSG_SPACE(sizeof(unsigned char)) */;
 #endif /* GRPC_LINUX_ERRQUEUE */
   char cmsgbuf[cmsg_alloc_space];
+#ifdef GRPC_LINUX_KTLS
+  if (tcp->kernel_tls_eof) {
+    /* The previous read delivered the data received before the end. */
+    grpc_slice_buffer_reset_and_unref_internal(tcp->incoming_buffer);
+    call_read_cb(tcp, tcp_closed_error(GRPC_ERROR_INLINE_SOCKET_CLOSED));
+    TCP_UNREF(tcp, "read");
+    return;
+  }
+#endif /* GRPC_LINUX_KTLS */
   for (size_t i = 0; i < iov_len; i++) {
     iov[i].iov_base = GRPC_SLICE_START_PTR(tcp->incoming_buffer->slices[i]);
     iov[i].iov_len = GRPC_SLICE_LENGTH(tcp->incoming_buffer->slices[i]);
@@ -731,7 +797,9 @@ static void tcp_do_read(grpc_tcp* tcp) {
     msg.msg_namelen = 0;
     msg.msg_iov = iov;
     msg.msg_iovlen = static_cast<msg_iovlen_type>(iov_len);
-    if (tcp->inq_capable) {
+    /* Kernel TLS fails reads of non-data records with EIO unless it can
+       report their type. */
+    if (tcp->inq_capable || tcp->kernel_tls) {
       msg.msg_control = cmsgbuf;
       msg.msg_controllen = sizeof(cmsgbuf);
     } else {
@@ -749,6 +817,22 @@ static void tcp_do_read(grpc_tcp* tcp) {
       read_bytes = recvmsg(tcp->fd, &msg, 0);
     } while (read_bytes < 0 && errno == EINTR);
 
+#ifdef GRPC_LINUX_KTLS
+    /* Records other than application data, such as the peer's close_notify
+       alert or a renegotiation request, are not passed on: the connection
+       ends there, as it would with a userspace protector. EIO is what a read
+       of one of them still returns without room for its type. */
+    if (tcp->kernel_tls &&
+        ((read_bytes > 0 && !tcp_read_is_application_data(&msg)) ||
+         (read_bytes < 0 && errno == EIO))) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace)) {
+        gpr_log(GPR_INFO, "TCP:%p received a TLS record other than data", tcp);
+      }
+      tcp->kernel_tls_eof = true;
+      read_bytes = 0;
+    }
+#endif /* GRPC_LINUX_KTLS */
+
     /* We have read something in previous reads. We need to deliver those
      * bytes to the upper layer. */
     if (read_bytes <= 0 && total_read_bytes > 0) {
@@ -779,14 +863,14 @@ static void tcp_do_read(grpc_tcp* tcp) {
        * since the connection is closed we will drop the data here, because we
        * can't call the callback multiple times. */
       grpc_slice_buffer_reset_and_unref_internal(tcp->incoming_buffer);
-      call_read_cb(
-          tcp, tcp_annotate_error(
-                   GRPC_ERROR_CREATE_FROM_STATIC_STRING("Socket closed"), tcp));
+      call_read_cb(tcp, tcp_closed_error(GRPC_ERROR_INLINE_SOCKET_CLOSED));
       TCP_UNREF(tcp, "read");
       return;
     }
 
     GRPC_STATS_INC_TCP_READ_SIZE(read_bytes);
+    GRPC_STATS_INC_COUNTER_BY(GRPC_STATS_COUNTER_TCP_READ_COPY_BYTES,
+                              read_bytes);
     add_to_estimate(tcp, static_cast<size_t>(read_bytes));
     GPR_DEBUG_ASSERT((size_t)read_bytes <=
                      tcp->incoming_buffer->length - total_read_bytes);
@@ -863,7 +947,122 @@ static void tcp_read_allocation_done(void* tcpp, grpc_error* error) {
   }
 }
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+namespace {
+// The leading fields of the kernel's struct tcp_zerocopy_receive, which is not
+// exported by the libc headers. The kernel accepts any option length covering
+// at least address and length.
+struct TcpZerocopyReceive {
+  uint64_t address;        /* in: address of mapping */
+  uint32_t length;         /* in/out: number of bytes to map/mapped */
+  uint32_t recv_skip_hint; /* out: amount of bytes to skip */
+};
+
+// Pages mapped by a zerocopy read, charged to the resource user of the
+// endpoint until the slice holding them is released.
+struct TcpZerocopyMapping {
+  void* addr;
+  size_t length;
+  grpc_resource_user* resource_user;
+};
+}  // namespace
+
+static void tcp_zerocopy_unmap(void* arg) {
+  TcpZerocopyMapping* mapping = static_cast<TcpZerocopyMapping*>(arg);
+  munmap(mapping->addr, mapping->length);
+  grpc_resource_user_free(mapping->resource_user, mapping->length);
+  gpr_free(mapping);
+}
+
+/* Receives the bytes pending on the socket by mapping the pages holding them
+ * into our address space. The mapping is handed to the upper layer as a slice
+ * that unmaps it once the last reference is dropped. Returns false, leaving
+ * the read to tcp_do_read(), if nothing could be received this way (e.g. the
+ * pending data is not page aligned), and true if the read completed. */
+static bool tcp_do_read_zerocopy(grpc_tcp* tcp) {
+  GPR_TIMER_SCOPE("tcp_do_read_zerocopy", 0);
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t map_len = std::min<size_t>(tcp->inq, tcp->max_read_chunk_size) &
+                   ~(page_size - 1);
+  if (map_len == 0) return false;
+  /* Mapped pages count against the resource quota like read buffers. Under
+     memory pressure, leave the read to tcp_do_read(), which waits for quota. */
+  if (!grpc_resource_user_safe_alloc(tcp->resource_user, map_len)) {
+    return false;
+  }
+  void* addr = mmap(nullptr, map_len, PROT_READ, MAP_SHARED, tcp->fd, 0);
+  if (addr == MAP_FAILED) {
+    gpr_log(GPR_INFO, "TCP:%p disabling RX zerocopy: mmap failed: %s", tcp,
+            strerror(errno));
+    tcp->rx_zerocopy_enabled = false;
+    grpc_resource_user_free(tcp->resource_user, map_len);
+    return false;
+  }
+  TcpZerocopyReceive zc;
+  memset(&zc, 0, sizeof(zc));
+  zc.address = reinterpret_cast<uintptr_t>(addr);
+  zc.length = static_cast<uint32_t>(map_len);
+  socklen_t zc_len = sizeof(zc);
+  int err;
+  do {
+    GRPC_STATS_INC_SYSCALL_READ();
+    err = getsockopt(tcp->fd, IPPROTO_TCP, TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (err < 0 && errno == EINTR);
+  if (err < 0 || zc.length == 0) {
+    if (err < 0 && errno != EAGAIN) {
+      gpr_log(GPR_INFO, "TCP:%p disabling RX zerocopy: %s", tcp,
+              strerror(errno));
+      tcp->rx_zerocopy_enabled = false;
+    }
+    munmap(addr, map_len);
+    grpc_resource_user_free(tcp->resource_user, map_len);
+    return false;
+  }
+  if (zc.length < map_len) {
+    munmap(static_cast<char*>(addr) + zc.length, map_len - zc.length);
+    grpc_resource_user_free(tcp->resource_user, map_len - zc.length);
+  }
+  TcpZerocopyMapping* mapping =
+      static_cast<TcpZerocopyMapping*>(gpr_malloc(sizeof(*mapping)));
+  mapping->addr = addr;
+  mapping->length = zc.length;
+  mapping->resource_user = tcp->resource_user;
+
+  /* The slices in incoming_buffer are spare space left by an earlier copying
+     read; keep them for the next one. */
+  grpc_slice_buffer_swap(tcp->incoming_buffer, &tcp->last_read_buffer);
+  grpc_slice_buffer_add(
+      tcp->incoming_buffer,
+      grpc_slice_new_with_user_data(addr, zc.length, tcp_zerocopy_unmap,
+                                    mapping));
+  GRPC_STATS_INC_TCP_READ_SIZE(zc.length);
+  GRPC_STATS_INC_COUNTER_BY(GRPC_STATS_COUNTER_TCP_READ_ZEROCOPY_BYTES,
+                            zc.length);
+  add_to_estimate(tcp, zc.length);
+  /* Anything left, including the unaligned bytes reported in recv_skip_hint,
+   * is picked up by the next read. More may have arrived meanwhile, but
+   * underestimating only delays the next zerocopy read. */
+  tcp->inq = tcp->inq > static_cast<int>(zc.length)
+                 ? tcp->inq - static_cast<int>(zc.length)
+                 : 0;
+  if (tcp->inq == 0) {
+    finish_estimate(tcp);
+  }
+  call_read_cb(tcp, GRPC_ERROR_NONE);
+  TCP_UNREF(tcp, "read");
+  return true;
+}
+#else  /* GRPC_LINUX_TCP_ZEROCOPY_RECEIVE */
+static bool tcp_do_read_zerocopy(grpc_tcp* /*tcp*/) { return false; }
+#endif /* GRPC_LINUX_TCP_ZEROCOPY_RECEIVE */
+
 static void tcp_continue_read(grpc_tcp* tcp) {
+  /* Map large reads instead of copying them when enabled. tcp->inq is only
+     known after a copying read, so small messages never take this path. */
+  if (tcp->rx_zerocopy_enabled && tcp->inq >= tcp->rx_zerocopy_threshold &&
+      tcp_do_read_zerocopy(tcp)) {
+    return;
+  }
   size_t target_read_size = get_target_read_size(tcp);
   /* Wait for allocation only when there is no buffer left. */
   if (tcp->incoming_buffer->length == 0 &&
@@ -1583,8 +1782,7 @@ static void tcp_write(grpc_endpoint* ep, grpc_slice_buffer* buf,
     grpc_core::Closure::Run(
         DEBUG_LOCATION, cb,
         grpc_fd_is_shutdown(tcp->em_fd)
-            ? tcp_annotate_error(GRPC_ERROR_CREATE_FROM_STATIC_STRING("EOF"),
-                                 tcp)
+            ? tcp_closed_error(GRPC_ERROR_INLINE_EOF)
             : GRPC_ERROR_NONE);
     tcp_shutdown_buffer_list(tcp);
     return;
@@ -1695,6 +1893,8 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
                                const grpc_channel_args* channel_args,
                                const char* peer_string) {
   static constexpr bool kZerocpTxEnabledDefault = false;
+  static constexpr bool kZerocpRxEnabledDefault = false;
+  static constexpr int kZerocpRxDefaultRecvBytesThreshold = 64 * 1024;
   int tcp_read_chunk_size = GRPC_TCP_DEFAULT_READ_SLICE_SIZE;
   int tcp_max_read_chunk_size = 4 * 1024 * 1024;
   int tcp_min_read_chunk_size = 256;
@@ -1703,6 +1903,8 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
       grpc_core::TcpZerocopySendCtx::kDefaultSendBytesThreshold;
   int tcp_tx_zerocopy_max_simult_sends =
       grpc_core::TcpZerocopySendCtx::kDefaultMaxSends;
+  bool tcp_rx_zerocopy_enabled = kZerocpRxEnabledDefault;
+  int tcp_rx_zerocopy_recv_bytes_thresh = kZerocpRxDefaultRecvBytesThreshold;
   grpc_resource_quota* resource_quota = grpc_resource_quota_create(nullptr);
   if (channel_args != nullptr) {
     for (size_t i = 0; i < channel_args->num_args; i++) {
@@ -1744,6 +1946,16 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
             grpc_core::TcpZerocopySendCtx::kDefaultMaxSends, 0, INT_MAX};
         tcp_tx_zerocopy_max_simult_sends =
             grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) {
+        tcp_rx_zerocopy_enabled = grpc_channel_arg_get_bool(
+            &channel_args->args[i], kZerocpRxEnabledDefault);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD)) {
+        grpc_integer_options options = {kZerocpRxDefaultRecvBytesThreshold, 1,
+                                        INT_MAX};
+        tcp_rx_zerocopy_recv_bytes_thresh =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
       }
     }
   }
@@ -1834,6 +2046,18 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
 #else
   tcp->inq_capable = false;
 #endif /* GRPC_HAVE_TCP_INQ */
+  /* RX zerocopy relies on inq to know when enough bytes are pending. */
+  tcp->rx_zerocopy_threshold = tcp_rx_zerocopy_recv_bytes_thresh;
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  tcp->rx_zerocopy_enabled = tcp_rx_zerocopy_enabled && tcp->inq_capable;
+#else
+  if (tcp_rx_zerocopy_enabled) {
+    gpr_log(GPR_INFO, "TCP RX zerocopy is not supported on this platform");
+  }
+  tcp->rx_zerocopy_enabled = false;
+#endif /* GRPC_LINUX_TCP_ZEROCOPY_RECEIVE */
+  tcp->kernel_tls = false;
+  tcp->kernel_tls_eof = false;
   /* Start being notified on errors if event engine can track errors. */
   if (grpc_event_engine_can_track_errors()) {
     /* Grab a ref to tcp so that we can safely access the tcp struct when
@@ -1849,12 +2073,22 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   return &tcp->base;
 }
 
+bool grpc_is_tcp_endpoint(grpc_endpoint* ep) { return ep->vtable == &vtable; }
+
 int grpc_tcp_fd(grpc_endpoint* ep) {
   grpc_tcp* tcp = reinterpret_cast<grpc_tcp*>(ep);
   GPR_ASSERT(ep->vtable == &vtable);
   return grpc_fd_wrapped_fd(tcp->em_fd);
 }
 
+void grpc_tcp_set_kernel_tls(grpc_endpoint* ep) {
+  grpc_tcp* tcp = reinterpret_cast<grpc_tcp*>(ep);
+  GPR_ASSERT(ep->vtable == &vtable);
+  tcp->tcp_zerocopy_send_ctx.set_enabled(false);
+  tcp->rx_zerocopy_enabled = false;
+  tcp->kernel_tls = true;
+}
+
 void grpc_tcp_destroy_and_release_fd(grpc_endpoint* ep, int* fd,
                                      grpc_closure* done) {
   grpc_tcp* tcp = reinterpret_cast<grpc_tcp*>(ep);
@@ -45,12 +45,22 @@ extern grpc_core::TraceFlag grpc_tcp_trace;
 grpc_endpoint* grpc_tcp_create(grpc_fd* fd, const grpc_channel_args* args,
                                const char* peer_string);
 
+/* Return true if ep was created by grpc_tcp_create, rather than being e.g. a
+   secure endpoint wrapping one. */
+bool grpc_is_tcp_endpoint(grpc_endpoint* ep);
+
 /* Return the tcp endpoint's fd, or -1 if this is not available. Does not
    release the fd.
    Requires: ep must be a tcp endpoint.
  */
 int grpc_tcp_fd(grpc_endpoint* ep);
 
+/* Tell the tcp endpoint that kernel TLS now sits between it and the socket.
+   It stops using MSG_ZEROCOPY sends and TCP_ZEROCOPY_RECEIVE reads, and ends
+   the stream at the first received record that is not application data.
+   Requires: ep must be a tcp endpoint with no read or write in progress. */
+void grpc_tcp_set_kernel_tls(grpc_endpoint* ep);
+
 /* Destroy the tcp endpoint without closing its fd. *fd will be set and done
  * will be called when the endpoint is destroyed.
  * Requires: ep must be a tcp endpoint and fd must not be NULL. */
@@ -558,8 +558,9 @@ static void tcp_server_shutdown_listeners(grpc_tcp_server* s) {
   if (s->active_ports) {
     grpc_tcp_listener* sp;
     for (sp = s->head; sp; sp = sp->next) {
-      grpc_fd_shutdown(sp->emfd,
-                       GRPC_ERROR_CREATE_FROM_STATIC_STRING("Server shutdown"));
+      grpc_fd_shutdown(
+          sp->emfd,
+          GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_SERVER_SHUTDOWN));
     }
   }
   gpr_mu_unlock(&s->mu);
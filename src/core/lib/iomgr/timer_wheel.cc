@@ -0,0 +1,512 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#include <inttypes.h>
+
+#include "src/core/lib/iomgr/timer_wheel.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/log.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/spinlock.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/atomic.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+GPR_GLOBAL_CONFIG_DEFINE_BOOL(
+    grpc_experimental_timer_wheel, false,
+    "If set, use the hierarchical timing wheel timer implementation instead "
+    "of the default heap based one.");
+
+extern grpc_core::TraceFlag grpc_timer_trace;
+extern grpc_core::TraceFlag grpc_timer_check_trace;
+
+/* Level 0 has one slot per millisecond tick; levels 1..3 have kLevelSlots
+   slots each, every slot covering kLevelSlots times the range of a slot one
+   level below. Anything further out than level 3 can represent sits in an
+   unordered overflow list that is re-examined each time level 3 wraps. */
+#define NUM_LEVELS 4
+#define LEVEL0_BITS 8
+#define LEVEL_BITS 6
+#define LEVEL0_SLOTS (1 << LEVEL0_BITS)
+#define LEVEL_SLOTS (1 << LEVEL_BITS)
+#define OVERFLOW_LEVEL NUM_LEVELS
+#define OVERFLOW_SHIFT (LEVEL0_BITS + (NUM_LEVELS - 1) * LEVEL_BITS)
+#define OVERFLOW_HEAD (LEVEL0_SLOTS + (NUM_LEVELS - 1) * LEVEL_SLOTS)
+#define NUM_HEADS (OVERFLOW_HEAD + 1)
+
+/* grpc_timer::heap_index holds (wheel index << 16) | list head index while a
+   timer is pending. */
+#define HEAD_INDEX_BITS 16
+#define HEAD_INDEX_MASK ((1u << HEAD_INDEX_BITS) - 1)
+#define INVALID_WHEEL_INDEX 0xffffffffu
+
+struct timer_wheel {
+  gpr_mu mu;
+  /* The next tick to process: every tick before this one has been expired. */
+  grpc_millis current;
+  /* A lower bound on the deadline of the next timer due in this wheel. */
+  grpc_millis min_deadline;
+  /* Number of pending timers in total and per level (incl. overflow). */
+  size_t count;
+  size_t level_count[NUM_LEVELS + 1];
+  /* Doubly linked lists of timers, indexed by level and slot. The head of
+     each list has a null prev pointer. */
+  grpc_timer* heads[NUM_HEADS];
+} GPR_ALIGN_STRUCT(GPR_CACHELINE_SIZE);
+
+static uint32_t g_num_wheels;
+static timer_wheel* g_wheels;
+
+struct wheel_shared_mutables {
+  /* The earliest min_deadline across all wheels. */
+  grpc_core::Atomic<grpc_millis> min_timer{GRPC_MILLIS_INF_FUTURE};
+  /* Allow only one advance_wheels at once */
+  gpr_spinlock checker_mu;
+  bool initialized;
+  /* Serializes lowering min_timer against recomputing it */
+  gpr_mu mu;
+} GPR_ALIGN_STRUCT(GPR_CACHELINE_SIZE);
+
+static wheel_shared_mutables g_shared_mutables;
+
+static int level_shift(int level) {
+  return level == 0 ? 0 : LEVEL0_BITS + (level - 1) * LEVEL_BITS;
+}
+
+static int head_level(uint32_t head) {
+  if (head < LEVEL0_SLOTS) return 0;
+  if (head == OVERFLOW_HEAD) return OVERFLOW_LEVEL;
+  return 1 + static_cast<int>((head - LEVEL0_SLOTS) / LEVEL_SLOTS);
+}
+
+static uint32_t slot_head(int level, grpc_millis tick) {
+  if (level == 0) {
+    return static_cast<uint32_t>(tick & (LEVEL0_SLOTS - 1));
+  }
+  return LEVEL0_SLOTS + (level - 1) * LEVEL_SLOTS +
+         static_cast<uint32_t>((tick >> level_shift(level)) &
+                               (LEVEL_SLOTS - 1));
+}
+
+/* Returns the smallest multiple of 2^shift that is >= t */
+static grpc_millis round_up_to_shift(grpc_millis t, int shift) {
+  grpc_millis mask = (static_cast<grpc_millis>(1) << shift) - 1;
+  return (t + mask) & ~mask;
+}
+
+static void list_push(timer_wheel* wheel, uint32_t head, grpc_timer* timer) {
+  timer->prev = nullptr;
+  timer->next = wheel->heads[head];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  wheel->heads[head] = timer;
+}
+
+static void list_remove(timer_wheel* wheel, uint32_t head, grpc_timer* timer) {
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    wheel->heads[head] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+}
+
+/* Places a timer in the slot covering its deadline, relative to
+   wheel->current. Timers already due go to the slot processed next.
+   REQUIRES: wheel->mu locked */
+static void wheel_add(timer_wheel* wheel, grpc_timer* timer) {
+  grpc_millis deadline = GPR_MAX(timer->deadline, wheel->current);
+  grpc_millis delta = deadline - wheel->current;
+  int level = 0;
+  uint32_t head;
+  if (delta < LEVEL0_SLOTS) {
+    head = slot_head(0, deadline);
+  } else {
+    for (level = 1; level < NUM_LEVELS; level++) {
+      if (delta < (static_cast<grpc_millis>(1)
+                   << (level_shift(level) + LEVEL_BITS))) {
+        break;
+      }
+    }
+    head = level == OVERFLOW_LEVEL ? OVERFLOW_HEAD : slot_head(level, deadline);
+  }
+  timer->heap_index =
+      (static_cast<uint32_t>(wheel - g_wheels) << HEAD_INDEX_BITS) | head;
+  list_push(wheel, head, timer);
+  wheel->level_count[level]++;
+  wheel->count++;
+}
+
+/* Detaches all timers of list head 'head' and returns them as a null
+   terminated singly linked list (via next).
+   REQUIRES: wheel->mu locked */
+static grpc_timer* take_list(timer_wheel* wheel, uint32_t head) {
+  grpc_timer* list = wheel->heads[head];
+  wheel->heads[head] = nullptr;
+  size_t n = 0;
+  for (grpc_timer* t = list; t != nullptr; t = t->next) n++;
+  wheel->level_count[head_level(head)] -= n;
+  wheel->count -= n;
+  return list;
+}
+
+/* Moves the timers of one coarse slot into finer levels.
+   REQUIRES: wheel->mu locked */
+static void cascade(timer_wheel* wheel, uint32_t head) {
+  grpc_timer* timer = take_list(wheel, head);
+  while (timer != nullptr) {
+    grpc_timer* next = timer->next;
+    wheel_add(wheel, timer);
+    timer = next;
+  }
+}
+
+/* Runs the closures of all timers of list head 'head'.
+   REQUIRES: wheel->mu locked */
+static size_t fire_list(timer_wheel* wheel, uint32_t head, grpc_error* error) {
+  size_t n = 0;
+  grpc_timer* timer = take_list(wheel, head);
+  while (timer != nullptr) {
+    grpc_timer* next = timer->next;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+      gpr_log(GPR_INFO, "  .. wheel[%d]: fire timer %p deadline=%" PRId64,
+              static_cast<int>(wheel - g_wheels), timer, timer->deadline);
+    }
+    timer->pending = false;
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure,
+                            GRPC_ERROR_REF(error));
+    n++;
+    timer = next;
+  }
+  return n;
+}
+
+/* Expires every timer with a deadline <= now, cascading coarser levels as
+   their slots come due. Ticks that cannot hold a due timer are skipped.
+   Returns the number of timers fired.
+   REQUIRES: wheel->mu locked */
+static size_t advance_wheel(timer_wheel* wheel, grpc_millis now,
+                            grpc_error* error) {
+  size_t n = 0;
+  if (now == GRPC_MILLIS_INF_FUTURE) {
+    for (uint32_t head = 0; head < NUM_HEADS; head++) {
+      n += fire_list(wheel, head, error);
+    }
+    return n;
+  }
+  while (wheel->current <= now) {
+    if (wheel->count == 0) {
+      wheel->current = now + 1;
+      break;
+    }
+    if (wheel->level_count[0] == 0) {
+      /* Nothing can come due before the next cascade of the finest
+         non-empty level. */
+      int level = 1;
+      while (wheel->level_count[level] == 0) level++;
+      grpc_millis next = round_up_to_shift(
+          wheel->current,
+          level == OVERFLOW_LEVEL ? OVERFLOW_SHIFT : level_shift(level));
+      if (next > now) {
+        wheel->current = now + 1;
+        break;
+      }
+      wheel->current = next;
+    }
+    grpc_millis tick = wheel->current;
+    if ((tick & (LEVEL0_SLOTS - 1)) == 0) {
+      if ((tick & ((static_cast<grpc_millis>(1) << OVERFLOW_SHIFT) - 1)) ==
+          0) {
+        cascade(wheel, OVERFLOW_HEAD);
+      }
+      for (int level = NUM_LEVELS - 1; level >= 1; level--) {
+        grpc_millis mask =
+            (static_cast<grpc_millis>(1) << level_shift(level)) - 1;
+        if ((tick & mask) == 0) cascade(wheel, slot_head(level, tick));
+      }
+    }
+    n += fire_list(wheel, slot_head(0, tick), error);
+    wheel->current = tick + 1;
+  }
+  return n;
+}
+
+/* Returns a lower bound for the deadline of the next timer in the wheel:
+   exact for level 0, and the tick at which the next non-empty slot cascades
+   for the coarser levels.
+   REQUIRES: wheel->mu locked */
+static grpc_millis compute_min_deadline(timer_wheel* wheel) {
+  if (wheel->count == 0) return GRPC_MILLIS_INF_FUTURE;
+  grpc_millis min_deadline = GRPC_MILLIS_INF_FUTURE;
+  if (wheel->level_count[0] > 0) {
+    for (grpc_millis i = 0; i < LEVEL0_SLOTS; i++) {
+      if (wheel->heads[slot_head(0, wheel->current + i)] != nullptr) {
+        min_deadline = wheel->current + i;
+        break;
+      }
+    }
+  }
+  for (int level = 1; level < NUM_LEVELS; level++) {
+    if (wheel->level_count[level] == 0) continue;
+    int shift = level_shift(level);
+    grpc_millis base = wheel->current >> shift;
+    for (grpc_millis i = 0; i <= LEVEL_SLOTS; i++) {
+      grpc_millis tick = (base + i) << shift;
+      if (tick >= min_deadline) break;
+      if (tick < wheel->current) continue;
+      if (wheel->heads[slot_head(level, tick)] != nullptr) {
+        min_deadline = tick;
+        break;
+      }
+    }
+  }
+  if (wheel->level_count[OVERFLOW_LEVEL] > 0) {
+    min_deadline = GPR_MIN(
+        min_deadline, round_up_to_shift(wheel->current, OVERFLOW_SHIFT));
+  }
+  return min_deadline;
+}
+
+static void timer_list_init() {
+  g_num_wheels = GPR_CLAMP(gpr_cpu_num_cores(), 1, 32);
+  g_wheels =
+      static_cast<timer_wheel*>(gpr_zalloc(g_num_wheels * sizeof(*g_wheels)));
+
+  g_shared_mutables.initialized = true;
+  g_shared_mutables.checker_mu = GPR_SPINLOCK_INITIALIZER;
+  gpr_mu_init(&g_shared_mutables.mu);
+  g_shared_mutables.min_timer.Store(GRPC_MILLIS_INF_FUTURE,
+                                    grpc_core::MemoryOrder::RELAXED);
+
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  for (uint32_t i = 0; i < g_num_wheels; i++) {
+    timer_wheel* wheel = &g_wheels[i];
+    gpr_mu_init(&wheel->mu);
+    wheel->current = now;
+    wheel->min_deadline = GRPC_MILLIS_INF_FUTURE;
+  }
+}
+
+static void timer_list_shutdown() {
+  grpc_error* error =
+      GRPC_ERROR_CREATE_FROM_STATIC_STRING("Timer list shutdown");
+  for (uint32_t i = 0; i < g_num_wheels; i++) {
+    timer_wheel* wheel = &g_wheels[i];
+    gpr_mu_lock(&wheel->mu);
+    advance_wheel(wheel, GRPC_MILLIS_INF_FUTURE, error);
+    gpr_mu_unlock(&wheel->mu);
+    gpr_mu_destroy(&wheel->mu);
+  }
+  GRPC_ERROR_UNREF(error);
+  gpr_mu_destroy(&g_shared_mutables.mu);
+  gpr_free(g_wheels);
+  g_wheels = nullptr;
+  g_num_wheels = 0;
+  g_shared_mutables.initialized = false;
+}
+
+static void timer_init(grpc_timer* timer, grpc_millis deadline,
+                       grpc_closure* closure) {
+  timer->closure = closure;
+  timer->deadline = deadline;
+  timer->heap_index = INVALID_WHEEL_INDEX;
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+    gpr_log(GPR_INFO, "TIMER %p: SET %" PRId64 " now %" PRId64 " call %p[%p]",
+            timer, deadline, grpc_core::ExecCtx::Get()->Now(), closure,
+            closure->cb);
+  }
+
+  if (!g_shared_mutables.initialized) {
+    timer->pending = false;
+    grpc_core::ExecCtx::Run(
+        DEBUG_LOCATION, timer->closure,
+        GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            "Attempt to create timer before initialization"));
+    return;
+  }
+
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  if (deadline <= now) {
+    timer->pending = false;
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure, GRPC_ERROR_NONE);
+    /* early out */
+    return;
+  }
+
+  timer_wheel* wheel =
+      &g_wheels[grpc_core::ExecCtx::Get()->starting_cpu() % g_num_wheels];
+  gpr_mu_lock(&wheel->mu);
+  timer->pending = true;
+  if (wheel->count == 0 && wheel->current < now) {
+    /* No timers can be skipped over, so start counting from now to keep the
+       new timer in the finest level that fits it. */
+    wheel->current = now;
+  }
+  wheel_add(wheel, timer);
+  grpc_millis fire_at = GPR_MAX(deadline, wheel->current);
+  bool is_first_timer = fire_at < wheel->min_deadline;
+  if (is_first_timer) wheel->min_deadline = fire_at;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+    gpr_log(GPR_INFO,
+            "  .. add to wheel %d level %d with current=%" PRId64
+            " => is_first_timer=%s",
+            static_cast<int>(wheel - g_wheels),
+            head_level(timer->heap_index & HEAD_INDEX_MASK), wheel->current,
+            is_first_timer ? "true" : "false");
+  }
+  gpr_mu_unlock(&wheel->mu);
+
+  /* As in the heap based implementation there is an unlocked region here: a
+     concurrent grpc_timer_check may already have recomputed the global
+     minimum (possibly firing this timer), in which case lowering it again is
+     a harmless spurious wakeup. */
+  if (is_first_timer) {
+    gpr_mu_lock(&g_shared_mutables.mu);
+    if (fire_at < g_shared_mutables.min_timer.Load(
+                      grpc_core::MemoryOrder::RELAXED)) {
+      g_shared_mutables.min_timer.Store(fire_at,
+                                        grpc_core::MemoryOrder::RELAXED);
+      grpc_kick_poller();
+    }
+    gpr_mu_unlock(&g_shared_mutables.mu);
+  }
+}
+
+static void timer_consume_kick(void) {}
+
+static void timer_cancel(grpc_timer* timer) {
+  if (!g_shared_mutables.initialized) {
+    /* must have already been cancelled, also the wheel mutex is invalid */
+    return;
+  }
+
+  uint32_t wheel_index = timer->heap_index >> HEAD_INDEX_BITS;
+  if (wheel_index >= g_num_wheels) {
+    /* never made it into a wheel: fired or failed in timer_init */
+    return;
+  }
+  timer_wheel* wheel = &g_wheels[wheel_index];
+  gpr_mu_lock(&wheel->mu);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+    gpr_log(GPR_INFO, "TIMER %p: CANCEL pending=%s", timer,
+            timer->pending ? "true" : "false");
+  }
+
+  if (timer->pending) {
+    uint32_t head = timer->heap_index & HEAD_INDEX_MASK;
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure,
+                            GRPC_ERROR_CANCELLED);
+    timer->pending = false;
+    list_remove(wheel, head, timer);
+    wheel->level_count[head_level(head)]--;
+    wheel->count--;
+  }
+  gpr_mu_unlock(&wheel->mu);
+}
+
+static grpc_timer_check_result advance_wheels(grpc_millis now,
+                                              grpc_millis* next,
+                                              grpc_error* error) {
+  grpc_timer_check_result result = GRPC_TIMERS_NOT_CHECKED;
+
+  if (gpr_spinlock_trylock(&g_shared_mutables.checker_mu)) {
+    gpr_mu_lock(&g_shared_mutables.mu);
+    result = GRPC_TIMERS_CHECKED_AND_EMPTY;
+
+    grpc_millis min_timer = GRPC_MILLIS_INF_FUTURE;
+    for (uint32_t i = 0; i < g_num_wheels; i++) {
+      timer_wheel* wheel = &g_wheels[i];
+      gpr_mu_lock(&wheel->mu);
+      if (wheel->min_deadline <= now) {
+        size_t fired = advance_wheel(wheel, now, error);
+        if (fired > 0) result = GRPC_TIMERS_FIRED;
+        grpc_millis new_min_deadline = compute_min_deadline(wheel);
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+          gpr_log(GPR_INFO,
+                  "  .. wheel[%d] fired %" PRIuPTR ", min_deadline %" PRId64
+                  " --> %" PRId64 ", now=%" PRId64,
+                  static_cast<int>(i), fired, wheel->min_deadline,
+                  new_min_deadline, now);
+        }
+        wheel->min_deadline = new_min_deadline;
+      }
+      min_timer = GPR_MIN(min_timer, wheel->min_deadline);
+      gpr_mu_unlock(&wheel->mu);
+    }
+
+    if (next) {
+      *next = GPR_MIN(*next, min_timer);
+    }
+    g_shared_mutables.min_timer.Store(min_timer,
+                                      grpc_core::MemoryOrder::RELAXED);
+    gpr_mu_unlock(&g_shared_mutables.mu);
+    gpr_spinlock_unlock(&g_shared_mutables.checker_mu);
+  }
+
+  GRPC_ERROR_UNREF(error);
+
+  return result;
+}
+
+static grpc_timer_check_result timer_check(grpc_millis* next) {
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  grpc_millis min_timer =
+      g_shared_mutables.min_timer.Load(grpc_core::MemoryOrder::RELAXED);
+
+  if (now < min_timer) {
+    if (next != nullptr) {
+      *next = GPR_MIN(*next, min_timer);
+    }
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+      gpr_log(GPR_INFO, "TIMER CHECK SKIP: now=%" PRId64 " min_timer=%" PRId64,
+              now, min_timer);
+    }
+    return GRPC_TIMERS_CHECKED_AND_EMPTY;
+  }
+
+  grpc_error* shutdown_error =
+      now != GRPC_MILLIS_INF_FUTURE
+          ? GRPC_ERROR_NONE
+          : GRPC_ERROR_CREATE_FROM_STATIC_STRING("Shutting down timer system");
+
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+    gpr_log(GPR_INFO, "TIMER CHECK BEGIN: now=%" PRId64 " min=%" PRId64, now,
+            min_timer);
+  }
+  grpc_timer_check_result r = advance_wheels(now, next, shutdown_error);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+    gpr_log(GPR_INFO, "TIMER CHECK END: r=%d", r);
+  }
+  return r;
+}
+
+grpc_timer_vtable grpc_wheel_timer_vtable = {
+    timer_init,      timer_cancel,        timer_check,
+    timer_list_init, timer_list_shutdown, timer_consume_kick};
@@ -0,0 +1,40 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_IOMGR_TIMER_WHEEL_H
+#define GRPC_CORE_LIB_IOMGR_TIMER_WHEEL_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/global_config.h"
+#include "src/core/lib/iomgr/timer.h"
+
+GPR_GLOBAL_CONFIG_DECLARE_BOOL(grpc_experimental_timer_wheel);
+
+/* Hierarchical timing wheel implementation of grpc_timer_vtable.
+
+   Timers are hashed into one wheel per CPU (picked by the CPU the calling
+   ExecCtx started on), each guarded by its own mutex. A wheel has a 256 slot
+   level of 1ms ticks followed by three 64 slot levels of coarser granularity
+   and an overflow list for deadlines more than ~18 hours away, so that
+   grpc_timer_init and grpc_timer_cancel are O(1) regardless of how many
+   timers are pending. Expired timers are found by advancing the wheels in
+   grpc_timer_check and cascading coarser slots down as they come due. */
+extern grpc_timer_vtable grpc_wheel_timer_vtable;
+
+#endif /* GRPC_CORE_LIB_IOMGR_TIMER_WHEEL_H */
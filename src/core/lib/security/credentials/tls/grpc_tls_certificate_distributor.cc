@@ -24,6 +24,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "src/core/tsi/ssl_transport_security.h"
+
 void grpc_tls_certificate_distributor::SetKeyMaterials(
     const std::string& cert_name, absl::optional<std::string> pem_root_certs,
     absl::optional<PemKeyCertPairList> pem_key_cert_pairs) {
@@ -31,6 +33,8 @@ void grpc_tls_certificate_distributor::SetKeyMaterials(
   grpc_core::MutexLock lock(&mu_);
   auto& cert_info = certificate_info_map_[cert_name];
   if (pem_root_certs.has_value()) {
+    // Chains verified against the previous roots must be verified again.
+    tsi_ssl_peer_verification_cache_flush();
     // Successful credential updates will clear any pre-existing error.
     cert_info.SetRootError(GRPC_ERROR_NONE);
     for (auto* watcher_ptr : cert_info.root_cert_watchers) {
@@ -31,6 +31,7 @@
 
 #include "src/core/ext/transport/chttp2/alpn/alpn.h"
 #include "src/core/lib/channel/handshaker.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/host_port.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -288,6 +289,14 @@ class grpc_ssl_server_security_connector
   void check_peer(tsi_peer peer, grpc_endpoint* /*ep*/,
                   grpc_core::RefCountedPtr<grpc_auth_context>* auth_context,
                   grpc_closure* on_peer_checked) override {
+    const tsi_peer_property* reused = tsi_peer_get_property_by_name(
+        &peer, TSI_SSL_SESSION_REUSED_PEER_PROPERTY);
+    if (reused != nullptr &&
+        absl::string_view(reused->value.data, reused->value.length) == "true") {
+      GRPC_STATS_INC_TLS_SERVER_RESUMED_HANDSHAKES();
+    } else {
+      GRPC_STATS_INC_TLS_SERVER_FULL_HANDSHAKES();
+    }
     grpc_error* error = ssl_check_peer(nullptr, &peer, auth_context);
     tsi_peer_destruct(&peer);
     grpc_core::ExecCtx::Run(DEBUG_LOCATION, on_peer_checked, error);
@@ -30,6 +30,7 @@
 
 #include "src/core/ext/transport/chttp2/alpn/alpn.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/host_port.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -83,6 +84,31 @@ static void init_cipher_suites(void) {
   cipher_suites = value.release();
 }
 
+/* -- Peer verification cache. -- */
+
+static gpr_once peer_verification_cache_once = GPR_ONCE_INIT;
+
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_ssl_peer_verification_cache_size, 0,
+    "Number of verified peer certificate chains to cache. 0 disables the "
+    "cache.")
+
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_ssl_peer_verification_cache_ttl_seconds, 300,
+    "Number of seconds a verified peer certificate chain stays cached.")
+
+static void init_peer_verification_cache(void) {
+  int32_t size = GPR_GLOBAL_CONFIG_GET(grpc_ssl_peer_verification_cache_size);
+  int32_t ttl_seconds =
+      GPR_GLOBAL_CONFIG_GET(grpc_ssl_peer_verification_cache_ttl_seconds);
+  if (size <= 0) return;
+  if (tsi_ssl_set_peer_verification_cache_options(
+          static_cast<size_t>(size), ttl_seconds) != TSI_OK) {
+    gpr_log(GPR_ERROR, "Invalid peer verification cache ttl: %d seconds.",
+            ttl_seconds);
+  }
+}
+
 /* --- Util --- */
 
 const char* grpc_get_ssl_cipher_suites(void) {
@@ -299,6 +325,13 @@ grpc_core::RefCountedPtr<grpc_auth_context> grpc_ssl_peer_to_auth_context(
       grpc_auth_context_add_property(ctx.get(),
                                      GRPC_SSL_SESSION_REUSED_PROPERTY,
                                      prop->value.data, prop->value.length);
+    } else if (strcmp(prop->name,
+                      TSI_SSL_PEER_VERIFICATION_CACHED_PEER_PROPERTY) == 0) {
+      if (strncmp(prop->value.data, "true", prop->value.length) == 0) {
+        GRPC_STATS_INC_TLS_PEER_VERIFICATION_CACHE_HITS();
+      } else {
+        GRPC_STATS_INC_TLS_PEER_VERIFICATION_CACHE_MISSES();
+      }
     } else if (strcmp(prop->name, TSI_SECURITY_LEVEL_PEER_PROPERTY) == 0) {
       grpc_auth_context_add_property(
           ctx.get(), GRPC_TRANSPORT_SECURITY_LEVEL_PROPERTY_NAME,
@@ -409,6 +442,7 @@ grpc_security_status grpc_ssl_tsi_client_handshaker_factory_init(
   bool has_key_cert_pair = pem_key_cert_pair != nullptr &&
                            pem_key_cert_pair->private_key != nullptr &&
                            pem_key_cert_pair->cert_chain != nullptr;
+  gpr_once_init(&peer_verification_cache_once, init_peer_verification_cache);
   tsi_ssl_client_handshaker_options options;
   GPR_DEBUG_ASSERT(root_certs != nullptr);
   options.pem_root_certs = root_certs;
@@ -442,6 +476,7 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
     grpc_ssl_client_certificate_request_type client_certificate_request,
     tsi_tls_version min_tls_version, tsi_tls_version max_tls_version,
     tsi_ssl_server_handshaker_factory** handshaker_factory) {
+  gpr_once_init(&peer_verification_cache_once, init_peer_verification_cache);
   size_t num_alpn_protocols = 0;
   const char** alpn_protocol_strings =
       grpc_fill_alpn_protocol_strings(&num_alpn_protocols);
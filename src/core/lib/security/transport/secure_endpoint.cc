@@ -65,6 +65,11 @@ struct secure_endpoint {
                             grpc_slice_ref_internal(leftover_slices[i]));
     }
     grpc_slice_buffer_init(&output_buffer);
+    /* The zero-copy protector works on the slice buffers directly. */
+    if (zero_copy_protector == nullptr) {
+      read_staging_buffer = GRPC_SLICE_MALLOC(STAGING_BUFFER_SIZE);
+      write_staging_buffer = GRPC_SLICE_MALLOC(STAGING_BUFFER_SIZE);
+    }
     gpr_ref_init(&ref, 1);
   }
 
@@ -94,8 +99,8 @@ struct secure_endpoint {
   /* saved handshaker leftover data to unprotect. */
   grpc_slice_buffer leftover_bytes;
   /* buffers for read and write */
-  grpc_slice read_staging_buffer = GRPC_SLICE_MALLOC(STAGING_BUFFER_SIZE);
-  grpc_slice write_staging_buffer = GRPC_SLICE_MALLOC(STAGING_BUFFER_SIZE);
+  grpc_slice read_staging_buffer = grpc_empty_slice();
+  grpc_slice write_staging_buffer = grpc_empty_slice();
   grpc_slice_buffer output_buffer;
 
   gpr_refcount ref;
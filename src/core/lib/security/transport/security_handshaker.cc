@@ -26,24 +26,48 @@
 
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
+#include <grpc/support/sync.h>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/handshaker.h"
 #include "src/core/lib/channel/handshaker_registry.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/iomgr/executor/threadpool.h"
+#include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/security/context/security_context.h"
 #include "src/core/lib/security/transport/secure_endpoint.h"
 #include "src/core/lib/security/transport/tsi_error.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/transport_security_grpc.h"
 
+#ifdef GRPC_POSIX_SOCKET_TCP
+#include "src/core/lib/iomgr/tcp_posix.h"
+#endif
+
 #define GRPC_INITIAL_HANDSHAKE_BUFFER_SIZE 256
+#define GRPC_DEFAULT_HANDSHAKE_THREAD_POOL_QUEUE_LIMIT 1024
 
 namespace grpc_core {
 
 namespace {
 
+// Runs the handshake steps of the handshakers created with
+// GRPC_ARG_SECURITY_HANDSHAKE_THREAD_POOL. Created on first use and never
+// destroyed.
+gpr_once g_handshake_thread_pool_once = GPR_ONCE_INIT;
+ThreadPool* g_handshake_thread_pool = nullptr;
+
+void InitHandshakeThreadPool() {
+  // Certificate parsing and verification need more stack than the 64KB
+  // ThreadPool threads get by default. The threads never exit, so they are
+  // not tracked, as fork support would otherwise wait for them forever.
+  g_handshake_thread_pool = new ThreadPool(
+      gpr_cpu_num_cores(), "grpc_handshake",
+      Thread::Options().set_stack_size(1024 * 1024).set_tracked(false));
+}
+
 class SecurityHandshaker : public Handshaker {
  public:
   SecurityHandshaker(tsi_handshaker* handshaker,
@@ -57,8 +81,19 @@ class SecurityHandshaker : public Handshaker {
   const char* name() const override { return "security"; }
 
  private:
+  // Step of the TSI handshaker waiting for a thread of the handshake pool.
+  struct HandshakerNextJob : public grpc_experimental_completion_queue_functor {
+    SecurityHandshaker* handshaker;
+    const unsigned char* bytes_received;
+    size_t bytes_received_size;
+  };
+
   grpc_error* DoHandshakerNextLocked(const unsigned char* bytes_received,
                                      size_t bytes_received_size);
+  grpc_error* CallHandshakerNextLocked(const unsigned char* bytes_received,
+                                       size_t bytes_received_size);
+  static void RunHandshakerNextJob(
+      grpc_experimental_completion_queue_functor* functor, int ok);
 
   grpc_error* OnHandshakeNextDoneLocked(
       tsi_result result, const unsigned char* bytes_to_send,
@@ -77,6 +112,8 @@ class SecurityHandshaker : public Handshaker {
       size_t bytes_to_send_size, tsi_handshaker_result* handshaker_result);
   static void OnPeerCheckedFn(void* arg, grpc_error* error);
   void OnPeerCheckedInner(grpc_error* error);
+  tsi_result OffloadRecordProtectionLocked();
+  grpc_error* CreateSecureEndpointLocked();
   size_t MoveReadBufferIntoHandshakeBuffer();
   grpc_error* CheckPeerLocked();
 
@@ -104,6 +141,10 @@ class SecurityHandshaker : public Handshaker {
   RefCountedPtr<grpc_auth_context> auth_context_;
   tsi_handshaker_result* handshaker_result_ = nullptr;
   size_t max_frame_size_ = 0;
+  bool tls_kernel_offload_ = false;
+  bool use_handshake_thread_pool_ = false;
+  int handshake_thread_pool_queue_limit_;
+  HandshakerNextJob next_job_;
 };
 
 SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
@@ -120,6 +161,21 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
     max_frame_size_ = grpc_channel_arg_get_integer(
         arg, {0, 0, std::numeric_limits<int>::max()});
   }
+  tls_kernel_offload_ =
+      grpc_channel_args_find_bool(args, GRPC_ARG_TLS_KERNEL_OFFLOAD, false);
+  use_handshake_thread_pool_ = grpc_channel_args_find_bool(
+      args, GRPC_ARG_SECURITY_HANDSHAKE_THREAD_POOL, false);
+  handshake_thread_pool_queue_limit_ = grpc_channel_args_find_integer(
+      args, GRPC_ARG_SECURITY_HANDSHAKE_THREAD_POOL_QUEUE_LIMIT,
+      {GRPC_DEFAULT_HANDSHAKE_THREAD_POOL_QUEUE_LIMIT, 0,
+       std::numeric_limits<int>::max()});
+  if (use_handshake_thread_pool_) {
+    gpr_once_init(&g_handshake_thread_pool_once, InitHandshakeThreadPool);
+  }
+  next_job_.functor_run = &SecurityHandshaker::RunHandshakerNextJob;
+  next_job_.inlineable = false;
+  next_job_.internal_success = 1;
+  next_job_.handshaker = this;
   gpr_mu_init(&mu_);
   grpc_slice_buffer_init(&outgoing_);
   GRPC_CLOSURE_INIT(&on_peer_checked_, &SecurityHandshaker::OnPeerCheckedFn,
@@ -201,24 +257,35 @@ void SecurityHandshaker::HandshakeFailedLocked(grpc_error* error) {
   ExecCtx::Run(DEBUG_LOCATION, on_handshake_done_, error);
 }
 
-void SecurityHandshaker::OnPeerCheckedInner(grpc_error* error) {
-  MutexLock lock(&mu_);
-  if (error != GRPC_ERROR_NONE || is_shutdown_) {
-    HandshakeFailedLocked(error);
-    return;
-  }
+// Hands record protection to the kernel TLS implementation of the socket
+// underneath args_->endpoint, which can then be used as is.
+tsi_result SecurityHandshaker::OffloadRecordProtectionLocked() {
+#ifdef GRPC_POSIX_SOCKET_TCP
+  // Only a bare TCP endpoint writes plaintext straight to its socket: the fd
+  // of e.g. a secure endpoint already carries records of another protector.
+  if (!grpc_is_tcp_endpoint(args_->endpoint)) return TSI_UNIMPLEMENTED;
+  int fd = grpc_tcp_fd(args_->endpoint);
+  if (fd < 0) return TSI_UNIMPLEMENTED;
+  tsi_result result =
+      tsi_handshaker_result_offload_record_protection(handshaker_result_, fd);
+  if (result == TSI_OK) grpc_tcp_set_kernel_tls(args_->endpoint);
+  return result;
+#else
+  return TSI_UNIMPLEMENTED;
+#endif
+}
+
+grpc_error* SecurityHandshaker::CreateSecureEndpointLocked() {
   // Create zero-copy frame protector, if implemented.
   tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
   tsi_result result = tsi_handshaker_result_create_zero_copy_grpc_protector(
       handshaker_result_, max_frame_size_ == 0 ? nullptr : &max_frame_size_,
       &zero_copy_protector);
   if (result != TSI_OK && result != TSI_UNIMPLEMENTED) {
-    error = grpc_set_tsi_error_result(
+    return grpc_set_tsi_error_result(
         GRPC_ERROR_CREATE_FROM_STATIC_STRING(
             "Zero-copy frame protector creation failed"),
         result);
-    HandshakeFailedLocked(error);
-    return;
   }
   // Create frame protector if zero-copy frame protector is NULL.
   tsi_frame_protector* protector = nullptr;
@@ -227,11 +294,9 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error* error) {
         handshaker_result_, max_frame_size_ == 0 ? nullptr : &max_frame_size_,
         &protector);
     if (result != TSI_OK) {
-      error = grpc_set_tsi_error_result(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
-                                            "Frame protector creation failed"),
-                                        result);
-      HandshakeFailedLocked(error);
-      return;
+      return grpc_set_tsi_error_result(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                                           "Frame protector creation failed"),
+                                       result);
     }
   }
   // Get unused bytes.
@@ -250,6 +315,34 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error* error) {
     args_->endpoint = grpc_secure_endpoint_create(
         protector, zero_copy_protector, args_->endpoint, nullptr, 0);
   }
+  return GRPC_ERROR_NONE;
+}
+
+void SecurityHandshaker::OnPeerCheckedInner(grpc_error* error) {
+  MutexLock lock(&mu_);
+  if (error != GRPC_ERROR_NONE || is_shutdown_) {
+    HandshakeFailedLocked(error);
+    return;
+  }
+  tsi_result result = TSI_UNIMPLEMENTED;
+  if (tls_kernel_offload_) {
+    result = OffloadRecordProtectionLocked();
+    if (result != TSI_OK && result != TSI_UNIMPLEMENTED) {
+      error = grpc_set_tsi_error_result(
+          GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+              "Kernel record protection offload failed"),
+          result);
+      HandshakeFailedLocked(error);
+      return;
+    }
+  }
+  if (result != TSI_OK) {
+    error = CreateSecureEndpointLocked();
+    if (error != GRPC_ERROR_NONE) {
+      HandshakeFailedLocked(error);
+      return;
+    }
+  }
   tsi_handshaker_result_destroy(handshaker_result_);
   handshaker_result_ = nullptr;
   // Add auth context to channel args.
@@ -357,6 +450,43 @@ void SecurityHandshaker::OnHandshakeNextDoneGrpcWrapper(
 
 grpc_error* SecurityHandshaker::DoHandshakerNextLocked(
     const unsigned char* bytes_received, size_t bytes_received_size) {
+  if (!use_handshake_thread_pool_) {
+    return CallHandshakerNextLocked(bytes_received, bytes_received_size);
+  }
+  // Rather than letting the backlog grow past the point where the handshakes
+  // at its end time out anyway, fail so that the peer backs off.
+  if (g_handshake_thread_pool->num_pending_closures() >=
+      handshake_thread_pool_queue_limit_) {
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "Handshake thread pool queue is full");
+  }
+  // Our ref is passed on to the job.
+  next_job_.bytes_received = bytes_received;
+  next_job_.bytes_received_size = bytes_received_size;
+  g_handshake_thread_pool->Add(&next_job_);
+  return GRPC_ERROR_NONE;
+}
+
+void SecurityHandshaker::RunHandshakerNextJob(
+    grpc_experimental_completion_queue_functor* functor, int /*ok*/) {
+  HandshakerNextJob* job = static_cast<HandshakerNextJob*>(functor);
+  ExecCtx exec_ctx;
+  RefCountedPtr<SecurityHandshaker> h(job->handshaker);
+  MutexLock lock(&h->mu_);
+  grpc_error* error =
+      h->is_shutdown_
+          ? GRPC_ERROR_CREATE_FROM_STATIC_STRING("Handshaker shutdown")
+          : h->CallHandshakerNextLocked(job->bytes_received,
+                                        job->bytes_received_size);
+  if (error != GRPC_ERROR_NONE) {
+    h->HandshakeFailedLocked(error);
+  } else {
+    h.release();  // Avoid unref
+  }
+}
+
+grpc_error* SecurityHandshaker::CallHandshakerNextLocked(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
   // Invoke TSI handshaker.
   const unsigned char* bytes_to_send = nullptr;
   size_t bytes_to_send_size = 0;
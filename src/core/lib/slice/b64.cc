@@ -29,6 +29,11 @@
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/slice/slice_internal.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GRPC_BASE64_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
 /* --- Constants. --- */
 
 static const int8_t base64_bytes[] = {
@@ -86,8 +91,27 @@ void grpc_base64_encode_core(char* result, const void* vdata, size_t data_size,
   size_t num_blocks = 0;
   size_t i = 0;
 
-  /* Encode each block. */
+  /* Encode each block, in bulk at the start of each line where possible. */
   while (data_size >= 3) {
+    if (num_blocks == 0) {
+      const size_t encoded = grpc_base64_encode_blocks(
+          current, data + i,
+          multiline
+              ? GPR_MIN(data_size, 3 * GRPC_BASE64_MULTILINE_NUM_BLOCKS)
+              : data_size,
+          url_safe);
+      current += encoded / 3 * 4;
+      data_size -= encoded;
+      i += encoded;
+      num_blocks = encoded / 3;
+      if (multiline && num_blocks == GRPC_BASE64_MULTILINE_NUM_BLOCKS) {
+        *current++ = '\r';
+        *current++ = '\n';
+        num_blocks = 0;
+        continue;
+      }
+      if (data_size < 3) break;
+    }
     *current++ = base64_chars[(data[i] >> 2) & 0x3F];
     *current++ =
         base64_chars[((data[i] & 0x03) << 4) | ((data[i + 1] >> 4) & 0x0F)];
@@ -196,9 +220,19 @@ grpc_slice grpc_base64_decode_with_len(const char* b64, size_t b64_len,
   unsigned char codes[4];
   size_t num_codes = 0;
 
-  while (b64_len--) {
+  while (b64_len > 0) {
+    if (num_codes == 0) {
+      /* Decode whole groups in bulk until something needs a closer look. */
+      const size_t decoded = grpc_base64_decode_blocks(current + result_size,
+                                                       b64, b64_len, url_safe);
+      b64 += decoded;
+      b64_len -= decoded;
+      result_size += decoded / 4 * 3;
+      if (b64_len == 0) break;
+    }
     unsigned char c = static_cast<unsigned char>(*b64++);
     signed char code;
+    b64_len--;
     if (c >= GPR_ARRAY_SIZE(base64_bytes)) continue;
     if (url_safe) {
       if (c == '+' || c == '/') {
@@ -237,3 +271,258 @@ fail:
   grpc_slice_unref_internal(result);
   return grpc_empty_slice();
 }
+
+/* --- Vectorized block encoder and decoder. --- */
+
+/* The kernels below follow Wojciech Mula's SSE and AVX2 base64 codecs: the
+   encoder splits each 3 byte group into four 6 bit indices with a shuffle and
+   two multiplies and maps them onto the alphabet with a shuffled offset table;
+   the decoder classifies characters by nibble to validate a whole vector at
+   once, maps them back onto 6 bit values and packs those with two
+   multiply-adds. They are compiled for their instruction sets with target
+   attributes and picked at runtime, so builds need no special flags. */
+
+static int g_simd_limit = 2;
+
+void grpc_base64_limit_simd_for_testing(int level) { g_simd_limit = level; }
+
+#ifdef GRPC_BASE64_X86_SIMD
+
+static int simd_level() {
+  int level = 0;
+  if (__builtin_cpu_supports("avx2")) {
+    level = 2;
+  } else if (__builtin_cpu_supports("sse4.1")) {
+    level = 1;
+  }
+  return GPR_MIN(level, g_simd_limit);
+}
+
+/* offsets from a 6 bit index to its character, indexed by the selector
+   computed in encode_sse41() */
+__attribute__((target("sse4.1"))) static __m128i encode_offsets_sse41(
+    int url_safe) {
+  return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, url_safe ? '-' - 62 : '+' - 62,
+                       url_safe ? '_' - 63 : '/' - 63, 'A', 0, 0);
+}
+
+/* encodes the first 12 bytes of in into 16 characters */
+__attribute__((target("sse4.1"))) static __m128i encode_sse41(
+    __m128i in, __m128i offsets) {
+  in = _mm_shuffle_epi8(
+      in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  const __m128i indices = _mm_or_si128(t1, t3);
+  /* 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12 */
+  __m128i selector = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  selector = _mm_or_si128(selector, _mm_and_si128(upper, _mm_set1_epi8(13)));
+  return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, selector));
+}
+
+__attribute__((target("sse4.1"))) static size_t encode_blocks_sse41(
+    char* result, const unsigned char* data, size_t data_size, int url_safe) {
+  const __m128i offsets = encode_offsets_sse41(url_safe);
+  size_t i = 0;
+  /* each iteration loads 16 bytes but only encodes the first 12 */
+  for (; i + 16 <= data_size; i += 12) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(result + i / 3 * 4),
+                     encode_sse41(in, offsets));
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) static __m256i broadcast_avx2(__m128i x) {
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(x), x, 1);
+}
+
+__attribute__((target("avx2"))) static size_t encode_blocks_avx2(
+    char* result, const unsigned char* data, size_t data_size, int url_safe) {
+  const __m256i shuffle = broadcast_avx2(
+      _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m256i offsets = broadcast_avx2(encode_offsets_sse41(url_safe));
+  size_t i = 0;
+  /* each iteration encodes 12 bytes from each of two overlapping 16 byte
+     loads */
+  for (; i + 28 <= data_size; i += 24) {
+    __m256i in = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 12)), 1);
+    in = _mm256_shuffle_epi8(in, shuffle);
+    const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t1, t3);
+    __m256i selector = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    selector = _mm256_or_si256(selector,
+                               _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(result + i / 3 * 4),
+        _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, selector)));
+  }
+  /* the SSE4.1 code is not VEX encoded, so leave a clean AVX state for it */
+  _mm256_zeroupper();
+  return i + encode_blocks_sse41(result + i / 3 * 4, data + i, data_size - i,
+                                 url_safe);
+}
+
+/* the lookup tables shared by the SSE4.1 and AVX2 decoders: a character is
+   valid iff the classes of its low and high nibble share no bit, and its 6 bit
+   value is the character plus the offset selected by its high nibble */
+__attribute__((target("sse4.1"))) static __m128i decode_low_classes_sse41() {
+  return _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                       0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+}
+
+__attribute__((target("sse4.1"))) static __m128i decode_high_classes_sse41() {
+  return _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10,
+                       0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+}
+
+__attribute__((target("sse4.1"))) static __m128i decode_offsets_sse41() {
+  return _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0,
+                       0);
+}
+
+__attribute__((target("sse4.1"))) static size_t decode_blocks_sse41(
+    unsigned char* result, const char* b64, size_t b64_len, int url_safe) {
+  const __m128i low_classes = decode_low_classes_sse41();
+  const __m128i high_classes = decode_high_classes_sse41();
+  const __m128i offsets = decode_offsets_sse41();
+  const __m128i nibble = _mm_set1_epi8(0x0f);
+  size_t i = 0;
+  for (; i + 16 <= b64_len; i += 16) {
+    __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b64 + i));
+    if (url_safe) {
+      /* reject '+' and '/', then map '-' and '_' onto them */
+      const __m128i standard =
+          _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('+')),
+                       _mm_cmpeq_epi8(in, _mm_set1_epi8('/')));
+      if (!_mm_testz_si128(standard, standard)) break;
+      in = _mm_add_epi8(
+          in, _mm_and_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('-')),
+                            _mm_set1_epi8('+' - '-')));
+      in = _mm_add_epi8(
+          in, _mm_and_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('_')),
+                            _mm_set1_epi8('/' - '_')));
+    }
+    const __m128i high = _mm_and_si128(_mm_srli_epi32(in, 4), nibble);
+    const __m128i low = _mm_and_si128(in, nibble);
+    if (!_mm_testz_si128(_mm_shuffle_epi8(low_classes, low),
+                         _mm_shuffle_epi8(high_classes, high))) {
+      break;
+    }
+    /* '/' shares its high nibble with '+' but needs a different offset */
+    const __m128i slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+    const __m128i values = _mm_add_epi8(
+        in, _mm_shuffle_epi8(offsets, _mm_add_epi8(slash, high)));
+    const __m128i pairs =
+        _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i out = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    out = _mm_shuffle_epi8(out, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14,
+                                              13, 12, -1, -1, -1, -1));
+    unsigned char* dst = result + i / 4 * 3;
+    const uint32_t last = static_cast<uint32_t>(_mm_extract_epi32(out, 2));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), out);
+    memcpy(dst + 8, &last, sizeof(last));
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) static size_t decode_blocks_avx2(
+    unsigned char* result, const char* b64, size_t b64_len, int url_safe) {
+  const __m256i low_classes = broadcast_avx2(decode_low_classes_sse41());
+  const __m256i high_classes = broadcast_avx2(decode_high_classes_sse41());
+  const __m256i offsets = broadcast_avx2(decode_offsets_sse41());
+  const __m256i nibble = _mm256_set1_epi8(0x0f);
+  const __m256i pack = broadcast_avx2(_mm_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  size_t i = 0;
+  for (; i + 32 <= b64_len; i += 32) {
+    __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b64 + i));
+    if (url_safe) {
+      const __m256i standard =
+          _mm256_or_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('+')),
+                          _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/')));
+      if (!_mm256_testz_si256(standard, standard)) break;
+      in = _mm256_add_epi8(
+          in, _mm256_and_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('-')),
+                               _mm256_set1_epi8('+' - '-')));
+      in = _mm256_add_epi8(
+          in, _mm256_and_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('_')),
+                               _mm256_set1_epi8('/' - '_')));
+    }
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi32(in, 4), nibble);
+    const __m256i low = _mm256_and_si256(in, nibble);
+    if (!_mm256_testz_si256(_mm256_shuffle_epi8(low_classes, low),
+                            _mm256_shuffle_epi8(high_classes, high))) {
+      break;
+    }
+    const __m256i slash = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/'));
+    const __m256i values = _mm256_add_epi8(
+        in, _mm256_shuffle_epi8(offsets, _mm256_add_epi8(slash, high)));
+    const __m256i pairs =
+        _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    __m256i out = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    /* pack the 12 bytes from each lane next to each other */
+    out = _mm256_permutevar8x32_epi32(
+        _mm256_shuffle_epi8(out, pack),
+        _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    unsigned char* dst = result + i / 4 * 3;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     _mm256_castsi256_si128(out));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 16),
+                     _mm256_extracti128_si256(out, 1));
+  }
+  _mm256_zeroupper();
+  return i + decode_blocks_sse41(result + i / 4 * 3, b64 + i, b64_len - i,
+                                 url_safe);
+}
+
+size_t grpc_base64_encode_blocks(char* result, const unsigned char* data,
+                                 size_t data_size, int url_safe) {
+  switch (simd_level()) {
+    case 2:
+      return encode_blocks_avx2(result, data, data_size, url_safe);
+    case 1:
+      return encode_blocks_sse41(result, data, data_size, url_safe);
+  }
+  return 0;
+}
+
+size_t grpc_base64_decode_blocks(unsigned char* result, const char* b64,
+                                 size_t b64_len, int url_safe) {
+  switch (simd_level()) {
+    case 2:
+      return decode_blocks_avx2(result, b64, b64_len, url_safe);
+    case 1:
+      return decode_blocks_sse41(result, b64, b64_len, url_safe);
+  }
+  return 0;
+}
+
+#else /* GRPC_BASE64_X86_SIMD */
+
+size_t grpc_base64_encode_blocks(char* /*result*/,
+                                 const unsigned char* /*data*/,
+                                 size_t /*data_size*/, int /*url_safe*/) {
+  return 0;
+}
+
+size_t grpc_base64_decode_blocks(unsigned char* /*result*/,
+                                 const char* /*b64*/, size_t /*b64_len*/,
+                                 int /*url_safe*/) {
+  return 0;
+}
+
+#endif /* GRPC_BASE64_X86_SIMD */
@@ -47,4 +47,27 @@ grpc_slice grpc_base64_decode(const char* b64, int url_safe);
 grpc_slice grpc_base64_decode_with_len(const char* b64, size_t b64_len,
                                        int url_safe);
 
+/* Encodes the longest prefix of data made of whole 3 byte groups that the
+   vectorized encoders available on this CPU can take, writing 4 characters per
+   group to result without padding. Returns the number of bytes of data
+   consumed: a multiple of 3 that is 0 when no vectorized encoder is available
+   or data is too short. Callers encode the remainder themselves. */
+size_t grpc_base64_encode_blocks(char* result, const unsigned char* data,
+                                 size_t data_size, int url_safe);
+
+/* Decodes the longest prefix of b64 made of whole 4 character groups of the
+   (url safe, if requested) base64 alphabet that the vectorized decoders
+   available on this CPU can take, writing 3 bytes per group to result.
+   Padding, line breaks and invalid characters stop the decoder. Returns the
+   number of characters consumed, a multiple of 4 that may be 0; callers decode
+   the remainder, and report any error, with their own decoder. result must
+   have room for 3 * (b64_len / 4) bytes. */
+size_t grpc_base64_decode_blocks(unsigned char* result, const char* b64,
+                                 size_t b64_len, int url_safe);
+
+/* For testing only: caps the instruction set used by the block encoder and
+   decoder above (0: none, 1: SSE4.1, 2: AVX2). Levels the CPU does not support
+   are never used regardless. */
+void grpc_base64_limit_simd_for_testing(int level);
+
 #endif /* GRPC_CORE_LIB_SLICE_B64_H */
@@ -38,16 +38,28 @@
 #define SHARD_COUNT (1 << LOG2_SHARD_COUNT)
 #define INITIAL_SHARD_CAPACITY 8
 
+/* Unlinked strings are freed in batches of this many, so that the grace
+   period waiting out concurrent lookups is paid once per batch. */
+#define RETIRE_BATCH 16
+
 #define TABLE_IDX(hash, capacity) (((hash) >> LOG2_SHARD_COUNT) % (capacity))
 #define SHARD_IDX(hash) ((hash) & ((1 << LOG2_SHARD_COUNT) - 1))
 
 using grpc_core::InternedSliceRefcount;
 
+typedef grpc_core::Atomic<InternedSliceRefcount*> slice_bucket;
+
 typedef struct slice_shard {
   gpr_mu mu;
-  InternedSliceRefcount** strs;
+  /* slice_bucket array and its size. Lookups read both without the lock:
+     strs is always published before capacity, and capacity only grows. */
+  gpr_atm strs;
+  gpr_atm capacity;
   size_t count;
-  size_t capacity;
+  /* unlinked, but possibly still visible to a lock-free lookup */
+  InternedSliceRefcount* retired[RETIRE_BATCH];
+  size_t retired_count;
+  grpc_core::InternTableReaders readers;
 } slice_shard;
 
 static slice_shard g_shards[SHARD_COUNT];
@@ -61,23 +73,67 @@ static static_metadata_hash_ent
 static uint32_t max_static_metadata_hash_probe;
 uint32_t grpc_static_metadata_hash_values[GRPC_STATIC_MDSTR_COUNT];
 
+static slice_bucket* shard_strs(slice_shard* shard) {
+  return reinterpret_cast<slice_bucket*>(gpr_atm_acq_load(&shard->strs));
+}
+
+static size_t shard_capacity(slice_shard* shard) {
+  return static_cast<size_t>(gpr_atm_acq_load(&shard->capacity));
+}
+
+static void free_retired_locked(slice_shard* shard) {
+  shard->readers.Synchronize();
+  for (size_t i = 0; i < shard->retired_count; i++) {
+    shard->retired[i]->~InternedSliceRefcount();
+    gpr_free(shard->retired[i]);
+  }
+  shard->retired_count = 0;
+}
+
 namespace grpc_core {
 
 /* hash seed: decided at initialization time */
 uint32_t g_hash_seed;
 static bool g_forced_hash_seed = false;
 
-InternedSliceRefcount::~InternedSliceRefcount() {
-  slice_shard* shard = &g_shards[SHARD_IDX(this->hash)];
+void InternedSliceRefcount::Destroy(void* arg) {
+  auto* rc = static_cast<InternedSliceRefcount*>(arg);
+  slice_shard* shard = &g_shards[SHARD_IDX(rc->hash)];
   MutexLock lock(&shard->mu);
-  InternedSliceRefcount** prev_next;
+  /* Unlink, but leave rc->bucket_next alone: a concurrent lookup may be
+     standing on rc and still needs to get to the rest of the chain. */
+  slice_bucket* prev_next =
+      &shard_strs(shard)[TABLE_IDX(rc->hash, shard_capacity(shard))];
   InternedSliceRefcount* cur;
-  for (prev_next = &shard->strs[TABLE_IDX(this->hash, shard->capacity)],
-      cur = *prev_next;
-       cur != this; prev_next = &cur->bucket_next, cur = cur->bucket_next)
-    ;
-  *prev_next = cur->bucket_next;
+  while ((cur = prev_next->Load(MemoryOrder::RELAXED)) != rc) {
+    prev_next = &cur->bucket_next;
+  }
+  prev_next->Store(rc->bucket_next.Load(MemoryOrder::RELAXED),
+                   MemoryOrder::RELEASE);
   shard->count--;
+  shard->retired[shard->retired_count++] = rc;
+  if (shard->retired_count == RETIRE_BATCH) {
+    free_retired_locked(shard);
+  }
+}
+
+void InternTableReaders::Synchronize() {
+  // Orders the caller's unlinks before the reader counts are sampled: a
+  // reader whose increment is not seen below is guaranteed to see them.
+  gpr_atm_full_barrier();
+  for (int flip = 0; flip < 2; flip++) {
+    const int idx = static_cast<int>(gpr_atm_full_fetch_add(&epoch_, 1) & 1);
+    for (int i = 0; i < kStripes; i++) {
+      for (int spins = 0; gpr_atm_acq_load(&stripes_[i].count[idx]) != 0;
+           spins++) {
+        /* readers are short; if one is not done yet, it got preempted */
+        if (spins > 100) {
+          gpr_sleep_until(gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                                       gpr_time_from_micros(1, GPR_TIMESPAN)));
+        }
+      }
+    }
+  }
 }
 
 }  // namespace grpc_core
@@ -85,25 +141,30 @@ InternedSliceRefcount::~InternedSliceRefcount() {
 static void grow_shard(slice_shard* shard) {
   GPR_TIMER_SCOPE("grow_strtab", 0);
 
-  size_t capacity = shard->capacity * 2;
-  size_t i;
-  InternedSliceRefcount** strtab;
+  const size_t old_capacity = shard_capacity(shard);
+  slice_bucket* old_strtab = shard_strs(shard);
+  const size_t capacity = old_capacity * 2;
+  slice_bucket* strtab = new slice_bucket[capacity];
   InternedSliceRefcount *s, *next;
 
-  strtab = static_cast<InternedSliceRefcount**>(
-      gpr_zalloc(sizeof(InternedSliceRefcount*) * capacity));
-
-  for (i = 0; i < shard->capacity; i++) {
-    for (s = shard->strs[i]; s; s = next) {
+  /* Lookups racing with the move may get diverted to another chain and miss;
+     they then retry under the lock. */
+  for (size_t i = 0; i < old_capacity; i++) {
+    for (s = old_strtab[i].Load(grpc_core::MemoryOrder::RELAXED); s;
+         s = next) {
       size_t idx = TABLE_IDX(s->hash, capacity);
-      next = s->bucket_next;
-      s->bucket_next = strtab[idx];
-      strtab[idx] = s;
+      next = s->bucket_next.Load(grpc_core::MemoryOrder::RELAXED);
+      s->bucket_next.Store(strtab[idx].Load(grpc_core::MemoryOrder::RELAXED),
+                           grpc_core::MemoryOrder::RELEASE);
+      strtab[idx].Store(s, grpc_core::MemoryOrder::RELAXED);
     }
   }
-  gpr_free(shard->strs);
-  shard->strs = strtab;
-  shard->capacity = capacity;
+  gpr_atm_rel_store(&shard->strs, reinterpret_cast<gpr_atm>(strtab));
+  gpr_atm_rel_store(&shard->capacity, static_cast<gpr_atm>(capacity));
+  /* Wait out lookups still using the old table, and drain the retired
+     strings while we are at it. */
+  free_retired_locked(shard);
+  delete[] old_strtab;
 }
 
 grpc_core::InternedSlice::InternedSlice(InternedSliceRefcount* s) {
@@ -208,17 +269,20 @@ static InternedSliceRefcount* InternNewStringLocked(slice_shard* shard,
   /* string data goes after the internal_string header */
   size_t len = GetLength(args);
   const void* buffer = GetBuffer(args);
+  slice_bucket* bucket = &shard_strs(shard)[shard_idx];
   InternedSliceRefcount* s =
       static_cast<InternedSliceRefcount*>(gpr_malloc(sizeof(*s) + len));
-  new (s) grpc_core::InternedSliceRefcount(len, hash, shard->strs[shard_idx]);
+  new (s) grpc_core::InternedSliceRefcount(
+      len, hash, bucket->Load(grpc_core::MemoryOrder::RELAXED));
   // TODO(arjunroy): Investigate why hpack tried to intern the nullptr string.
   // https://github.com/grpc/grpc/pull/20110#issuecomment-526729282
   if (len > 0) {
     memcpy(reinterpret_cast<char*>(s + 1), buffer, len);
   }
-  shard->strs[shard_idx] = s;
+  /* publishes the fully constructed string to lock-free lookups */
+  bucket->Store(s, grpc_core::MemoryOrder::RELEASE);
   shard->count++;
-  if (shard->count > shard->capacity * 2) {
+  if (shard->count > shard_capacity(shard) * 2) {
     grow_shard(shard);
   }
   return s;
@@ -226,18 +290,19 @@ static InternedSliceRefcount* InternNewStringLocked(slice_shard* shard,
 
 // Attempt to see if the provided slice or string matches an existing interned
 // slice. SliceArgs... is either a const grpc_slice& or a string and length. In
-// either case, hash is the pre-computed hash value.  We must already hold the
-// shard lock. Helper for FindOrCreateInternedSlice().
+// either case, hash is the pre-computed hash value. Safe both with and without
+// the shard lock held; without it, concurrent table growth can cause a false
+// miss. Helper for FindOrCreateInternedSlice().
 //
-// Returns: a pre-existing matching static slice, or null.
+// Returns: a pre-existing matching interned slice (reffed), or null.
 template <typename SliceArgs>
-static InternedSliceRefcount* MatchInternedSliceLocked(uint32_t hash,
-                                                       size_t idx,
-                                                       const SliceArgs& args) {
+static InternedSliceRefcount* MatchInternedSlice(slice_bucket* strs,
+                                                 uint32_t hash, size_t idx,
+                                                 const SliceArgs& args) {
   InternedSliceRefcount* s;
-  slice_shard* shard = &g_shards[SHARD_IDX(hash)];
   /* search for an existing string */
-  for (s = shard->strs[idx]; s; s = s->bucket_next) {
+  for (s = strs[idx].Load(grpc_core::MemoryOrder::ACQUIRE); s;
+       s = s->bucket_next.Load(grpc_core::MemoryOrder::ACQUIRE)) {
     if (s->hash == hash && grpc_core::InternedSlice(s) == args) {
       if (s->refcnt.RefIfNonZero()) {
         return s;
@@ -259,9 +324,19 @@ template <typename SliceArgs>
 static InternedSliceRefcount* FindOrCreateInternedSlice(uint32_t hash,
                                                         const SliceArgs& args) {
   slice_shard* shard = &g_shards[SHARD_IDX(hash)];
+  /* Most lookups hit a live string: take a ref without locking the shard.
+     capacity must be read before strs, see slice_shard. */
+  const int token = shard->readers.Enter();
+  const size_t capacity = shard_capacity(shard);
+  InternedSliceRefcount* s = MatchInternedSlice(
+      shard_strs(shard), hash, TABLE_IDX(hash, capacity), args);
+  shard->readers.Exit(token);
+  if (s != nullptr) {
+    return s;
+  }
   gpr_mu_lock(&shard->mu);
-  const size_t idx = TABLE_IDX(hash, shard->capacity);
-  InternedSliceRefcount* s = MatchInternedSliceLocked(hash, idx, args);
+  const size_t idx = TABLE_IDX(hash, shard_capacity(shard));
+  s = MatchInternedSlice(shard_strs(shard), hash, idx, args);
   if (s == nullptr) {
     s = InternNewStringLocked(shard, idx, hash, args);
   }
@@ -317,9 +392,10 @@ void grpc_slice_intern_init(void) {
     slice_shard* shard = &g_shards[i];
     gpr_mu_init(&shard->mu);
     shard->count = 0;
-    shard->capacity = INITIAL_SHARD_CAPACITY;
-    shard->strs = static_cast<InternedSliceRefcount**>(
-        gpr_zalloc(sizeof(*shard->strs) * shard->capacity));
+    shard->retired_count = 0;
+    slice_bucket* strs = new slice_bucket[INITIAL_SHARD_CAPACITY];
+    gpr_atm_rel_store(&shard->strs, reinterpret_cast<gpr_atm>(strs));
+    gpr_atm_rel_store(&shard->capacity, INITIAL_SHARD_CAPACITY);
   }
   for (size_t i = 0; i < GPR_ARRAY_SIZE(static_metadata_hash); i++) {
     static_metadata_hash[i].hash = 0;
@@ -354,12 +430,16 @@ void grpc_slice_intern_shutdown(void) {
   for (size_t i = 0; i < SHARD_COUNT; i++) {
     slice_shard* shard = &g_shards[i];
     gpr_mu_destroy(&shard->mu);
+    free_retired_locked(shard);
+    slice_bucket* strs = shard_strs(shard);
     /* TODO(ctiller): GPR_ASSERT(shard->count == 0); */
     if (shard->count != 0) {
       gpr_log(GPR_DEBUG, "WARNING: %" PRIuPTR " metadata strings were leaked",
               shard->count);
-      for (size_t j = 0; j < shard->capacity; j++) {
-        for (InternedSliceRefcount* s = shard->strs[j]; s; s = s->bucket_next) {
+      for (size_t j = 0; j < shard_capacity(shard); j++) {
+        for (InternedSliceRefcount* s =
+                 strs[j].Load(grpc_core::MemoryOrder::RELAXED);
+             s; s = s->bucket_next.Load(grpc_core::MemoryOrder::RELAXED)) {
           char* text = grpc_dump_slice(grpc_core::InternedSlice(s),
                                        GPR_DUMP_HEX | GPR_DUMP_ASCII);
           gpr_log(GPR_DEBUG, "LEAKED: %s", text);
@@ -370,6 +450,6 @@ void grpc_slice_intern_shutdown(void) {
         abort();
       }
     }
-    gpr_free(shard->strs);
+    delete[] strs;
   }
 }
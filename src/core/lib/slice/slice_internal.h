@@ -28,6 +28,7 @@
 #include <string.h>
 
 #include "src/core/lib/gpr/murmur_hash.h"
+#include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/slice/slice_utils.h"
@@ -186,13 +187,60 @@ struct StaticSliceRefcount {
 
 extern grpc_slice_refcount kNoopRefcount;
 
-struct InternedSliceRefcount {
-  static void Destroy(void* arg) {
-    auto* rc = static_cast<InternedSliceRefcount*>(arg);
-    rc->~InternedSliceRefcount();
-    gpr_free(rc);
+// Lets lookups walk the buckets of an intern table shard without taking the
+// shard lock. Readers bracket the walk with Enter()/Exit() and never block.
+// Writers hold the shard lock, unlink entries, and call Synchronize() before
+// freeing what they unlinked: it returns once every read section that could
+// still reference those entries has exited. Like SRCU, there are two reader
+// counts selected by the low bit of an epoch, and Synchronize() flips the
+// epoch twice, so that new readers never hold it up. Counts are striped to
+// keep concurrent readers off each other's cachelines.
+//
+// Zero-initialized storage is a valid initial state, so this can live in the
+// statically allocated shard arrays.
+class InternTableReaders {
+ public:
+  int Enter() {
+    const int stripe = ThisStripe();
+    const int idx = static_cast<int>(gpr_atm_no_barrier_load(&epoch_) & 1);
+    gpr_atm_no_barrier_fetch_add(&stripes_[stripe].count[idx], 1);
+    // Orders the increment before the reads of the table; pairs with the
+    // barrier at the start of Synchronize().
+    gpr_atm_full_barrier();
+    return stripe * 2 + idx;
+  }
+
+  void Exit(int token) {
+    gpr_atm_full_fetch_add(&stripes_[token / 2].count[token % 2], -1);
+  }
+
+  void Synchronize();
+
+ private:
+  static constexpr int kStripes = 8;
+
+  static int ThisStripe() {
+    // Distinct threads run on distinct stacks, which is all we need to spread
+    // them over the stripes; no thread local lookup required.
+    int marker;
+    return static_cast<int>((reinterpret_cast<uintptr_t>(&marker) >> 12) %
+                            kStripes);
   }
 
+  struct Stripe {
+    gpr_atm count[2];
+    char padding[GPR_CACHELINE_SIZE - 2 * sizeof(gpr_atm)];
+  };
+
+  gpr_atm epoch_;
+  Stripe stripes_[kStripes];
+};
+
+struct InternedSliceRefcount {
+  // Called when the last ref is dropped. Unlinks the slice from the intern
+  // table; the memory is released once no lookup can reference it anymore.
+  static void Destroy(void* arg);
+
   InternedSliceRefcount(size_t length, uint32_t hash,
                         InternedSliceRefcount* bucket_next)
       : base(grpc_slice_refcount::Type::INTERNED, &refcnt, Destroy, this, &sub),
@@ -201,14 +249,13 @@ struct InternedSliceRefcount {
         hash(hash),
         bucket_next(bucket_next) {}
 
-  ~InternedSliceRefcount();
-
   grpc_slice_refcount base;
   grpc_slice_refcount sub;
   const size_t length;
   RefCount refcnt;
   const uint32_t hash;
-  InternedSliceRefcount* bucket_next;
+  // Followed by lock-free lookups, so only ever changed with release stores.
+  Atomic<InternedSliceRefcount*> bucket_next;
 };
 
 }  // namespace grpc_core
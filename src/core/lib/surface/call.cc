@@ -139,6 +139,8 @@ struct child_call {
 struct grpc_call {
   grpc_call(grpc_core::Arena* arena, const grpc_call_create_args& args)
       : arena(arena),
+        arena_pool(args.arena_pool),
+        call_size_estimate(args.call_size_estimate),
         cq(args.cq),
         channel(args.channel),
         is_client(args.server_transport_data == nullptr),
@@ -156,6 +158,8 @@ struct grpc_call {
 
   grpc_core::RefCount ext_ref;
   grpc_core::Arena* arena;
+  grpc_core::ArenaPool* arena_pool;
+  gpr_atm* call_size_estimate;
   grpc_core::CallCombiner call_combiner;
   grpc_completion_queue* cq;
   grpc_polling_entity pollent;
@@ -218,13 +222,18 @@ struct grpc_call {
      server, it's trailing metadata */
   grpc_linked_mdelem send_extra_metadata[MAX_SEND_EXTRA_METADATA_COUNT];
   int send_extra_metadata_count;
+  /* Backing store for the grpc-status and grpc-message elements the server
+     sends, so that sending a status does not allocate them. The grpc-message
+     value stays reffed until the call is destroyed. */
+  grpc_core::ManualConstructor<grpc_mdelem_data> send_status_storage;
+  grpc_core::ManualConstructor<grpc_mdelem_data> send_message_storage;
+  bool has_send_message_storage = false;
   grpc_millis send_deadline;
 
   grpc_core::ManualConstructor<grpc_core::SliceBufferByteStream> sending_stream;
 
   grpc_core::OrphanablePtr<grpc_core::ByteStream> receiving_stream;
   grpc_byte_buffer** receiving_buffer = nullptr;
-  grpc_slice receiving_slice = grpc_empty_slice();
   grpc_closure receiving_slice_ready;
   grpc_closure receiving_stream_ready;
   grpc_closure receiving_initial_metadata_ready;
@@ -340,7 +349,8 @@ grpc_error* grpc_call_create(const grpc_call_create_args* args,
   grpc_error* error = GRPC_ERROR_NONE;
   grpc_channel_stack* channel_stack =
       grpc_channel_get_channel_stack(args->channel);
-  size_t initial_size = grpc_channel_get_call_size_estimate(args->channel);
+  size_t initial_size = grpc_channel_get_call_size_estimate(
+      args->channel, args->call_size_estimate);
   GRPC_STATS_INC_CALL_INITIAL_SIZE(initial_size);
   size_t call_and_stack_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_call)) +
@@ -349,7 +359,9 @@ grpc_error* grpc_call_create(const grpc_call_create_args* args,
       call_and_stack_size + (args->parent ? sizeof(child_call) : 0);
 
   std::pair<grpc_core::Arena*, void*> arena_with_call =
-      grpc_core::Arena::CreateWithAlloc(initial_size, call_alloc_size);
+      args->arena_pool != nullptr
+          ? args->arena_pool->CreateWithAlloc(initial_size, call_alloc_size)
+          : grpc_core::Arena::CreateWithAlloc(initial_size, call_alloc_size);
   arena = arena_with_call.first;
   call = new (arena_with_call.second) grpc_call(arena, *args);
   *out_call = call;
@@ -522,8 +534,13 @@ static void release_call(void* call, grpc_error* /*error*/) {
   grpc_call* c = static_cast<grpc_call*>(call);
   grpc_channel* channel = c->channel;
   grpc_core::Arena* arena = c->arena;
+  grpc_core::ArenaPool* arena_pool = c->arena_pool;
+  gpr_atm* call_size_estimate = c->call_size_estimate;
   c->~grpc_call();
-  grpc_channel_update_call_size_estimate(channel, arena->Destroy());
+  size_t arena_size = arena_pool != nullptr ? arena_pool->Release(arena)
+                                            : arena->Destroy();
+  grpc_channel_update_call_size_estimate(channel, arena_size,
+                                         call_size_estimate);
   GRPC_CHANNEL_INTERNAL_UNREF(channel, "call");
 }
 
@@ -544,6 +561,9 @@ static void destroy_call(void* call, grpc_error* /*error*/) {
   for (ii = 0; ii < c->send_extra_metadata_count; ii++) {
     GRPC_MDELEM_UNREF(c->send_extra_metadata[ii].md);
   }
+  if (c->has_send_message_storage) {
+    grpc_slice_unref_internal(c->send_message_storage->value);
+  }
   for (i = 0; i < GRPC_CONTEXT_COUNT; i++) {
     if (c->context[i].destroy) {
       c->context[i].destroy(c->context[i].value);
@@ -1081,9 +1101,10 @@ static void recv_trailing_filter(void* args, grpc_metadata_batch* b,
     gpr_log(GPR_DEBUG,
             "Received trailing metadata with no error and no status");
     set_final_status(
-        call, grpc_error_set_int(
-                  GRPC_ERROR_CREATE_FROM_STATIC_STRING("No status received"),
-                  GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_UNKNOWN));
+        call,
+        grpc_error_set_int(
+            GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_NO_STATUS_RECEIVED),
+            GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_UNKNOWN));
   }
   publish_app_metadata(call, b, true);
 }
@@ -1259,11 +1280,9 @@ static void continue_receiving_slices(batch_control* bctl) {
       return;
     }
     if (call->receiving_stream->Next(remaining, &call->receiving_slice_ready)) {
-      error = call->receiving_stream->Pull(&call->receiving_slice);
-      if (error == GRPC_ERROR_NONE) {
-        grpc_slice_buffer_add(&(*call->receiving_buffer)->data.raw.slice_buffer,
-                              call->receiving_slice);
-      } else {
+      error = call->receiving_stream->PullAvailable(
+          &(*call->receiving_buffer)->data.raw.slice_buffer);
+      if (error != GRPC_ERROR_NONE) {
         call->receiving_stream.reset();
         grpc_byte_buffer_destroy(*call->receiving_buffer);
         *call->receiving_buffer = nullptr;
@@ -1284,11 +1303,9 @@ static void receiving_slice_ready(void* bctlp, grpc_error* error) {
   bool release_error = false;
 
   if (error == GRPC_ERROR_NONE) {
-    grpc_slice slice;
-    error = call->receiving_stream->Pull(&slice);
+    error = call->receiving_stream->PullAvailable(
+        &(*call->receiving_buffer)->data.raw.slice_buffer);
     if (error == GRPC_ERROR_NONE) {
-      grpc_slice_buffer_add(&(*call->receiving_buffer)->data.raw.slice_buffer,
-                            slice);
       continue_receiving_slices(bctl);
     } else {
       /* Error returned by ByteStream::Pull() needs to be released manually */
@@ -1744,8 +1761,9 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
         call->sent_final_op = true;
         GPR_ASSERT(call->send_extra_metadata_count == 0);
         call->send_extra_metadata_count = 1;
-        call->send_extra_metadata[0].md = grpc_get_reffed_status_elem(
-            op->data.send_status_from_server.status);
+        call->send_extra_metadata[0].md =
+            grpc_get_status_elem(op->data.send_status_from_server.status,
+                                 call->send_status_storage.get());
         grpc_error* status_error =
             op->data.send_status_from_server.status == GRPC_STATUS_OK
                 ? GRPC_ERROR_NONE
@@ -1756,18 +1774,19 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
                       static_cast<intptr_t>(
                           op->data.send_status_from_server.status));
         if (op->data.send_status_from_server.status_details != nullptr) {
-          call->send_extra_metadata[1].md = grpc_mdelem_from_slices(
-              GRPC_MDSTR_GRPC_MESSAGE,
-              grpc_slice_ref_internal(
-                  *op->data.send_status_from_server.status_details));
+          const grpc_slice& details =
+              *op->data.send_status_from_server.status_details;
+          grpc_mdelem_data* storage = call->send_message_storage.get();
+          new (storage) grpc_mdelem_data{GRPC_MDSTR_GRPC_MESSAGE,
+                                         grpc_slice_ref_internal(details)};
+          call->has_send_message_storage = true;
+          call->send_extra_metadata[1].md = grpc_mdelem_create(
+              GRPC_MDSTR_GRPC_MESSAGE, storage->value, storage);
           call->send_extra_metadata_count++;
           if (status_error != GRPC_ERROR_NONE) {
-            char* msg = grpc_slice_to_c_string(
-                GRPC_MDVALUE(call->send_extra_metadata[1].md));
             status_error =
                 grpc_error_set_str(status_error, GRPC_ERROR_STR_GRPC_MESSAGE,
-                                   grpc_slice_from_copied_string(msg));
-            gpr_free(msg);
+                                   grpc_slice_copy(details));
           }
         }
 
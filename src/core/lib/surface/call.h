@@ -37,6 +37,11 @@ typedef struct grpc_call_create_args {
   grpc_channel* channel;
   grpc_core::Server* server;
 
+  /* if not NULL, the call's arena is recycled through this pool */
+  grpc_core::ArenaPool* arena_pool;
+  /* if not NULL, the per-method arena size hint to use and update */
+  gpr_atm* call_size_estimate;
+
   grpc_call* parent;
   uint32_t propagation_mask;
 
@@ -85,6 +85,7 @@ grpc_channel* grpc_channel_create_with_builder(
   channel->resource_user = resource_user;
   channel->is_client = grpc_channel_stack_type_is_client(channel_stack_type);
   channel->registration_table.Init();
+  channel->arena_pool = nullptr;
 
   gpr_atm_no_barrier_store(
       &channel->call_size_estimate,
@@ -92,6 +93,7 @@ grpc_channel* grpc_channel_create_with_builder(
           grpc_call_get_initial_size_estimate());
 
   grpc_compression_options_init(&channel->compression_options);
+  bool use_arena_pool = true;
   for (size_t i = 0; i < args->num_args; i++) {
     if (0 ==
         strcmp(args->args[i].key, GRPC_COMPRESSION_CHANNEL_DEFAULT_LEVEL)) {
@@ -124,8 +126,13 @@ grpc_channel* grpc_channel_create_with_builder(
         gpr_log(GPR_DEBUG,
                 GRPC_ARG_CHANNELZ_CHANNEL_NODE " should be a pointer");
       }
+    } else if (0 == strcmp(args->args[i].key, GRPC_ARG_CALL_ARENA_POOL)) {
+      use_arena_pool = grpc_channel_arg_get_bool(&args->args[i], true);
     }
   }
+  if (channel->is_client && use_arena_pool) {
+    channel->arena_pool = new grpc_core::ArenaPool();
+  }
 
   grpc_channel_args_destroy(args);
   return channel;
@@ -275,7 +282,8 @@ grpc_channel* grpc_channel_create(const char* target,
   return channel;
 }
 
-size_t grpc_channel_get_call_size_estimate(grpc_channel* channel) {
+size_t grpc_channel_get_call_size_estimate(grpc_channel* channel,
+                                           gpr_atm* method_estimate) {
 #define ROUND_UP_SIZE 256
   /* We round up our current estimate to the NEXT value of ROUND_UP_SIZE.
      This ensures:
@@ -283,20 +291,23 @@ size_t grpc_channel_get_call_size_estimate(grpc_channel* channel) {
          (which is common) - which tends to help most allocators reuse memory
       2. a small amount of allowed growth over the estimate without hitting
          the arena size doubling case, reducing overall memory usage */
-  return (static_cast<size_t>(
-              gpr_atm_no_barrier_load(&channel->call_size_estimate)) +
-          2 * ROUND_UP_SIZE) &
+  size_t estimate =
+      method_estimate != nullptr
+          ? static_cast<size_t>(gpr_atm_no_barrier_load(method_estimate))
+          : 0;
+  if (estimate == 0) {
+    estimate = static_cast<size_t>(
+        gpr_atm_no_barrier_load(&channel->call_size_estimate));
+  }
+  return (estimate + 2 * ROUND_UP_SIZE) &
          ~static_cast<size_t>(ROUND_UP_SIZE - 1);
 }
 
-void grpc_channel_update_call_size_estimate(grpc_channel* channel,
-                                            size_t size) {
-  size_t cur = static_cast<size_t>(
-      gpr_atm_no_barrier_load(&channel->call_size_estimate));
+static void update_call_size_estimate(gpr_atm* estimate, size_t size) {
+  size_t cur = static_cast<size_t>(gpr_atm_no_barrier_load(estimate));
   if (cur < size) {
     /* size grew: update estimate */
-    gpr_atm_no_barrier_cas(&channel->call_size_estimate,
-                           static_cast<gpr_atm>(cur),
+    gpr_atm_no_barrier_cas(estimate, static_cast<gpr_atm>(cur),
                            static_cast<gpr_atm>(size));
     /* if we lose: never mind, something else will likely update soon enough */
   } else if (cur == size) {
@@ -304,12 +315,26 @@ void grpc_channel_update_call_size_estimate(grpc_channel* channel,
   } else if (cur > 0) {
     /* size shrank: decrease estimate */
     gpr_atm_no_barrier_cas(
-        &channel->call_size_estimate, static_cast<gpr_atm>(cur),
+        estimate, static_cast<gpr_atm>(cur),
         static_cast<gpr_atm>(GPR_MIN(cur - 1, (255 * cur + size) / 256)));
     /* if we lose: never mind, something else will likely update soon enough */
   }
 }
 
+void grpc_channel_update_call_size_estimate(grpc_channel* channel, size_t size,
+                                            gpr_atm* method_estimate) {
+  update_call_size_estimate(&channel->call_size_estimate, size);
+  if (method_estimate != nullptr) {
+    /* The first completed call seeds the method's estimate outright, rather
+       than growing it from the channel wide one. */
+    if (gpr_atm_no_barrier_load(method_estimate) == 0) {
+      gpr_atm_no_barrier_cas(method_estimate, 0, static_cast<gpr_atm>(size));
+    } else {
+      update_call_size_estimate(method_estimate, size);
+    }
+  }
+}
+
 char* grpc_channel_get_target(grpc_channel* channel) {
   GRPC_API_TRACE("grpc_channel_get_target(channel=%p)", 1, (channel));
   return gpr_strdup(channel->target);
@@ -340,7 +365,7 @@ static grpc_call* grpc_channel_create_call_internal(
     grpc_channel* channel, grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* pollset_set_alternative,
     grpc_mdelem path_mdelem, grpc_mdelem authority_mdelem,
-    grpc_millis deadline) {
+    grpc_millis deadline, gpr_atm* call_size_estimate = nullptr) {
   grpc_mdelem send_metadata[2];
   size_t num_metadata = 0;
 
@@ -355,6 +380,8 @@ static grpc_call* grpc_channel_create_call_internal(
   grpc_call_create_args args;
   args.channel = channel;
   args.server = nullptr;
+  args.arena_pool = channel->arena_pool;
+  args.call_size_estimate = call_size_estimate;
   args.parent = parent_call;
   args.propagation_mask = propagation_mask;
   args.cq = cq;
@@ -486,7 +513,7 @@ grpc_call* grpc_channel_create_registered_call(
   grpc_call* call = grpc_channel_create_call_internal(
       channel, parent_call, propagation_mask, completion_queue, nullptr,
       GRPC_MDELEM_REF(rc->path), GRPC_MDELEM_REF(rc->authority),
-      grpc_timespec_to_millis_round_up(deadline));
+      grpc_timespec_to_millis_round_up(deadline), &rc->call_size_estimate);
 
   return call;
 }
@@ -501,6 +528,7 @@ static void destroy_channel(void* arg, grpc_error* /*error*/) {
   }
   grpc_channel_stack_destroy(CHANNEL_STACK_FROM_CHANNEL(channel));
   channel->registration_table.Destroy();
+  delete channel->arena_pool;
   if (channel->resource_user != nullptr) {
     grpc_resource_user_free(channel->resource_user,
                             GRPC_RESOURCE_QUOTA_CHANNEL_SIZE);
@@ -26,6 +26,7 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/gprpp/arena.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/transport/metadata.h"
@@ -63,8 +64,13 @@ grpc_channel_stack* grpc_channel_get_channel_stack(grpc_channel* channel);
 grpc_core::channelz::ChannelNode* grpc_channel_get_channelz_node(
     grpc_channel* channel);
 
-size_t grpc_channel_get_call_size_estimate(grpc_channel* channel);
-void grpc_channel_update_call_size_estimate(grpc_channel* channel, size_t size);
+/** Get the initial arena size for a new call. If \a method_estimate is
+    non-null and has seen a call, it is used in lieu of the channel wide
+    estimate. */
+size_t grpc_channel_get_call_size_estimate(grpc_channel* channel,
+                                           gpr_atm* method_estimate = nullptr);
+void grpc_channel_update_call_size_estimate(grpc_channel* channel, size_t size,
+                                            gpr_atm* method_estimate = nullptr);
 
 namespace grpc_core {
 
@@ -77,6 +83,10 @@ struct RegisteredCall {
   grpc_mdelem path;
   grpc_mdelem authority;
 
+  // Size hint for the arenas of calls to this method; 0 until a call to it
+  // has completed.
+  gpr_atm call_size_estimate = 0;
+
   explicit RegisteredCall(const char* method_arg, const char* host_arg);
   // TODO(vjpai): delete copy constructor once all supported compilers allow
   //              std::map value_type to be MoveConstructible.
@@ -105,6 +115,9 @@ struct grpc_channel {
   grpc_compression_options compression_options;
 
   gpr_atm call_size_estimate;
+  // Recycles call arenas; null for server channels (which use the server's
+  // pool) or when disabled by GRPC_ARG_CALL_ARENA_POOL.
+  grpc_core::ArenaPool* arena_pool;
   grpc_resource_user* resource_user;
 
   // TODO(vjpai): Once the grpc_channel is allocated via new rather than malloc,
@@ -64,6 +64,7 @@ GPR_TLS_DECL(g_cached_cq);
 struct plucker {
   grpc_pollset_worker** worker;
   void* tag;
+  plucker* next;
 };
 struct cq_poller_vtable {
   bool can_get_pollset;
@@ -242,6 +243,63 @@ class CqEventQueue {
   grpc_core::Atomic<intptr_t> num_queue_items_{0};
 };
 
+/* Completed events and waiting pluckers of a GRPC_CQ_PLUCK completion queue,
+ * both hashed by tag so that grpc_cq_end_op finds the thread waiting for its
+ * tag and grpc_completion_queue_pluck finds its completion without scanning
+ * everything queued on the cq. Both are intrusive chains (completions through
+ * their next field, pluckers live on the plucking thread's stack) so that
+ * nothing is allocated per event. Must be accessed with the cq lock held. */
+class CqPluckTable {
+ public:
+  CqPluckTable() {
+    completion_buckets_ = inline_completion_buckets_;
+    plucker_buckets_ = inline_plucker_buckets_;
+    for (size_t i = 0; i < kInlineBuckets; i++) {
+      completion_buckets_[i] = 0;
+      plucker_buckets_[i] = nullptr;
+    }
+  }
+  ~CqPluckTable() {
+    if (completion_buckets_ != inline_completion_buckets_) {
+      gpr_free(completion_buckets_);
+      gpr_free(plucker_buckets_);
+    }
+  }
+
+  size_t num_completions() const { return num_completions_; }
+
+  /* c->next holds the success bit */
+  void AddCompletion(grpc_cq_completion* c);
+  /* Removes and returns the oldest completion with this tag, or NULL */
+  grpc_cq_completion* TakeCompletion(void* tag);
+
+  void AddPlucker(plucker* p);
+  void RemovePlucker(plucker* p);
+  /* Returns a plucker waiting for tag, or NULL */
+  plucker* FindPlucker(void* tag);
+
+ private:
+  static constexpr size_t kInlineBuckets = 8;
+
+  size_t BucketFor(void* tag) const {
+    uintptr_t x = reinterpret_cast<uintptr_t>(tag);
+    x ^= x >> 4;
+    x ^= x >> 12;
+    return static_cast<size_t>(x) & (num_buckets_ - 1);
+  }
+  void MaybeGrow();
+
+  /* Chains use the same encoding as grpc_cq_completion::next, the low bit of
+     a link is the success bit of the completion holding it */
+  uintptr_t* completion_buckets_;
+  plucker** plucker_buckets_;
+  size_t num_buckets_ = kInlineBuckets;
+  size_t num_completions_ = 0;
+  size_t num_pluckers_ = 0;
+  uintptr_t inline_completion_buckets_[kInlineBuckets];
+  plucker* inline_plucker_buckets_[kInlineBuckets];
+};
+
 struct cq_next_data {
   ~cq_next_data() {
     GPR_ASSERT(queue.num_items() == 0);
@@ -268,14 +326,8 @@ struct cq_next_data {
 };
 
 struct cq_pluck_data {
-  cq_pluck_data() {
-    completed_tail = &completed_head;
-    completed_head.next = reinterpret_cast<uintptr_t>(completed_tail);
-  }
-
   ~cq_pluck_data() {
-    GPR_ASSERT(completed_head.next ==
-               reinterpret_cast<uintptr_t>(&completed_head));
+    GPR_ASSERT(table.num_completions() == 0);
 #ifndef NDEBUG
     if (pending_events.Load(grpc_core::MemoryOrder::ACQUIRE) != 0) {
       gpr_log(GPR_ERROR, "Destroying CQ without draining it fully.");
@@ -283,9 +335,9 @@ struct cq_pluck_data {
 #endif
   }
 
-  /** Completed events for completion-queues of type GRPC_CQ_PLUCK */
-  grpc_cq_completion completed_head;
-  grpc_cq_completion* completed_tail;
+  /** Completed events and pluckers for completion-queues of type
+      GRPC_CQ_PLUCK */
+  CqPluckTable table;
 
   /** Number of pending events (+1 if we're not shutdown).
       Initial count is dropped by grpc_completion_queue_shutdown. */
@@ -303,9 +355,6 @@ struct cq_pluck_data {
 
   /** 0 initially. 1 once we initiated shutdown */
   bool shutdown_called = false;
-
-  int num_pluckers = 0;
-  plucker pluckers[GRPC_MAX_COMPLETION_QUEUE_PLUCKERS];
 };
 
 struct cq_callback_data {
@@ -509,6 +558,102 @@ grpc_cq_completion* CqEventQueue::Pop() {
   return c;
 }
 
+constexpr size_t CqPluckTable::kInlineBuckets;
+
+void CqPluckTable::AddCompletion(grpc_cq_completion* c) {
+  MaybeGrow();
+  /* Append, so that completions sharing a tag are plucked in order */
+  uintptr_t* link = &completion_buckets_[BucketFor(c->tag)];
+  grpc_cq_completion* next;
+  while ((next = reinterpret_cast<grpc_cq_completion*>(
+              *link & ~static_cast<uintptr_t>(1))) != nullptr) {
+    link = &next->next;
+  }
+  *link = (*link & static_cast<uintptr_t>(1)) | reinterpret_cast<uintptr_t>(c);
+  num_completions_++;
+}
+
+grpc_cq_completion* CqPluckTable::TakeCompletion(void* tag) {
+  uintptr_t* link = &completion_buckets_[BucketFor(tag)];
+  grpc_cq_completion* c;
+  while ((c = reinterpret_cast<grpc_cq_completion*>(
+              *link & ~static_cast<uintptr_t>(1))) != nullptr) {
+    if (c->tag == tag) {
+      *link = (*link & static_cast<uintptr_t>(1)) |
+              (c->next & ~static_cast<uintptr_t>(1));
+      c->next &= static_cast<uintptr_t>(1);
+      num_completions_--;
+      return c;
+    }
+    link = &c->next;
+  }
+  return nullptr;
+}
+
+void CqPluckTable::AddPlucker(plucker* p) {
+  MaybeGrow();
+  plucker** head = &plucker_buckets_[BucketFor(p->tag)];
+  p->next = *head;
+  *head = p;
+  num_pluckers_++;
+}
+
+void CqPluckTable::RemovePlucker(plucker* p) {
+  for (plucker** link = &plucker_buckets_[BucketFor(p->tag)];
+       *link != nullptr; link = &(*link)->next) {
+    if (*link == p) {
+      *link = p->next;
+      num_pluckers_--;
+      return;
+    }
+  }
+  GPR_UNREACHABLE_CODE(return );
+}
+
+plucker* CqPluckTable::FindPlucker(void* tag) {
+  for (plucker* p = plucker_buckets_[BucketFor(tag)]; p != nullptr;
+       p = p->next) {
+    if (p->tag == tag) return p;
+  }
+  return nullptr;
+}
+
+/* Doubles the number of buckets once the chains get long. Never shrinks. */
+void CqPluckTable::MaybeGrow() {
+  if (num_completions_ + num_pluckers_ < 2 * num_buckets_) return;
+  size_t old_num_buckets = num_buckets_;
+  uintptr_t* old_completion_buckets = completion_buckets_;
+  plucker** old_plucker_buckets = plucker_buckets_;
+  num_buckets_ *= 2;
+  completion_buckets_ = static_cast<uintptr_t*>(
+      gpr_zalloc(num_buckets_ * sizeof(*completion_buckets_)));
+  plucker_buckets_ = static_cast<plucker**>(
+      gpr_zalloc(num_buckets_ * sizeof(*plucker_buckets_)));
+  num_completions_ = 0;
+  num_pluckers_ = 0;
+  for (size_t i = 0; i < old_num_buckets; i++) {
+    grpc_cq_completion* c =
+        reinterpret_cast<grpc_cq_completion*>(old_completion_buckets[i]);
+    while (c != nullptr) {
+      grpc_cq_completion* next = reinterpret_cast<grpc_cq_completion*>(
+          c->next & ~static_cast<uintptr_t>(1));
+      c->next &= static_cast<uintptr_t>(1);
+      AddCompletion(c);
+      c = next;
+    }
+    plucker* p = old_plucker_buckets[i];
+    while (p != nullptr) {
+      plucker* next = p->next;
+      AddPlucker(p);
+      p = next;
+    }
+  }
+  if (old_completion_buckets != inline_completion_buckets_) {
+    gpr_free(old_completion_buckets);
+    gpr_free(old_plucker_buckets);
+  }
+}
+
 grpc_completion_queue* grpc_completion_queue_create_internal(
     grpc_cq_completion_type completion_type, grpc_cq_polling_type polling_type,
     grpc_experimental_completion_queue_functor* shutdown_callback) {
@@ -792,33 +937,28 @@ static void cq_end_op_for_pluck(
   storage->tag = tag;
   storage->done = done;
   storage->done_arg = done_arg;
-  storage->next =
-      ((uintptr_t)&cqd->completed_head) | (static_cast<uintptr_t>(is_success));
+  storage->next = static_cast<uintptr_t>(is_success);
 
   gpr_mu_lock(cq->mu);
   cq_check_tag(cq, tag, false); /* Used in debug builds only */
 
-  /* Add to the list of completions */
+  /* Add to the table of completions */
   cqd->things_queued_ever.FetchAdd(1, grpc_core::MemoryOrder::RELAXED);
-  cqd->completed_tail->next =
-      ((uintptr_t)storage) | (1u & cqd->completed_tail->next);
-  cqd->completed_tail = storage;
+  cqd->table.AddCompletion(storage);
 
   if (cqd->pending_events.FetchSub(1, grpc_core::MemoryOrder::ACQ_REL) == 1) {
     cq_finish_shutdown_pluck(cq);
     gpr_mu_unlock(cq->mu);
   } else {
-    grpc_pollset_worker* pluck_worker = nullptr;
-    for (int i = 0; i < cqd->num_pluckers; i++) {
-      if (cqd->pluckers[i].tag == tag) {
-        pluck_worker = *cqd->pluckers[i].worker;
-        break;
-      }
+    /* Only the thread plucking this tag needs to wake up. If nobody is
+       plucking it yet, whoever does will find the completion in the table
+       before polling. */
+    plucker* p = cqd->table.FindPlucker(tag);
+    grpc_error* kick_error = GRPC_ERROR_NONE;
+    if (p != nullptr) {
+      kick_error = cq->poller_vtable->kick(POLLSET_FROM_CQ(cq), *p->worker);
     }
 
-    grpc_error* kick_error =
-        cq->poller_vtable->kick(POLLSET_FROM_CQ(cq), pluck_worker);
-
     gpr_mu_unlock(cq->mu);
 
     if (kick_error != GRPC_ERROR_NONE) {
@@ -959,24 +1099,15 @@ static void dump_pending_tags(grpc_completion_queue* cq) {
 static void dump_pending_tags(grpc_completion_queue* /*cq*/) {}
 #endif
 
-static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
-                          void* reserved) {
-  GPR_TIMER_SCOPE("grpc_completion_queue_next", 0);
-
+/* Fills events[0] like grpc_completion_queue_next, then, if that is a
+   completion, moves up to max_events - 1 more already queued completions into
+   the following entries without polling again. Returns the number of events
+   filled in. */
+static size_t cq_next_events(grpc_completion_queue* cq, grpc_event* events,
+                             size_t max_events, gpr_timespec deadline) {
   grpc_event ret;
   cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
 
-  GRPC_API_TRACE(
-      "grpc_completion_queue_next("
-      "cq=%p, "
-      "deadline=gpr_timespec { tv_sec: %" PRId64
-      ", tv_nsec: %d, clock_type: %d }, "
-      "reserved=%p)",
-      5,
-      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
-       reserved));
-  GPR_ASSERT(!reserved);
-
   dump_pending_tags(cq);
 
   GRPC_CQ_INTERNAL_REF(cq, "next");
@@ -1068,6 +1199,24 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     is_finished_arg.first_loop = false;
   }
 
+  events[0] = ret;
+  GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
+  size_t num_events = 1;
+  if (ret.type == GRPC_OP_COMPLETE) {
+    /* Drain whatever else is ready while we are here, this amortizes the cq
+       ref, the ExecCtx and the kick below over the whole batch. */
+    while (num_events < max_events) {
+      grpc_cq_completion* c = cqd->queue.Pop();
+      if (c == nullptr) break;
+      grpc_event* ev = &events[num_events++];
+      ev->type = GRPC_OP_COMPLETE;
+      ev->success = c->next & 1u;
+      ev->tag = c->tag;
+      c->done(c->done_arg, c);
+      GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, ev);
+    }
+  }
+
   if (cqd->queue.num_items() > 0 &&
       cqd->pending_events.Load(grpc_core::MemoryOrder::ACQUIRE) > 0) {
     gpr_mu_lock(cq->mu);
@@ -1075,11 +1224,30 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     gpr_mu_unlock(cq->mu);
   }
 
-  GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
   GRPC_CQ_INTERNAL_UNREF(cq, "next");
 
   GPR_ASSERT(is_finished_arg.stolen_completion == nullptr);
 
+  return num_events;
+}
+
+static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
+                          void* reserved) {
+  GPR_TIMER_SCOPE("grpc_completion_queue_next", 0);
+
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next("
+      "cq=%p, "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      5,
+      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
+       reserved));
+  GPR_ASSERT(!reserved);
+
+  grpc_event ret;
+  cq_next_events(cq, &ret, 1, deadline);
   return ret;
 }
 
@@ -1130,29 +1298,25 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
-static int add_plucker(grpc_completion_queue* cq, void* tag,
-                       grpc_pollset_worker** worker) {
-  cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
-  if (cqd->num_pluckers == GRPC_MAX_COMPLETION_QUEUE_PLUCKERS) {
-    return 0;
-  }
-  cqd->pluckers[cqd->num_pluckers].tag = tag;
-  cqd->pluckers[cqd->num_pluckers].worker = worker;
-  cqd->num_pluckers++;
-  return 1;
-}
+size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                        grpc_event* events, size_t max_events,
+                                        gpr_timespec deadline, void* reserved) {
+  GPR_TIMER_SCOPE("grpc_completion_queue_next_batch", 0);
 
-static void del_plucker(grpc_completion_queue* cq, void* tag,
-                        grpc_pollset_worker** worker) {
-  cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
-  for (int i = 0; i < cqd->num_pluckers; i++) {
-    if (cqd->pluckers[i].tag == tag && cqd->pluckers[i].worker == worker) {
-      cqd->num_pluckers--;
-      GPR_SWAP(plucker, cqd->pluckers[i], cqd->pluckers[cqd->num_pluckers]);
-      return;
-    }
-  }
-  GPR_UNREACHABLE_CODE(return );
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next_batch("
+      "cq=%p, events=%p, max_events=%" PRIuPTR
+      ", deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      7,
+      (cq, events, max_events, deadline.tv_sec, deadline.tv_nsec,
+       (int)deadline.clock_type, reserved));
+  GPR_ASSERT(!reserved);
+  GPR_ASSERT(cq->vtable->cq_completion_type == GRPC_CQ_NEXT);
+  GPR_ASSERT(max_events > 0);
+
+  return cq_next_events(cq, events, max_events, deadline);
 }
 
 class ExecCtxPluck : public grpc_core::ExecCtx {
@@ -1173,24 +1337,12 @@ class ExecCtxPluck : public grpc_core::ExecCtx {
       gpr_mu_lock(cq->mu);
       a->last_seen_things_queued_ever =
           cqd->things_queued_ever.Load(grpc_core::MemoryOrder::RELAXED);
-      grpc_cq_completion* c;
-      grpc_cq_completion* prev = &cqd->completed_head;
-      while ((c = (grpc_cq_completion*)(prev->next &
-                                        ~static_cast<uintptr_t>(1))) !=
-             &cqd->completed_head) {
-        if (c->tag == a->tag) {
-          prev->next = (prev->next & static_cast<uintptr_t>(1)) |
-                       (c->next & ~static_cast<uintptr_t>(1));
-          if (c == cqd->completed_tail) {
-            cqd->completed_tail = prev;
-          }
-          gpr_mu_unlock(cq->mu);
-          a->stolen_completion = c;
-          return true;
-        }
-        prev = c;
-      }
+      grpc_cq_completion* c = cqd->table.TakeCompletion(a->tag);
       gpr_mu_unlock(cq->mu);
+      if (c != nullptr) {
+        a->stolen_completion = c;
+        return true;
+      }
     }
     return !a->first_loop && a->deadline < grpc_core::ExecCtx::Get()->Now();
   }
@@ -1205,8 +1357,8 @@ static grpc_event cq_pluck(grpc_completion_queue* cq, void* tag,
 
   grpc_event ret;
   grpc_cq_completion* c;
-  grpc_cq_completion* prev;
   grpc_pollset_worker* worker = nullptr;
+  plucker self = {&worker, tag, nullptr};
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
 
   if (GRPC_TRACE_FLAG_ENABLED(grpc_cq_pluck_trace)) {
@@ -1246,46 +1398,25 @@ static grpc_event cq_pluck(grpc_completion_queue* cq, void* tag,
       c->done(c->done_arg, c);
       break;
     }
-    prev = &cqd->completed_head;
-    while (
-        (c = (grpc_cq_completion*)(prev->next & ~static_cast<uintptr_t>(1))) !=
-        &cqd->completed_head) {
-      if (c->tag == tag) {
-        prev->next = (prev->next & static_cast<uintptr_t>(1)) |
-                     (c->next & ~static_cast<uintptr_t>(1));
-        if (c == cqd->completed_tail) {
-          cqd->completed_tail = prev;
-        }
-        gpr_mu_unlock(cq->mu);
-        ret.type = GRPC_OP_COMPLETE;
-        ret.success = c->next & 1u;
-        ret.tag = c->tag;
-        c->done(c->done_arg, c);
-        goto done;
-      }
-      prev = c;
-    }
-    if (cqd->shutdown.Load(grpc_core::MemoryOrder::RELAXED)) {
+    c = cqd->table.TakeCompletion(tag);
+    if (c != nullptr) {
       gpr_mu_unlock(cq->mu);
-      ret.type = GRPC_QUEUE_SHUTDOWN;
-      ret.success = 0;
+      ret.type = GRPC_OP_COMPLETE;
+      ret.success = c->next & 1u;
+      ret.tag = c->tag;
+      c->done(c->done_arg, c);
       break;
     }
-    if (!add_plucker(cq, tag, &worker)) {
-      gpr_log(GPR_DEBUG,
-              "Too many outstanding grpc_completion_queue_pluck calls: maximum "
-              "is %d",
-              GRPC_MAX_COMPLETION_QUEUE_PLUCKERS);
+    if (cqd->shutdown.Load(grpc_core::MemoryOrder::RELAXED)) {
       gpr_mu_unlock(cq->mu);
-      /* TODO(ctiller): should we use a different result here */
-      ret.type = GRPC_QUEUE_TIMEOUT;
+      ret.type = GRPC_QUEUE_SHUTDOWN;
       ret.success = 0;
-      dump_pending_tags(cq);
       break;
     }
+    cqd->table.AddPlucker(&self);
     if (!is_finished_arg.first_loop &&
         grpc_core::ExecCtx::Get()->Now() >= deadline_millis) {
-      del_plucker(cq, tag, &worker);
+      cqd->table.RemovePlucker(&self);
       gpr_mu_unlock(cq->mu);
       ret.type = GRPC_QUEUE_TIMEOUT;
       ret.success = 0;
@@ -1296,7 +1427,7 @@ static grpc_event cq_pluck(grpc_completion_queue* cq, void* tag,
     grpc_error* err =
         cq->poller_vtable->work(POLLSET_FROM_CQ(cq), &worker, deadline_millis);
     if (err != GRPC_ERROR_NONE) {
-      del_plucker(cq, tag, &worker);
+      cqd->table.RemovePlucker(&self);
       gpr_mu_unlock(cq->mu);
       const char* msg = grpc_error_string(err);
       gpr_log(GPR_ERROR, "Completion queue pluck failed: %s", msg);
@@ -1308,9 +1439,8 @@ static grpc_event cq_pluck(grpc_completion_queue* cq, void* tag,
       break;
     }
     is_finished_arg.first_loop = false;
-    del_plucker(cq, tag, &worker);
+    cqd->table.RemovePlucker(&self);
   }
-done:
   GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
   GRPC_CQ_INTERNAL_UNREF(cq, "pluck");
 
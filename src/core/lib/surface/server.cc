@@ -465,7 +465,7 @@ class ChannelBroadcaster {
     op->goaway_error =
         send_goaway
             ? grpc_error_set_int(
-                  GRPC_ERROR_CREATE_FROM_STATIC_STRING("Server shutdown"),
+                  GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_SERVER_SHUTDOWN),
                   GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_OK)
             : GRPC_ERROR_NONE;
     op->set_accept_stream = true;
@@ -534,7 +534,11 @@ RefCountedPtr<channelz::ServerNode> CreateChannelzNode(
 Server::Server(const grpc_channel_args* args)
     : channel_args_(grpc_channel_args_copy(args)),
       default_resource_user_(CreateDefaultResourceUser(args)),
-      channelz_node_(CreateChannelzNode(this, args)) {}
+      channelz_node_(CreateChannelzNode(this, args)) {
+  if (grpc_channel_args_find_bool(args, GRPC_ARG_CALL_ARENA_POOL, true)) {
+    arena_pool_ = absl::make_unique<ArenaPool>();
+  }
+}
 
 Server::~Server() {
   grpc_channel_args_destroy(channel_args_);
@@ -694,7 +698,7 @@ void Server::MaybeFinishShutdown() {
   {
     MutexLock lock(&mu_call_);
     KillPendingWorkLocked(
-        GRPC_ERROR_CREATE_FROM_STATIC_STRING("Server Shutdown"));
+        GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_SERVER_SHUTDOWN));
   }
   if (!channels_.empty() || listeners_destroyed_ < listeners_.size()) {
     if (gpr_time_cmp(gpr_time_sub(gpr_now(GPR_CLOCK_REALTIME),
@@ -792,7 +796,7 @@ void Server::ShutdownAndNotify(grpc_completion_queue* cq, void* tag) {
     {
       MutexLock lock(&mu_call_);
       KillPendingWorkLocked(
-          GRPC_ERROR_CREATE_FROM_STATIC_STRING("Server Shutdown"));
+          GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_SERVER_SHUTDOWN));
     }
     MaybeFinishShutdown();
   }
@@ -876,7 +880,7 @@ grpc_call_error Server::ValidateServerRequestAndCq(
 grpc_call_error Server::QueueRequestedCall(size_t cq_idx, RequestedCall* rc) {
   if (shutdown_flag_.load(std::memory_order_acquire)) {
     FailCall(cq_idx, rc,
-             GRPC_ERROR_CREATE_FROM_STATIC_STRING("Server Shutdown"));
+             GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_SERVER_SHUTDOWN));
     return GRPC_CALL_OK;
   }
   RequestMatcherInterface* rm;
@@ -1045,7 +1049,7 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
   op->start_connectivity_watch = MakeOrphanable<ConnectivityWatcher>(this);
   if (server_->shutdown_flag_.load(std::memory_order_acquire)) {
     op->disconnect_with_error =
-        GRPC_ERROR_CREATE_FROM_STATIC_STRING("Server shutdown");
+        GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_SERVER_SHUTDOWN);
   }
   grpc_transport_perform_op(transport, op);
 }
@@ -1094,6 +1098,8 @@ void Server::ChannelData::AcceptStream(void* arg, grpc_transport* /*transport*/,
   grpc_call_create_args args;
   args.channel = chand->channel_;
   args.server = chand->server_.get();
+  args.arena_pool = chand->server_->arena_pool_.get();
+  args.call_size_estimate = nullptr;
   args.parent = nullptr;
   args.propagation_mask = 0;
   args.cq = nullptr;
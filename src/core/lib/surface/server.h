@@ -20,6 +20,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <list>
+#include <memory>
 #include <vector>
 
 #include "absl/types/optional.h"
@@ -30,6 +31,7 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/arena.h"
 #include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/transport/transport.h"
@@ -350,6 +352,9 @@ class Server : public InternallyRefCounted<Server> {
   grpc_channel_args* const channel_args_;
   grpc_resource_user* default_resource_user_ = nullptr;
   RefCountedPtr<channelz::ServerNode> channelz_node_;
+  // Recycles the arenas of calls on all of this server's channels; null if
+  // disabled by GRPC_ARG_CALL_ARENA_POOL.
+  std::unique_ptr<ArenaPool> arena_pool_;
 
   std::vector<grpc_completion_queue*> cqs_;
   std::vector<grpc_pollset*> pollsets_;
@@ -34,6 +34,7 @@ BdpEstimator::BdpEstimator(const char* name)
       accumulator_(0),
       estimate_(65536),
       ping_start_time_(gpr_time_0(GPR_CLOCK_MONOTONIC)),
+      last_ping_rtt_(gpr_time_0(GPR_TIMESPAN)),
       inter_ping_delay_(100),  // start at 100ms
       stable_estimate_count_(0),
       bw_est_(0),
@@ -42,6 +43,7 @@ BdpEstimator::BdpEstimator(const char* name)
 grpc_millis BdpEstimator::CompletePing() {
   gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
   gpr_timespec dt_ts = gpr_time_sub(now, ping_start_time_);
+  last_ping_rtt_ = dt_ts;
   double dt = static_cast<double>(dt_ts.tv_sec) +
               1e-9 * static_cast<double>(dt_ts.tv_nsec);
   double bw = dt > 0 ? (static_cast<double>(accumulator_) / dt) : 0;
@@ -84,4 +86,91 @@ grpc_millis BdpEstimator::CompletePing() {
   return grpc_core::ExecCtx::Get()->Now() + inter_ping_delay_;
 }
 
+namespace {
+
+double TimespecToSeconds(gpr_timespec ts) {
+  return static_cast<double>(ts.tv_sec) +
+         1e-9 * static_cast<double>(ts.tv_nsec);
+}
+
+// Delivery rate samples shorter than this are dominated by timer granularity
+// and frame batching.
+constexpr double kMinSampleSeconds = 0.001;
+// How long a minimum round trip time is trusted without being seen again.
+constexpr double kMinRttSeconds = 10;
+// The pipe is full after this many samples without the bandwidth estimate
+// growing by kFullBandwidthGrowth.
+constexpr int kFullBandwidthRounds = 3;
+constexpr double kFullBandwidthGrowth = 1.25;
+
+}  // namespace
+
+DeliveryRateEstimator::DeliveryRateEstimator(const char* name)
+    : min_rtt_time_(gpr_time_0(GPR_CLOCK_MONOTONIC)),
+      sample_start_time_(gpr_time_0(GPR_CLOCK_MONOTONIC)),
+      last_arrival_time_(gpr_time_0(GPR_CLOCK_MONOTONIC)),
+      name_(name) {}
+
+bool DeliveryRateEstimator::AddIncomingBytes(int64_t num_bytes,
+                                             gpr_timespec now) {
+  if (!has_min_rtt_) return false;
+  const double interval = GPR_MAX(min_rtt_, kMinSampleSeconds);
+  // A gap of more than a sample interval means the sender ran out of data:
+  // start afresh rather than count the idle time against the link.
+  if (!sampling_ ||
+      TimespecToSeconds(gpr_time_sub(now, last_arrival_time_)) > interval) {
+    sampling_ = true;
+    sample_start_time_ = now;
+    last_arrival_time_ = now;
+    sample_bytes_ = 0;
+    return false;
+  }
+  last_arrival_time_ = now;
+  sample_bytes_ += num_bytes;
+  const double elapsed =
+      TimespecToSeconds(gpr_time_sub(now, sample_start_time_));
+  if (elapsed < interval) return false;
+  const double bw = static_cast<double>(sample_bytes_) / elapsed;
+  bandwidth_samples_[next_bandwidth_sample_] = bw;
+  next_bandwidth_sample_ = (next_bandwidth_sample_ + 1) % kBandwidthSamples;
+  sample_start_time_ = now;
+  sample_bytes_ = 0;
+  const double bw_est = EstimateBandwidth();
+  if (!filled_pipe_) {
+    if (bw_est >= full_bandwidth_ * kFullBandwidthGrowth) {
+      full_bandwidth_ = bw_est;
+      full_bandwidth_rounds_ = 0;
+    } else if (++full_bandwidth_rounds_ >= kFullBandwidthRounds) {
+      filled_pipe_ = true;
+    }
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_bdp_estimator_trace)) {
+    gpr_log(GPR_INFO,
+            "delivery_rate[%s]:sample dt=%lf bw=%lfMbs bw_est=%lfMbs "
+            "min_rtt=%lf%s",
+            name_, elapsed, bw / 125000.0, bw_est / 125000.0, min_rtt_,
+            filled_pipe_ ? "" : " startup");
+  }
+  return true;
+}
+
+void DeliveryRateEstimator::AddRttSample(gpr_timespec rtt, gpr_timespec now) {
+  const double rtt_seconds = TimespecToSeconds(rtt);
+  if (rtt_seconds < 0) return;
+  if (!has_min_rtt_ || rtt_seconds <= min_rtt_ ||
+      TimespecToSeconds(gpr_time_sub(now, min_rtt_time_)) > kMinRttSeconds) {
+    has_min_rtt_ = true;
+    min_rtt_ = rtt_seconds;
+    min_rtt_time_ = now;
+  }
+}
+
+double DeliveryRateEstimator::EstimateBandwidth() const {
+  double bw = 0;
+  for (double sample : bandwidth_samples_) {
+    bw = GPR_MAX(bw, sample);
+  }
+  return bw;
+}
+
 }  // namespace grpc_core
@@ -76,6 +76,9 @@ class BdpEstimator {
 
   int64_t accumulator() { return accumulator_; }
 
+  // Round trip time of the last completed ping, zero before the first
+  gpr_timespec last_ping_rtt() const { return last_ping_rtt_; }
+
  private:
   enum class PingState { UNSCHEDULED, SCHEDULED, STARTED };
 
@@ -84,12 +87,64 @@ class BdpEstimator {
   int64_t estimate_;
   // when was the current ping started?
   gpr_timespec ping_start_time_;
+  gpr_timespec last_ping_rtt_;
   int inter_ping_delay_;
   int stable_estimate_count_;
   double bw_est_;
   const char* name_;
 };
 
+// Estimates the bandwidth-delay product continuously, in the manner of BBR:
+// bandwidth is the highest delivery rate sampled over the last few round
+// trips, and the round trip time the lowest seen over the last few seconds.
+// Unlike BdpEstimator, whose estimate only grows, this one follows the link
+// down as well as up.
+class DeliveryRateEstimator {
+ public:
+  explicit DeliveryRateEstimator(const char* name);
+
+  // Records num_bytes of data received at now. Returns true if this completed
+  // a delivery rate sample, so that the estimates may have changed. Samples
+  // last a round trip, so none are taken before the first AddRttSample.
+  bool AddIncomingBytes(int64_t num_bytes, gpr_timespec now);
+
+  // Records the round trip time of a ping acknowledged at now
+  void AddRttSample(gpr_timespec rtt, gpr_timespec now);
+
+  // Bottleneck bandwidth in bytes per second, zero before the first sample
+  double EstimateBandwidth() const;
+  // Minimum round trip time in seconds, zero before the first sample
+  double EstimateMinRtt() const { return min_rtt_; }
+  int64_t EstimateBdp() const {
+    return static_cast<int64_t>(EstimateBandwidth() * min_rtt_);
+  }
+
+  // Has bandwidth stopped growing? Until it has, the link may carry more than
+  // has been offered to it so far.
+  bool filled_pipe() const { return filled_pipe_; }
+
+ private:
+  static constexpr int kBandwidthSamples = 10;
+
+  bool has_min_rtt_ = false;
+  double min_rtt_ = 0;
+  // when min_rtt_ was sampled
+  gpr_timespec min_rtt_time_;
+  // the delivery rate sample in progress
+  bool sampling_ = false;
+  gpr_timespec sample_start_time_;
+  gpr_timespec last_arrival_time_;
+  int64_t sample_bytes_ = 0;
+  // the last kBandwidthSamples delivery rates, as a ring
+  double bandwidth_samples_[kBandwidthSamples] = {};
+  int next_bandwidth_sample_ = 0;
+  // startup: the pipe is full once bandwidth stops growing
+  bool filled_pipe_ = false;
+  double full_bandwidth_ = 0;
+  int full_bandwidth_rounds_ = 0;
+  const char* name_;
+};
+
 }  // namespace grpc_core
 
 #endif /* GRPC_CORE_LIB_TRANSPORT_BDP_ESTIMATOR_H */
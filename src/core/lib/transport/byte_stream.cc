@@ -30,6 +30,19 @@
 
 namespace grpc_core {
 
+//
+// ByteStream
+//
+
+grpc_error* ByteStream::PullAvailable(grpc_slice_buffer* slices) {
+  grpc_slice slice;
+  grpc_error* error = Pull(&slice);
+  if (error == GRPC_ERROR_NONE) {
+    grpc_slice_buffer_add(slices, slice);
+  }
+  return error;
+}
+
 //
 // SliceBufferByteStream
 //
@@ -67,6 +80,14 @@ grpc_error* SliceBufferByteStream::Pull(grpc_slice* slice) {
   return GRPC_ERROR_NONE;
 }
 
+grpc_error* SliceBufferByteStream::PullAvailable(grpc_slice_buffer* slices) {
+  if (GPR_UNLIKELY(shutdown_error_ != GRPC_ERROR_NONE)) {
+    return GRPC_ERROR_REF(shutdown_error_);
+  }
+  grpc_slice_buffer_move_into(&backing_buffer_, slices);
+  return GRPC_ERROR_NONE;
+}
+
 void SliceBufferByteStream::Shutdown(grpc_error* error) {
   GRPC_ERROR_UNREF(shutdown_error_);
   shutdown_error_ = error;
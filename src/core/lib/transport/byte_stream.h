@@ -58,6 +58,12 @@ class ByteStream : public Orphanable {
   // Once a slice is returned into *slice, it is owned by the caller.
   virtual grpc_error* Pull(grpc_slice* slice) = 0;
 
+  // Like Pull(), but appends to slices every slice of the stream that is
+  // available without waiting, rather than just the next one. Implementations
+  // hand over the slices they hold as they are, so that a message arrives in
+  // the buffers it was read into. The default pulls a single slice.
+  virtual grpc_error* PullAvailable(grpc_slice_buffer* slices);
+
   // Shuts down the byte stream.
   //
   // If there is a pending call to on_complete from Next(), it will be
@@ -98,6 +104,7 @@ class SliceBufferByteStream : public ByteStream {
 
   bool Next(size_t max_size_hint, grpc_closure* on_complete) override;
   grpc_error* Pull(grpc_slice* slice) override;
+  grpc_error* PullAvailable(grpc_slice_buffer* slices) override;
   void Shutdown(grpc_error* error) override;
 
  private:
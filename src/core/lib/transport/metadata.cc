@@ -197,38 +197,50 @@ InternedMetadata::~InternedMetadata() {
   }
 }
 
-size_t InternedMetadata::CleanupLinkedMetadata(
-    InternedMetadata::BucketLink* head) {
-  size_t num_freed = 0;
+void InternedMetadata::CleanupLinkedMetadata(
+    InternedMetadata::BucketLink* head,
+    absl::InlinedVector<InternedMetadata*, 16>* unlinked) {
   InternedMetadata::BucketLink* prev_next = head;
   InternedMetadata *md, *next;
 
-  for (md = head->next; md; md = next) {
-    next = md->link_.next;
+  for (md = head->next.Load(grpc_core::MemoryOrder::RELAXED); md; md = next) {
+    next = md->link_.next.Load(grpc_core::MemoryOrder::RELAXED);
     if (md->AllRefsDropped()) {
-      prev_next->next = next;
-      delete md;
-      num_freed++;
+      /* md->link_ stays intact for lookups that are standing on md */
+      prev_next->next.Store(next, grpc_core::MemoryOrder::RELEASE);
+      unlinked->push_back(md);
     } else {
       prev_next = &md->link_;
     }
   }
-  return num_freed;
 }
 
 typedef struct mdtab_shard {
   gpr_mu mu;
-  InternedMetadata::BucketLink* elems;
+  /** InternedMetadata::BucketLink array and its size. Lookups read both
+      without the lock: elems is always published before capacity, and
+      capacity only grows. */
+  gpr_atm elems;
+  gpr_atm capacity;
   size_t count;
-  size_t capacity;
   /** Estimate of the number of unreferenced mdelems in the hash table.
       This will eventually converge to the exact number, but it's instantaneous
       accuracy is not guaranteed */
   gpr_atm free_estimate;
+  grpc_core::InternTableReaders readers;
 } mdtab_shard;
 
 static mdtab_shard g_shards[SHARD_COUNT];
 
+static InternedMetadata::BucketLink* shard_elems(mdtab_shard* shard) {
+  return reinterpret_cast<InternedMetadata::BucketLink*>(
+      gpr_atm_acq_load(&shard->elems));
+}
+
+static size_t shard_capacity(mdtab_shard* shard) {
+  return static_cast<size_t>(gpr_atm_acq_load(&shard->capacity));
+}
+
 static void gc_mdtab(mdtab_shard* shard);
 
 void grpc_mdctx_global_init(void) {
@@ -238,9 +250,10 @@ void grpc_mdctx_global_init(void) {
     gpr_mu_init(&shard->mu);
     shard->count = 0;
     gpr_atm_no_barrier_store(&shard->free_estimate, 0);
-    shard->capacity = INITIAL_SHARD_CAPACITY;
-    shard->elems = static_cast<InternedMetadata::BucketLink*>(
-        gpr_zalloc(sizeof(*shard->elems) * shard->capacity));
+    InternedMetadata::BucketLink* elems =
+        new InternedMetadata::BucketLink[INITIAL_SHARD_CAPACITY];
+    gpr_atm_rel_store(&shard->elems, reinterpret_cast<gpr_atm>(elems));
+    gpr_atm_rel_store(&shard->capacity, INITIAL_SHARD_CAPACITY);
   }
 }
 
@@ -252,9 +265,11 @@ void grpc_mdctx_global_shutdown() {
     if (shard->count != 0) {
       gpr_log(GPR_ERROR, "WARNING: %" PRIuPTR " metadata elements were leaked",
               shard->count);
-      for (int i = 0; i < shard->capacity; i++) {
-        for (InternedMetadata* md = shard->elems[i].next; md;
-             md = md->bucket_next()) {
+      InternedMetadata::BucketLink* elems = shard_elems(shard);
+      for (size_t i = 0; i < shard_capacity(shard); i++) {
+        for (InternedMetadata* md =
+                 elems[i].next.Load(grpc_core::MemoryOrder::RELAXED);
+             md; md = md->bucket_next()) {
           char* key_str = grpc_slice_to_c_string(md->key());
           char* value_str = grpc_slice_to_c_string(md->value());
           gpr_log(GPR_ERROR, "mdelem '%s' = '%s'", key_str, value_str);
@@ -272,7 +287,7 @@ void grpc_mdctx_global_shutdown() {
 #ifndef GRPC_ASAN_ENABLED
     GPR_DEBUG_ASSERT(shard->count == 0);
 #endif
-    gpr_free(shard->elems);
+    delete[] shard_elems(shard);
   }
 }
 
@@ -303,48 +318,78 @@ void InternedMetadata::RefWithShardLocked(mdtab_shard* shard) {
   }
 }
 
+bool InternedMetadata::RefIfNonZero() {
+#ifndef NDEBUG
+  if (grpc_trace_metadata.enabled()) {
+    char* key_str = grpc_slice_to_c_string(key());
+    char* value_str = grpc_slice_to_c_string(value());
+    intptr_t value = RefValue();
+    gpr_log(__FILE__, __LINE__, GPR_LOG_SEVERITY_DEBUG,
+            "mdelem   REF_IF_NON_ZERO:%p:%" PRIdPTR "->%" PRIdPTR
+            ": '%s' = '%s'",
+            this, value, value + 1, key_str, value_str);
+    gpr_free(key_str);
+    gpr_free(value_str);
+  }
+#endif
+  return IncrementRefIfNonZero();
+}
+
 static void gc_mdtab(mdtab_shard* shard) {
   GPR_TIMER_SCOPE("gc_mdtab", 0);
-  size_t num_freed = 0;
-  for (size_t i = 0; i < shard->capacity; ++i) {
-    intptr_t freed = InternedMetadata::CleanupLinkedMetadata(&shard->elems[i]);
-    num_freed += freed;
-    shard->count -= freed;
+  absl::InlinedVector<InternedMetadata*, 16> unlinked;
+  InternedMetadata::BucketLink* elems = shard_elems(shard);
+  for (size_t i = 0; i < shard_capacity(shard); ++i) {
+    InternedMetadata::CleanupLinkedMetadata(&elems[i], &unlinked);
+  }
+  if (unlinked.empty()) return;
+  /* wait for lookups that may still be looking at the unlinked elements */
+  shard->readers.Synchronize();
+  for (InternedMetadata* md : unlinked) {
+    delete md;
   }
+  shard->count -= unlinked.size();
   gpr_atm_no_barrier_fetch_add(&shard->free_estimate,
-                               -static_cast<intptr_t>(num_freed));
+                               -static_cast<intptr_t>(unlinked.size()));
 }
 
 static void grow_mdtab(mdtab_shard* shard) {
   GPR_TIMER_SCOPE("grow_mdtab", 0);
 
-  size_t capacity = shard->capacity * 2;
+  const size_t old_capacity = shard_capacity(shard);
+  InternedMetadata::BucketLink* old_mdtab = shard_elems(shard);
+  size_t capacity = old_capacity * 2;
   size_t i;
   InternedMetadata::BucketLink* mdtab;
   InternedMetadata *md, *next;
   uint32_t hash;
 
-  mdtab = static_cast<InternedMetadata::BucketLink*>(
-      gpr_zalloc(sizeof(InternedMetadata::BucketLink) * capacity));
+  mdtab = new InternedMetadata::BucketLink[capacity];
 
-  for (i = 0; i < shard->capacity; i++) {
-    for (md = shard->elems[i].next; md; md = next) {
+  /* Lookups racing with the move may get diverted to another chain and miss;
+     they then retry under the lock. */
+  for (i = 0; i < old_capacity; i++) {
+    for (md = old_mdtab[i].next.Load(grpc_core::MemoryOrder::RELAXED); md;
+         md = next) {
       size_t idx;
       hash = md->hash();
       next = md->bucket_next();
       idx = TABLE_IDX(hash, capacity);
-      md->set_bucket_next(mdtab[idx].next);
-      mdtab[idx].next = md;
+      md->set_bucket_next(
+          mdtab[idx].next.Load(grpc_core::MemoryOrder::RELAXED));
+      mdtab[idx].next.Store(md, grpc_core::MemoryOrder::RELAXED);
     }
   }
-  gpr_free(shard->elems);
-  shard->elems = mdtab;
-  shard->capacity = capacity;
+  gpr_atm_rel_store(&shard->elems, reinterpret_cast<gpr_atm>(mdtab));
+  gpr_atm_rel_store(&shard->capacity, static_cast<gpr_atm>(capacity));
+  /* wait for lookups still walking the old table */
+  shard->readers.Synchronize();
+  delete[] old_mdtab;
 }
 
 static void rehash_mdtab(mdtab_shard* shard) {
   if (gpr_atm_no_barrier_load(&shard->free_estimate) >
-      static_cast<gpr_atm>(shard->capacity / 4)) {
+      static_cast<gpr_atm>(shard_capacity(shard) / 4)) {
     gc_mdtab(shard);
   } else {
     grow_mdtab(shard);
@@ -446,15 +491,36 @@ static grpc_mdelem md_create_must_intern(const grpc_slice& key,
   // comparison of the refcounts.
   InternedMetadata* md;
   mdtab_shard* shard = &g_shards[SHARD_IDX(hash)];
-  size_t idx;
 
   GPR_TIMER_SCOPE("grpc_mdelem_from_metadata_strings", 0);
 
+  /* Most lookups hit a live element: take a ref without locking the shard.
+     Elements whose refcount already dropped to zero can only be revived
+     under the lock, since gc_mdtab may be about to delete them. capacity must
+     be read before elems, see mdtab_shard. */
+  const int token = shard->readers.Enter();
+  const size_t capacity = shard_capacity(shard);
+  for (md = shard_elems(shard)[TABLE_IDX(hash, capacity)].next.Load(
+           grpc_core::MemoryOrder::ACQUIRE);
+       md; md = md->bucket_next()) {
+    if (grpc_slice_static_interned_equal(key, md->key()) &&
+        grpc_slice_static_interned_equal(value, md->value())) {
+      if (!md->RefIfNonZero()) md = nullptr;
+      break;
+    }
+  }
+  shard->readers.Exit(token);
+  if (md != nullptr) {
+    return GRPC_MAKE_MDELEM(md, GRPC_MDELEM_STORAGE_INTERNED);
+  }
+
   gpr_mu_lock(&shard->mu);
 
-  idx = TABLE_IDX(hash, shard->capacity);
+  InternedMetadata::BucketLink* bucket =
+      &shard_elems(shard)[TABLE_IDX(hash, shard_capacity(shard))];
   /* search for an existing pair */
-  for (md = shard->elems[idx].next; md; md = md->bucket_next()) {
+  for (md = bucket->next.Load(grpc_core::MemoryOrder::RELAXED); md;
+       md = md->bucket_next()) {
     if (grpc_slice_static_interned_equal(key, md->key()) &&
         grpc_slice_static_interned_equal(value, md->value())) {
       md->RefWithShardLocked(shard);
@@ -464,15 +530,17 @@ static grpc_mdelem md_create_must_intern(const grpc_slice& key,
   }
 
   /* not found: create a new pair */
+  InternedMetadata* head = bucket->next.Load(grpc_core::MemoryOrder::RELAXED);
   md = key_definitely_static
            ? new InternedMetadata(
-                 key, value, hash, shard->elems[idx].next,
+                 key, value, hash, head,
                  static_cast<const InternedMetadata::NoRefKey*>(nullptr))
-           : new InternedMetadata(key, value, hash, shard->elems[idx].next);
-  shard->elems[idx].next = md;
+           : new InternedMetadata(key, value, hash, head);
+  /* publishes the fully constructed element to lock-free lookups */
+  bucket->next.Store(md, grpc_core::MemoryOrder::RELEASE);
   shard->count++;
 
-  if (shard->count > shard->capacity * 2) {
+  if (shard->count > shard_capacity(shard) * 2) {
     rehash_mdtab(shard);
   }
 
@@ -26,6 +26,8 @@
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
 
+#include "absl/container/inlined_vector.h"
+
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/atomic.h"
@@ -269,6 +271,7 @@ class RefcountedMdBase {
   intptr_t RefValue() { return refcnt_.Load(MemoryOrder::RELAXED); }
   bool AllRefsDropped() { return refcnt_.Load(MemoryOrder::ACQUIRE) == 0; }
   bool FirstRef() { return refcnt_.FetchAdd(1, MemoryOrder::RELAXED) == 0; }
+  bool IncrementRefIfNonZero() { return refcnt_.IncrementIfNonzero(); }
 
  private:
   /* must be byte compatible with grpc_mdelem_data */
@@ -283,9 +286,12 @@ class InternedMetadata : public RefcountedMdBase {
   // TODO(arjunroy): Change to use strongly typed slices instead.
   struct NoRefKey {};
   struct BucketLink {
+    BucketLink() = default;
     explicit BucketLink(InternedMetadata* md) : next(md) {}
 
-    InternedMetadata* next = nullptr;
+    // Followed by lock-free lookups, so only ever changed with release
+    // stores.
+    Atomic<InternedMetadata*> next;
   };
   InternedMetadata(const grpc_slice& key, const grpc_slice& value,
                    uint32_t hash, InternedMetadata* next);
@@ -294,11 +300,22 @@ class InternedMetadata : public RefcountedMdBase {
 
   ~InternedMetadata();
   void RefWithShardLocked(mdtab_shard* shard);
+  // Takes a ref without the shard lock, which is only safe for an element
+  // that is still referenced elsewhere: fails if the refcount is zero.
+  bool RefIfNonZero();
   UserData* user_data() { return &user_data_; }
-  InternedMetadata* bucket_next() { return link_.next; }
-  void set_bucket_next(InternedMetadata* md) { link_.next = md; }
+  InternedMetadata* bucket_next() {
+    return link_.next.Load(MemoryOrder::ACQUIRE);
+  }
+  void set_bucket_next(InternedMetadata* md) {
+    link_.next.Store(md, MemoryOrder::RELEASE);
+  }
 
-  static size_t CleanupLinkedMetadata(BucketLink* head);
+  // Unlinks the unreferenced elements in the bucket at \a head and appends
+  // them to \a unlinked. They may not be deleted until concurrent lookups
+  // are done with them.
+  static void CleanupLinkedMetadata(
+      BucketLink* head, absl::InlinedVector<InternedMetadata*, 16>* unlinked);
 
  private:
   UserData user_data_;
@@ -20,6 +20,9 @@
 
 #include "src/core/lib/transport/status_metadata.h"
 
+#include <new>
+
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/transport/static_metadata.h"
 
@@ -59,3 +62,21 @@ grpc_mdelem grpc_get_reffed_status_elem_slowpath(int status_code) {
   return grpc_mdelem_from_slices(GRPC_MDSTR_GRPC_STATUS,
                                  grpc_core::UnmanagedMemorySlice(tmp));
 }
+
+static const char* const status_code_strings[] = {
+    "0", "1",  "2",  "3",  "4",  "5",  "6",  "7", "8",
+    "9", "10", "11", "12", "13", "14", "15", "16"};
+
+grpc_mdelem grpc_get_status_elem(
+    int status_code, grpc_mdelem_data* compatible_external_backing_store) {
+  if (status_code <= GRPC_STATUS_UNKNOWN ||
+      status_code >= static_cast<int>(GPR_ARRAY_SIZE(status_code_strings))) {
+    return grpc_get_reffed_status_elem(status_code);
+  }
+  grpc_slice value =
+      grpc_slice_from_static_string(status_code_strings[status_code]);
+  new (compatible_external_backing_store)
+      grpc_mdelem_data{GRPC_MDSTR_GRPC_STATUS, value};
+  return grpc_mdelem_create(GRPC_MDSTR_GRPC_STATUS, value,
+                            compatible_external_backing_store);
+}
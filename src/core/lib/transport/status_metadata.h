@@ -45,4 +45,10 @@ inline grpc_mdelem grpc_get_reffed_status_elem(int status_code) {
   return grpc_get_reffed_status_elem_slowpath(status_code);
 }
 
+/** Like grpc_get_reffed_status_elem(), but grpc_status_code values without a
+    static element are backed by \a compatible_external_backing_store instead
+    of an allocation. The result is only valid while that storage is. */
+grpc_mdelem grpc_get_status_elem(
+    int status_code, grpc_mdelem_data* compatible_external_backing_store);
+
 #endif /* GRPC_CORE_LIB_TRANSPORT_STATUS_METADATA_H */
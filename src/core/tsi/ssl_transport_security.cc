@@ -33,14 +33,20 @@
 #include <sys/socket.h>
 #endif
 
+#include <list>
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <grpc/grpc_security.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/atm.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/thd_id.h>
+#include <grpc/support/time.h>
 
 #include "absl/strings/match.h"
 #include "absl/strings/string_view.h"
@@ -50,6 +56,10 @@ extern "C" {
 #include <openssl/crypto.h> /* For OPENSSL_free */
 #include <openssl/engine.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+#include <openssl/sha.h>
 #include <openssl/ssl.h>
 #include <openssl/tls1.h>
 #include <openssl/x509.h>
@@ -57,9 +67,12 @@ extern "C" {
 }
 
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 
 /* --- Constants. ---*/
 
@@ -78,15 +91,81 @@ extern "C" {
    SSL structure. This is what we would ultimately want though... */
 #define TSI_SSL_MAX_PROTECTION_OVERHEAD 100
 
+/* Upper bound on the number of TLS records the zero-copy protector seals into
+   a single output slice. */
+#define TSI_SSL_ZERO_COPY_MAX_RECORDS_PER_SLICE 16
+
+/* Moving record protection into the kernel needs the TLS 1.2 key block and the
+   record sequence numbers, which only BoringSSL exposes. */
+#if defined(GRPC_LINUX_KTLS) && defined(OPENSSL_IS_BORINGSSL)
+#define TSI_SSL_KTLS_SUPPORT 1
+#endif
+
+#ifdef TSI_SSL_KTLS_SUPPORT
+#include <errno.h>
+#include <linux/tls.h>
+#include <netinet/tcp.h>
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif
+
 /* --- Structure definitions. ---*/
 
 struct tsi_ssl_root_certs_store {
   X509_STORE* store;
+  /* Unique among the stores created by this process, so that the peer
+     verification cache never confuses two stores. */
+  gpr_atm id;
 };
 
 struct tsi_ssl_handshaker_factory {
   const tsi_ssl_handshaker_factory_vtable* vtable;
   gpr_refcount refcount;
+  /* Hash of the root certificates the peers are verified against, which
+     scopes the entries of the peer verification cache. */
+  unsigned char peer_trust_id[SHA256_DIGEST_LENGTH];
+};
+
+/* Session ticket keys shared by the server handshaker factories that were not
+   given a key of their own. */
+struct tsi_ssl_session_ticket_keys {
+  gpr_mu mu;
+  /* keys[0] protects new tickets, the others only open older ones. */
+  std::vector<std::string> keys;
+  gpr_timespec rotation_period;
+  gpr_timespec next_rotation;
+};
+
+/* Peer certificate chain in the peer verification cache. */
+struct tsi_ssl_verified_peer_chain {
+  std::string key;
+  gpr_timespec expiration;
+  /* x509 properties of the peer, set by the first handshake extracting them
+     from the chain. */
+  bool has_peer_properties;
+  std::vector<std::pair<std::string, std::string>> peer_properties;
+};
+
+/* Peer certificate chains verified recently by any handshaker factory. */
+struct tsi_ssl_peer_verification_cache {
+  gpr_mu mu;
+  size_t capacity;
+  gpr_timespec ttl;
+  /* Most recently used first. */
+  std::list<tsi_ssl_verified_peer_chain> chains;
+  std::map<std::string, std::list<tsi_ssl_verified_peer_chain>::iterator>
+      index;
+};
+
+/* Outcome of the verification of the peer chain of an SSL object, attached to
+   it for ssl_handshaker_result_extract_peer. */
+struct tsi_ssl_peer_verification {
+  std::string cache_key;
+  bool cached;
 };
 
 struct tsi_ssl_client_handshaker_factory {
@@ -133,11 +212,27 @@ struct tsi_ssl_frame_protector {
   size_t buffer_size;
   size_t buffer_offset;
 };
+struct tsi_ssl_zero_copy_grpc_protector {
+  tsi_zero_copy_grpc_protector base;
+  SSL* ssl;
+  BIO* network_io;
+  /* Protect and unprotect may run concurrently but share the SSL object. */
+  gpr_mu mu;
+  size_t max_protected_frame_size;
+  /* Plaintext bytes sealed into each TLS record. */
+  size_t record_size;
+  /* Gathers the plaintext of a record that spans several input slices. */
+  unsigned char* record_buffer;
+};
 /* --- Library Initialization. ---*/
 
 static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
 static int g_ssl_ctx_ex_factory_index = -1;
 static const unsigned char kSslSessionIdContext[] = {'g', 'r', 'p', 'c'};
+static tsi_ssl_session_ticket_keys* g_session_ticket_keys = nullptr;
+static tsi_ssl_peer_verification_cache* g_peer_verification_cache = nullptr;
+static gpr_atm g_next_root_certs_store_id = 0;
+static int g_ssl_ex_peer_verification_index = -1;
 #ifndef OPENSSL_IS_BORINGSSL
 static const char kSslEnginePrefix[] = "engine:";
 #endif
@@ -161,6 +256,12 @@ static unsigned long openssl_thread_id_cb(void) {
 }
 #endif
 
+static void ssl_peer_verification_free(void* /*parent*/, void* ptr,
+                                       CRYPTO_EX_DATA* /*ad*/, int /*index*/,
+                                       long /*argl*/, void* /*argp*/) {
+  delete static_cast<tsi_ssl_peer_verification*>(ptr);
+}
+
 static void init_openssl(void) {
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
   OPENSSL_init_ssl(0, nullptr);
@@ -187,6 +288,19 @@ static void init_openssl(void) {
   g_ssl_ctx_ex_factory_index =
       SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
   GPR_ASSERT(g_ssl_ctx_ex_factory_index != -1);
+  g_session_ticket_keys = new tsi_ssl_session_ticket_keys();
+  gpr_mu_init(&g_session_ticket_keys->mu);
+  g_session_ticket_keys->rotation_period = gpr_time_from_seconds(
+      TSI_SSL_DEFAULT_SESSION_TICKET_KEY_ROTATION_SECONDS, GPR_TIMESPAN);
+  /* The first key is generated when it is first needed. */
+  g_session_ticket_keys->next_rotation = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  g_peer_verification_cache = new tsi_ssl_peer_verification_cache();
+  gpr_mu_init(&g_peer_verification_cache->mu);
+  g_peer_verification_cache->capacity = 0;
+  g_peer_verification_cache->ttl = gpr_time_0(GPR_TIMESPAN);
+  g_ssl_ex_peer_verification_index = SSL_get_ex_new_index(
+      0, nullptr, nullptr, nullptr, ssl_peer_verification_free);
+  GPR_ASSERT(g_ssl_ex_peer_verification_index != -1);
 }
 
 /* --- Ssl utils. ---*/
@@ -963,6 +1077,8 @@ tsi_ssl_root_certs_store* tsi_ssl_root_certs_store_create(
     gpr_free(root_store);
     return nullptr;
   }
+  root_store->id =
+      gpr_atm_no_barrier_fetch_add(&g_next_root_certs_store_id, 1);
   return root_store;
 }
 
@@ -989,6 +1105,344 @@ void tsi_ssl_session_cache_unref(tsi_ssl_session_cache* cache) {
   reinterpret_cast<tsi::SslSessionLRUCache*>(cache)->Unref();
 }
 
+/* --- Shared session ticket keys. ---*/
+
+/* Puts a new random key in front of the shared keys if the current one is due
+   for rotation. The replaced key is kept for one more period. */
+static void ssl_session_ticket_keys_maybe_rotate_locked(
+    tsi_ssl_session_ticket_keys* self) {
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  if (gpr_time_cmp(now, self->next_rotation) < 0) return;
+  std::string key(TSI_SSL_SESSION_TICKET_KEY_SIZE, '\0');
+  if (RAND_bytes(reinterpret_cast<unsigned char*>(&key[0]),
+                 static_cast<int>(key.size())) != 1) {
+    gpr_log(GPR_ERROR, "Could not generate a session ticket key.");
+    return;
+  }
+  bool keep_current =
+      !self->keys.empty() &&
+      gpr_time_cmp(now, gpr_time_add(self->next_rotation,
+                                     self->rotation_period)) < 0;
+  self->keys.resize(keep_current ? 1 : 0);
+  self->keys.insert(self->keys.begin(), std::move(key));
+  self->next_rotation = gpr_time_add(now, self->rotation_period);
+}
+
+tsi_result tsi_ssl_set_session_ticket_keys(const char* keys, size_t keys_size,
+                                           int64_t rotation_period_seconds) {
+  if ((keys == nullptr) != (keys_size == 0) ||
+      keys_size % TSI_SSL_SESSION_TICKET_KEY_SIZE != 0 ||
+      rotation_period_seconds < 0) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  gpr_once_init(&g_init_openssl_once, init_openssl);
+  tsi_ssl_session_ticket_keys* self = g_session_ticket_keys;
+  gpr_mu_lock(&self->mu);
+  self->keys.clear();
+  for (size_t i = 0; i < keys_size; i += TSI_SSL_SESSION_TICKET_KEY_SIZE) {
+    self->keys.emplace_back(keys + i, TSI_SSL_SESSION_TICKET_KEY_SIZE);
+  }
+  self->rotation_period =
+      rotation_period_seconds == 0
+          ? gpr_inf_future(GPR_TIMESPAN)
+          : gpr_time_from_seconds(rotation_period_seconds, GPR_TIMESPAN);
+  self->next_rotation =
+      keys == nullptr ? gpr_inf_past(GPR_CLOCK_MONOTONIC)
+                      : gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                                     self->rotation_period);
+  gpr_mu_unlock(&self->mu);
+  return TSI_OK;
+}
+
+/* Session ticket key callback of the server SSL contexts using the shared
+   keys. Returns 1 when a ticket was sealed or opened with the current key, 2
+   when it was opened with an older key (so that a fresh ticket gets issued),
+   0 when no key opens it, and -1 on error. */
+static int ssl_server_session_ticket_key_callback(
+    SSL* /*ssl*/, unsigned char* key_name, unsigned char* iv,
+    EVP_CIPHER_CTX* cipher_ctx, HMAC_CTX* hmac_ctx, int encrypt) {
+  tsi_ssl_session_ticket_keys* self = g_session_ticket_keys;
+  const size_t name_size = 16;
+  const size_t secret_size = 16;
+  std::string key;
+  int result = 1;
+  gpr_mu_lock(&self->mu);
+  ssl_session_ticket_keys_maybe_rotate_locked(self);
+  if (encrypt) {
+    if (!self->keys.empty()) key = self->keys[0];
+  } else {
+    for (size_t i = 0; i < self->keys.size(); i++) {
+      if (memcmp(self->keys[i].data(), key_name, name_size) == 0) {
+        key = self->keys[i];
+        result = i == 0 ? 1 : 2;
+        break;
+      }
+    }
+  }
+  gpr_mu_unlock(&self->mu);
+  if (key.empty()) return encrypt ? -1 : 0;
+  const unsigned char* key_bytes =
+      reinterpret_cast<const unsigned char*>(key.data());
+  const unsigned char* hmac_secret = key_bytes + name_size;
+  const unsigned char* aes_key = hmac_secret + secret_size;
+  if (encrypt) {
+    memcpy(key_name, key_bytes, name_size);
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_128_cbc())) != 1 ||
+        !EVP_EncryptInit_ex(cipher_ctx, EVP_aes_128_cbc(), nullptr, aes_key,
+                            iv)) {
+      result = -1;
+    }
+  } else if (!EVP_DecryptInit_ex(cipher_ctx, EVP_aes_128_cbc(), nullptr,
+                                 aes_key, iv)) {
+    result = -1;
+  }
+  if (result != -1 &&
+      !HMAC_Init_ex(hmac_ctx, hmac_secret, static_cast<int>(secret_size),
+                    EVP_sha256(), nullptr)) {
+    result = -1;
+  }
+  OPENSSL_cleanse(&key[0], key.size());
+  return result;
+}
+
+/* --- Peer verification cache. ---*/
+
+/* Returns the chain cached under key, after moving it to the front of the
+   LRU list, or nullptr if there is none or it expired. */
+static tsi_ssl_verified_peer_chain* ssl_peer_verification_cache_find_locked(
+    tsi_ssl_peer_verification_cache* self, const std::string& key) {
+  auto it = self->index.find(key);
+  if (it == self->index.end()) return nullptr;
+  if (gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), it->second->expiration) >=
+      0) {
+    self->chains.erase(it->second);
+    self->index.erase(it);
+    return nullptr;
+  }
+  self->chains.splice(self->chains.begin(), self->chains, it->second);
+  return &*it->second;
+}
+
+static void ssl_peer_verification_cache_clear_locked(
+    tsi_ssl_peer_verification_cache* self) {
+  self->index.clear();
+  self->chains.clear();
+}
+
+tsi_result tsi_ssl_set_peer_verification_cache_options(size_t capacity,
+                                                       int64_t ttl_seconds) {
+  if (capacity > 0 && ttl_seconds <= 0) return TSI_INVALID_ARGUMENT;
+  gpr_once_init(&g_init_openssl_once, init_openssl);
+  tsi_ssl_peer_verification_cache* self = g_peer_verification_cache;
+  gpr_mu_lock(&self->mu);
+  self->capacity = capacity;
+  self->ttl = gpr_time_from_seconds(ttl_seconds, GPR_TIMESPAN);
+  ssl_peer_verification_cache_clear_locked(self);
+  gpr_mu_unlock(&self->mu);
+  return TSI_OK;
+}
+
+void tsi_ssl_peer_verification_cache_flush(void) {
+  gpr_once_init(&g_init_openssl_once, init_openssl);
+  tsi_ssl_peer_verification_cache* self = g_peer_verification_cache;
+  gpr_mu_lock(&self->mu);
+  ssl_peer_verification_cache_clear_locked(self);
+  gpr_mu_unlock(&self->mu);
+}
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000
+#define EVP_MD_CTX_new EVP_MD_CTX_create
+#define EVP_MD_CTX_free EVP_MD_CTX_destroy
+#endif
+
+/* Sets the trust id of a factory verifying its peers against pem_root_certs
+   or root_store. */
+static void ssl_set_peer_trust_id(tsi_ssl_handshaker_factory* factory,
+                                  bool is_server, const char* pem_root_certs,
+                                  const tsi_ssl_root_certs_store* root_store) {
+  /* The side matters as clients and servers check different certificate
+     purposes. */
+  unsigned char side = is_server ? 1 : 0;
+  EVP_MD_CTX* sha256 = EVP_MD_CTX_new();
+  GPR_ASSERT(sha256 != nullptr);
+  GPR_ASSERT(EVP_DigestInit_ex(sha256, EVP_sha256(), nullptr));
+  GPR_ASSERT(EVP_DigestUpdate(sha256, &side, sizeof(side)));
+  if (pem_root_certs != nullptr) {
+    GPR_ASSERT(
+        EVP_DigestUpdate(sha256, pem_root_certs, strlen(pem_root_certs)));
+  }
+  if (root_store != nullptr) {
+    GPR_ASSERT(
+        EVP_DigestUpdate(sha256, &root_store->id, sizeof(root_store->id)));
+  }
+  GPR_ASSERT(EVP_DigestFinal_ex(sha256, factory->peer_trust_id, nullptr));
+  EVP_MD_CTX_free(sha256);
+}
+
+/* Looks up the x509 properties cached for the chain under key and fills peer
+   with them. Returns false if there are none. */
+static bool ssl_peer_verification_cache_get_peer(const std::string& key,
+                                                 tsi_peer* peer) {
+  tsi_ssl_peer_verification_cache* self = g_peer_verification_cache;
+  std::vector<std::pair<std::string, std::string>> properties;
+  gpr_mu_lock(&self->mu);
+  tsi_ssl_verified_peer_chain* chain =
+      ssl_peer_verification_cache_find_locked(self, key);
+  bool found = chain != nullptr && chain->has_peer_properties;
+  if (found) properties = chain->peer_properties;
+  gpr_mu_unlock(&self->mu);
+  if (!found || tsi_construct_peer(properties.size(), peer) != TSI_OK) {
+    return false;
+  }
+  for (size_t i = 0; i < properties.size(); i++) {
+    if (tsi_construct_string_peer_property(
+            properties[i].first.c_str(), properties[i].second.data(),
+            properties[i].second.size(), &peer->properties[i]) != TSI_OK) {
+      tsi_peer_destruct(peer);
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Caches the x509 properties of peer for the chain under key. */
+static void ssl_peer_verification_cache_set_peer(const std::string& key,
+                                                 const tsi_peer* peer) {
+  std::vector<std::pair<std::string, std::string>> properties;
+  for (size_t i = 0; i < peer->property_count; i++) {
+    properties.emplace_back(
+        peer->properties[i].name,
+        std::string(peer->properties[i].value.data,
+                    peer->properties[i].value.length));
+  }
+  tsi_ssl_peer_verification_cache* self = g_peer_verification_cache;
+  gpr_mu_lock(&self->mu);
+  tsi_ssl_verified_peer_chain* chain =
+      ssl_peer_verification_cache_find_locked(self, key);
+  if (chain != nullptr && !chain->has_peer_properties) {
+    chain->peer_properties = std::move(properties);
+    chain->has_peer_properties = true;
+  }
+  gpr_mu_unlock(&self->mu);
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+/* Computes the cache key of the chain presented by a peer. Returns false if
+   the chain cannot be hashed. */
+static bool ssl_peer_verification_cache_key(const unsigned char* trust_id,
+                                            X509* cert, STACK_OF(X509) * chain,
+                                            std::string* key) {
+  unsigned char cert_digest[SHA256_DIGEST_LENGTH];
+  unsigned int digest_size;
+  if (cert == nullptr ||
+      !X509_digest(cert, EVP_sha256(), cert_digest, &digest_size)) {
+    return false;
+  }
+  EVP_MD_CTX* sha256 = EVP_MD_CTX_new();
+  if (sha256 == nullptr) return false;
+  bool ok = EVP_DigestInit_ex(sha256, EVP_sha256(), nullptr) &&
+            EVP_DigestUpdate(sha256, trust_id, SHA256_DIGEST_LENGTH) &&
+            EVP_DigestUpdate(sha256, cert_digest, sizeof(cert_digest));
+  if (ok && chain != nullptr) {
+    const auto chain_len = sk_X509_num(chain);
+    for (auto i = decltype(chain_len){0}; ok && i < chain_len; i++) {
+      unsigned char digest[SHA256_DIGEST_LENGTH];
+      if (!X509_digest(sk_X509_value(chain, i), EVP_sha256(), digest,
+                       &digest_size)) {
+        ok = false;
+        break;
+      }
+      // Whether the chain starts with the leaf depends on the side and on the
+      // SSL implementation.
+      if (memcmp(digest, cert_digest, sizeof(digest)) == 0) continue;
+      ok = EVP_DigestUpdate(sha256, digest, sizeof(digest));
+    }
+  }
+  if (ok) {
+    key->resize(SHA256_DIGEST_LENGTH);
+    ok = EVP_DigestFinal_ex(
+        sha256, reinterpret_cast<unsigned char*>(&(*key)[0]), nullptr);
+  }
+  EVP_MD_CTX_free(sha256);
+  return ok;
+}
+
+/* Returns how long the chain just verified in store_ctx may stay cached:
+   ttl, unless one of its certificates expires earlier. */
+static gpr_timespec ssl_verified_peer_chain_lifetime(
+    X509_STORE_CTX* store_ctx, gpr_timespec ttl) {
+  STACK_OF(X509)* chain = X509_STORE_CTX_get0_chain(store_ctx);
+  if (chain == nullptr) return gpr_time_0(GPR_TIMESPAN);
+  const auto chain_len = sk_X509_num(chain);
+  for (auto i = decltype(chain_len){0}; i < chain_len; i++) {
+    int days;
+    int seconds;
+    if (!ASN1_TIME_diff(&days, &seconds, nullptr,
+                        X509_get0_notAfter(sk_X509_value(chain, i)))) {
+      return gpr_time_0(GPR_TIMESPAN);
+    }
+    gpr_timespec remaining = gpr_time_from_seconds(
+        static_cast<int64_t>(days) * 24 * 60 * 60 + seconds, GPR_TIMESPAN);
+    if (gpr_time_cmp(remaining, ttl) < 0) ttl = remaining;
+  }
+  return ttl;
+}
+
+/* Certificate verification callback of the SSL contexts verifying their
+   peers, arg being the trust id of their factory. Skips X509_verify_cert for
+   the chains in the peer verification cache, and adds the others to it once
+   verified. */
+static int ssl_peer_verification_cache_verify_callback(
+    X509_STORE_CTX* store_ctx, void* arg) {
+  tsi_ssl_peer_verification_cache* self = g_peer_verification_cache;
+  SSL* ssl = static_cast<SSL*>(X509_STORE_CTX_get_ex_data(
+      store_ctx, SSL_get_ex_data_X509_STORE_CTX_idx()));
+  gpr_mu_lock(&self->mu);
+  bool enabled = self->capacity > 0;
+  gpr_timespec ttl = self->ttl;
+  gpr_mu_unlock(&self->mu);
+  std::string key;
+  if (!enabled || ssl == nullptr ||
+      !ssl_peer_verification_cache_key(
+          static_cast<const unsigned char*>(arg),
+          X509_STORE_CTX_get0_cert(store_ctx),
+          X509_STORE_CTX_get0_untrusted(store_ctx), &key)) {
+    return X509_verify_cert(store_ctx);
+  }
+  gpr_mu_lock(&self->mu);
+  bool cached = ssl_peer_verification_cache_find_locked(self, key) != nullptr;
+  gpr_mu_unlock(&self->mu);
+  if (!cached) {
+    int result = X509_verify_cert(store_ctx);
+    if (result != 1) return result;
+    gpr_timespec lifetime = ssl_verified_peer_chain_lifetime(store_ctx, ttl);
+    if (gpr_time_cmp(lifetime, gpr_time_0(GPR_TIMESPAN)) > 0) {
+      gpr_mu_lock(&self->mu);
+      if (self->capacity > 0 &&
+          ssl_peer_verification_cache_find_locked(self, key) == nullptr) {
+        self->chains.emplace_front();
+        tsi_ssl_verified_peer_chain* chain = &self->chains.front();
+        chain->key = key;
+        chain->expiration =
+            gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC), lifetime);
+        chain->has_peer_properties = false;
+        self->index[key] = self->chains.begin();
+        while (self->chains.size() > self->capacity) {
+          self->index.erase(self->chains.back().key);
+          self->chains.pop_back();
+        }
+      }
+      gpr_mu_unlock(&self->mu);
+    }
+  }
+  delete static_cast<tsi_ssl_peer_verification*>(
+      SSL_get_ex_data(ssl, g_ssl_ex_peer_verification_index));
+  SSL_set_ex_data(ssl, g_ssl_ex_peer_verification_index,
+                  new tsi_ssl_peer_verification{std::move(key), cached});
+  return 1;
+}
+#endif
+
 /* --- tsi_frame_protector methods implementation. ---*/
 
 static tsi_result ssl_protector_protect(tsi_frame_protector* self,
@@ -1140,6 +1594,202 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_destroy,
 };
 
+/* --- tsi_zero_copy_grpc_protector methods implementation. ---*/
+
+/* Moves the records SSL_write left in the network BIO to the end of *chunk,
+   handing the filled part of *chunk to protected_slices first if it lacks
+   room. */
+static tsi_result ssl_zero_copy_grpc_protector_read_records(
+    tsi_ssl_zero_copy_grpc_protector* impl, grpc_slice* chunk,
+    size_t* chunk_used, grpc_slice_buffer* protected_slices) {
+  int pending = static_cast<int>(BIO_pending(impl->network_io));
+  GPR_ASSERT(pending >= 0);
+  size_t pending_size = static_cast<size_t>(pending);
+  if (pending_size > GRPC_SLICE_LENGTH(*chunk) - *chunk_used) {
+    if (*chunk_used > 0) {
+      grpc_slice_buffer_add(protected_slices,
+                            grpc_slice_split_head(chunk, *chunk_used));
+    }
+    grpc_slice_unref_internal(*chunk);
+    *chunk = GRPC_SLICE_MALLOC(pending_size);
+    *chunk_used = 0;
+  }
+  if (pending_size == 0) return TSI_OK;
+  int read_from_ssl = BIO_read(impl->network_io,
+                               GRPC_SLICE_START_PTR(*chunk) + *chunk_used,
+                               pending);
+  if (read_from_ssl != pending) {
+    gpr_log(GPR_ERROR, "Could not read from BIO after SSL_write.");
+    return TSI_INTERNAL_ERROR;
+  }
+  *chunk_used += pending_size;
+  return TSI_OK;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_protect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_mu_lock(&impl->mu);
+  /* Flush anything SSL wrote on its own, e.g. after a post-handshake message,
+     so that the network BIO has room for a full record. */
+  grpc_slice pending = grpc_empty_slice();
+  size_t pending_used = 0;
+  tsi_result result = ssl_zero_copy_grpc_protector_read_records(
+      impl, &pending, &pending_used, protected_slices);
+  if (pending_used > 0) {
+    grpc_slice_buffer_add(protected_slices, grpc_slice_ref_internal(pending));
+  }
+  grpc_slice_unref_internal(pending);
+  while (result == TSI_OK && unprotected_slices->length > 0) {
+    /* Seal a batch of records into one output slice, sized to their
+       plaintext plus the per-record overhead. */
+    size_t num_records = GPR_MIN(
+        (unprotected_slices->length + impl->record_size - 1) /
+            impl->record_size,
+        static_cast<size_t>(TSI_SSL_ZERO_COPY_MAX_RECORDS_PER_SLICE));
+    size_t plaintext_size =
+        GPR_MIN(unprotected_slices->length, num_records * impl->record_size);
+    grpc_slice chunk = GRPC_SLICE_MALLOC(
+        plaintext_size + num_records * TSI_SSL_MAX_PROTECTION_OVERHEAD);
+    size_t chunk_used = 0;
+    for (size_t i = 0; i < num_records; i++) {
+      size_t size = GPR_MIN(unprotected_slices->length, impl->record_size);
+      grpc_slice* first = grpc_slice_buffer_peek_first(unprotected_slices);
+      size_t first_size = GRPC_SLICE_LENGTH(*first);
+      if (first_size >= size) {
+        /* The record lies within one slice: hand it to SSL_write from there
+           rather than gathering it first. */
+        result = do_ssl_write(impl->ssl, GRPC_SLICE_START_PTR(*first), size);
+        if (first_size == size) {
+          grpc_slice_buffer_remove_first(unprotected_slices);
+        } else {
+          grpc_slice_buffer_sub_first(unprotected_slices, size, first_size);
+        }
+      } else {
+        grpc_slice_buffer_move_first_into_buffer(unprotected_slices, size,
+                                                 impl->record_buffer);
+        result = do_ssl_write(impl->ssl, impl->record_buffer, size);
+      }
+      if (result != TSI_OK) break;
+      result = ssl_zero_copy_grpc_protector_read_records(
+          impl, &chunk, &chunk_used, protected_slices);
+      if (result != TSI_OK) break;
+    }
+    if (chunk_used > 0) {
+      grpc_slice_buffer_add(protected_slices,
+                            grpc_slice_split_head(&chunk, chunk_used));
+    }
+    grpc_slice_unref_internal(chunk);
+  }
+  gpr_mu_unlock(&impl->mu);
+  return result;
+}
+
+/* Reads all plaintext SSL can produce from the records in the network BIO into
+   *chunk, handing full chunks to unprotected_slices. */
+static tsi_result ssl_zero_copy_grpc_protector_read_plaintext(
+    tsi_ssl_zero_copy_grpc_protector* impl, grpc_slice* chunk,
+    size_t* chunk_used, grpc_slice_buffer* unprotected_slices) {
+  for (;;) {
+    if (*chunk_used == GRPC_SLICE_LENGTH(*chunk)) {
+      if (*chunk_used > 0) {
+        grpc_slice_buffer_add(unprotected_slices,
+                              grpc_slice_split_head(chunk, *chunk_used));
+      }
+      grpc_slice_unref_internal(*chunk);
+      *chunk = GRPC_SLICE_MALLOC(impl->record_size);
+      *chunk_used = 0;
+    }
+    size_t read_size = GRPC_SLICE_LENGTH(*chunk) - *chunk_used;
+    tsi_result result = do_ssl_read(
+        impl->ssl, GRPC_SLICE_START_PTR(*chunk) + *chunk_used, &read_size);
+    if (result != TSI_OK) return result;
+    if (read_size == 0) return TSI_OK;
+    *chunk_used += read_size;
+  }
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_unprotect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  tsi_result result = TSI_OK;
+  gpr_mu_lock(&impl->mu);
+  /* Plaintext is never longer than its records, so a slice sized to the input
+     usually holds it. The plaintext of a record left incomplete by the
+     previous call goes to a further slice. */
+  grpc_slice chunk = GRPC_SLICE_MALLOC(protected_slices->length);
+  size_t chunk_used = 0;
+  for (size_t i = 0; result == TSI_OK && i < protected_slices->count; i++) {
+    const uint8_t* bytes = GRPC_SLICE_START_PTR(protected_slices->slices[i]);
+    size_t remaining = GRPC_SLICE_LENGTH(protected_slices->slices[i]);
+    while (remaining > 0) {
+      int written_into_ssl = BIO_write(
+          impl->network_io, bytes,
+          static_cast<int>(GPR_MIN(remaining, static_cast<size_t>(INT_MAX))));
+      if (written_into_ssl <= 0) {
+        gpr_log(GPR_ERROR, "Sending protected frame to ssl failed with %d",
+                written_into_ssl);
+        result = TSI_INTERNAL_ERROR;
+        break;
+      }
+      bytes += written_into_ssl;
+      remaining -= static_cast<size_t>(written_into_ssl);
+      result = ssl_zero_copy_grpc_protector_read_plaintext(
+          impl, &chunk, &chunk_used, unprotected_slices);
+      if (result != TSI_OK) break;
+    }
+  }
+  if (chunk_used > 0) {
+    grpc_slice_buffer_add(unprotected_slices,
+                          grpc_slice_split_head(&chunk, chunk_used));
+  }
+  grpc_slice_unref_internal(chunk);
+  gpr_mu_unlock(&impl->mu);
+  grpc_slice_buffer_reset_and_unref_internal(protected_slices);
+  return result;
+}
+
+static void ssl_zero_copy_grpc_protector_destroy(
+    tsi_zero_copy_grpc_protector* self) {
+  if (self == nullptr) return;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_free(impl->record_buffer);
+  SSL_free(impl->ssl);
+  BIO_free(impl->network_io);
+  gpr_mu_destroy(&impl->mu);
+  gpr_free(impl);
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_max_frame_size(
+    tsi_zero_copy_grpc_protector* self, size_t* max_frame_size) {
+  if (self == nullptr || max_frame_size == nullptr) return TSI_INVALID_ARGUMENT;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  *max_frame_size = impl->max_protected_frame_size;
+  return TSI_OK;
+}
+
+static const tsi_zero_copy_grpc_protector_vtable
+    zero_copy_grpc_protector_vtable = {
+        ssl_zero_copy_grpc_protector_protect,
+        ssl_zero_copy_grpc_protector_unprotect,
+        ssl_zero_copy_grpc_protector_destroy,
+        ssl_zero_copy_grpc_protector_max_frame_size,
+};
+
 /* --- tsi_server_handshaker_factory methods implementation. --- */
 
 static void tsi_ssl_handshaker_factory_destroy(
@@ -1213,7 +1863,15 @@ static tsi_result ssl_handshaker_result_extract_peer(
   unsigned int alpn_selected_len;
   const tsi_ssl_handshaker_result* impl =
       reinterpret_cast<const tsi_ssl_handshaker_result*>(self);
-  X509* peer_cert = SSL_get_peer_certificate(impl->ssl);
+  const tsi_ssl_peer_verification* verification =
+      static_cast<const tsi_ssl_peer_verification*>(
+          SSL_get_ex_data(impl->ssl, g_ssl_ex_peer_verification_index));
+  /* The x509 properties of a chain found in the peer verification cache were
+     extracted by the handshake that added it. */
+  bool cached_peer = verification != nullptr && verification->cached &&
+                     ssl_peer_verification_cache_get_peer(
+                         verification->cache_key, peer);
+  X509* peer_cert = cached_peer ? nullptr : SSL_get_peer_certificate(impl->ssl);
   if (peer_cert != nullptr) {
     result = peer_from_x509(peer_cert, 1, peer);
     X509_free(peer_cert);
@@ -1230,11 +1888,13 @@ static tsi_result ssl_handshaker_result_extract_peer(
   // When called on the client side, the stack also contains the
   // peer's certificate; When called on the server side,
   // the peer's certificate is not present in the stack
-  STACK_OF(X509)* peer_chain = SSL_get_peer_cert_chain(impl->ssl);
+  STACK_OF(X509)* peer_chain =
+      cached_peer ? nullptr : SSL_get_peer_cert_chain(impl->ssl);
   // 1 is for session reused property.
   size_t new_property_count = peer->property_count + 3;
   if (alpn_selected != nullptr) new_property_count++;
   if (peer_chain != nullptr) new_property_count++;
+  if (verification != nullptr) new_property_count++;
   tsi_peer_property* new_properties = static_cast<tsi_peer_property*>(
       gpr_zalloc(sizeof(*new_properties) * new_property_count));
   for (size_t i = 0; i < peer->property_count; i++) {
@@ -1248,6 +1908,17 @@ static tsi_result ssl_handshaker_result_extract_peer(
         peer_chain, &peer->properties[peer->property_count]);
     if (result == TSI_OK) peer->property_count++;
   }
+  if (verification != nullptr) {
+    if (!cached_peer) {
+      ssl_peer_verification_cache_set_peer(verification->cache_key, peer);
+    }
+    result = tsi_construct_string_peer_property_from_cstring(
+        TSI_SSL_PEER_VERIFICATION_CACHED_PEER_PROPERTY,
+        verification->cached ? "true" : "false",
+        &peer->properties[peer->property_count]);
+    if (result != TSI_OK) return result;
+    peer->property_count++;
+  }
   if (alpn_selected != nullptr) {
     result = tsi_construct_string_peer_property(
         TSI_SSL_ALPN_SELECTED_PROTOCOL,
@@ -1273,11 +1944,57 @@ static tsi_result ssl_handshaker_result_extract_peer(
   return result;
 }
 
+/* Clamps the requested protected frame size to what SSL supports and returns
+   the size to use. */
+static size_t ssl_max_output_protected_frame_size(
+    size_t* max_output_protected_frame_size) {
+  if (max_output_protected_frame_size == nullptr) {
+    return TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  }
+  if (*max_output_protected_frame_size >
+      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  } else if (*max_output_protected_frame_size <
+             TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
+  }
+  return *max_output_protected_frame_size;
+}
+
+static tsi_result ssl_handshaker_result_create_zero_copy_grpc_protector(
+    const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector) {
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(
+          const_cast<tsi_handshaker_result*>(self));
+  tsi_ssl_zero_copy_grpc_protector* protector_impl =
+      static_cast<tsi_ssl_zero_copy_grpc_protector*>(
+          gpr_zalloc(sizeof(*protector_impl)));
+  protector_impl->max_protected_frame_size =
+      ssl_max_output_protected_frame_size(max_output_protected_frame_size);
+  protector_impl->record_size = protector_impl->max_protected_frame_size -
+                                TSI_SSL_MAX_PROTECTION_OVERHEAD;
+  protector_impl->record_buffer =
+      static_cast<unsigned char*>(gpr_malloc(protector_impl->record_size));
+  gpr_mu_init(&protector_impl->mu);
+
+  /* Transfer ownership of ssl and network_io to the protector. */
+  protector_impl->ssl = impl->ssl;
+  impl->ssl = nullptr;
+  protector_impl->network_io = impl->network_io;
+  impl->network_io = nullptr;
+  protector_impl->base.vtable = &zero_copy_grpc_protector_vtable;
+  *protector = &protector_impl->base;
+  return TSI_OK;
+}
+
 static tsi_result ssl_handshaker_result_create_frame_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_frame_protector** protector) {
   size_t actual_max_output_protected_frame_size =
-      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+      ssl_max_output_protected_frame_size(max_output_protected_frame_size);
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(
           const_cast<tsi_handshaker_result*>(self));
@@ -1285,18 +2002,6 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
       static_cast<tsi_ssl_frame_protector*>(
           gpr_zalloc(sizeof(*protector_impl)));
 
-  if (max_output_protected_frame_size != nullptr) {
-    if (*max_output_protected_frame_size >
-        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
-    } else if (*max_output_protected_frame_size <
-               TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
-    }
-    actual_max_output_protected_frame_size = *max_output_protected_frame_size;
-  }
   protector_impl->buffer_size =
       actual_max_output_protected_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
   protector_impl->buffer =
@@ -1337,12 +2042,127 @@ static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   gpr_free(impl);
 }
 
+#ifdef TSI_SSL_KTLS_SUPPORT
+/* Installs one direction of a TLS 1.2 AES-GCM connection state on fd. The
+   explicit part of the nonce continues from the record sequence number, as
+   BoringSSL does. */
+template <typename CryptoInfo>
+static int ssl_ktls_set_crypto_info(int fd, int direction,
+                                    unsigned short cipher_type,
+                                    const unsigned char* key,
+                                    const unsigned char* salt, uint64_t seq) {
+  CryptoInfo info;
+  memset(&info, 0, sizeof(info));
+  info.info.version = TLS_1_2_VERSION;
+  info.info.cipher_type = cipher_type;
+  memcpy(info.key, key, sizeof(info.key));
+  memcpy(info.salt, salt, sizeof(info.salt));
+  for (int i = static_cast<int>(sizeof(info.rec_seq)) - 1; i >= 0; i--) {
+    info.rec_seq[i] = static_cast<unsigned char>(seq & 0xff);
+    seq >>= 8;
+  }
+  memcpy(info.iv, info.rec_seq, sizeof(info.iv));
+  int ret = setsockopt(fd, SOL_TLS, direction, &info, sizeof(info));
+  OPENSSL_cleanse(&info, sizeof(info));
+  return ret;
+}
+
+static int ssl_ktls_set_direction(int fd, int direction, size_t key_size,
+                                  const unsigned char* key,
+                                  const unsigned char* salt, uint64_t seq) {
+  if (key_size == TLS_CIPHER_AES_GCM_128_KEY_SIZE) {
+    return ssl_ktls_set_crypto_info<tls12_crypto_info_aes_gcm_128>(
+        fd, direction, TLS_CIPHER_AES_GCM_128, key, salt, seq);
+  }
+#ifdef TLS_CIPHER_AES_GCM_256
+  return ssl_ktls_set_crypto_info<tls12_crypto_info_aes_gcm_256>(
+      fd, direction, TLS_CIPHER_AES_GCM_256, key, salt, seq);
+#else
+  return -1;
+#endif
+}
+
+static tsi_result ssl_handshaker_result_offload_record_protection(
+    const tsi_handshaker_result* self, int fd) {
+  const tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<const tsi_ssl_handshaker_result*>(self);
+  SSL* ssl = impl->ssl;
+  if (ssl == nullptr) return TSI_FAILED_PRECONDITION;
+  /* TLS 1.3 is left to userspace: BoringSSL does not export its traffic
+     secrets, and post-handshake messages such as session tickets would reach
+     the kernel as records it cannot hand back as data. */
+  if (SSL_version(ssl) != TLS1_2_VERSION || SSL_in_init(ssl)) {
+    return TSI_UNIMPLEMENTED;
+  }
+  /* Bytes that already went through ssl in either direction cannot be
+     accounted for by the kernel. */
+  if (impl->unused_bytes_size > 0 || SSL_pending(ssl) > 0 ||
+      BIO_pending(SSL_get_rbio(ssl)) > 0 || BIO_pending(impl->network_io) > 0) {
+    return TSI_UNIMPLEMENTED;
+  }
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+  int cipher_nid =
+      cipher == nullptr ? NID_undef : SSL_CIPHER_get_cipher_nid(cipher);
+  size_t key_size;
+  if (cipher_nid == NID_aes_128_gcm) {
+    key_size = TLS_CIPHER_AES_GCM_128_KEY_SIZE;
+#ifdef TLS_CIPHER_AES_GCM_256
+  } else if (cipher_nid == NID_aes_256_gcm) {
+    key_size = TLS_CIPHER_AES_GCM_256_KEY_SIZE;
+#endif
+  } else {
+    return TSI_UNIMPLEMENTED;
+  }
+  /* With an AEAD the key block holds no MAC keys: it is the client and server
+     write keys followed by the client and server implicit nonces. */
+  const size_t salt_size = TLS_CIPHER_AES_GCM_128_SALT_SIZE;
+  unsigned char key_block[2 * (32 + TLS_CIPHER_AES_GCM_128_SALT_SIZE)];
+  size_t key_block_size = 2 * (key_size + salt_size);
+  if (static_cast<size_t>(SSL_get_key_block_len(ssl)) != key_block_size ||
+      !SSL_generate_key_block(ssl, key_block, key_block_size)) {
+    return TSI_UNIMPLEMENTED;
+  }
+  const unsigned char* client_key = key_block;
+  const unsigned char* server_key = key_block + key_size;
+  const unsigned char* client_salt = key_block + 2 * key_size;
+  const unsigned char* server_salt = client_salt + salt_size;
+  bool is_server = SSL_is_server(ssl);
+  tsi_result result = TSI_OK;
+  /* Until a direction is installed the socket still behaves as plain TCP, so
+     anything the kernel rejects up to that point can fall back to userspace.
+     The "tls" upper layer protocol stays attached if installing receive
+     fails, but passes data through unchanged. Receive is installed first
+     because it needs the newer kernel. */
+  if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0 ||
+      ssl_ktls_set_direction(fd, TLS_RX, key_size,
+                             is_server ? client_key : server_key,
+                             is_server ? client_salt : server_salt,
+                             SSL_get_read_sequence(ssl)) != 0) {
+    result = TSI_UNIMPLEMENTED;
+  } else if (ssl_ktls_set_direction(fd, TLS_TX, key_size,
+                                    is_server ? server_key : client_key,
+                                    is_server ? server_salt : client_salt,
+                                    SSL_get_write_sequence(ssl)) != 0) {
+    gpr_log(GPR_ERROR, "Could not install kernel TLS send state: %s",
+            strerror(errno));
+    result = TSI_INTERNAL_ERROR;
+  }
+  OPENSSL_cleanse(key_block, sizeof(key_block));
+  return result;
+}
+#endif /* TSI_SSL_KTLS_SUPPORT */
+
 static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_extract_peer,
-    nullptr, /* create_zero_copy_grpc_protector */
+    ssl_handshaker_result_create_zero_copy_grpc_protector,
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+#ifdef TSI_SSL_KTLS_SUPPORT
+    ssl_handshaker_result_offload_record_protection,
+#else
+    nullptr, /* ssl_handshaker_result_offload_record_protection */
+#endif
 };
 
 static tsi_result ssl_handshaker_result_create(
@@ -1971,6 +2791,13 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
     SSL_CTX_set_verify(ssl_context, SSL_VERIFY_PEER, NullVerifyCallback);
   } else {
     SSL_CTX_set_verify(ssl_context, SSL_VERIFY_PEER, nullptr);
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+    ssl_set_peer_trust_id(&impl->base, false, options->pem_root_certs,
+                          options->root_store);
+    SSL_CTX_set_cert_verify_callback(
+        ssl_context, ssl_peer_verification_cache_verify_callback,
+        impl->base.peer_trust_id);
+#endif
   }
   /* TODO(jboeuf): Add revocation verification. */
 
@@ -2032,6 +2859,8 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
       gpr_zalloc(sizeof(*impl)));
   tsi_ssl_handshaker_factory_init(&impl->base);
   impl->base.vtable = &server_handshaker_factory_vtable;
+  ssl_set_peer_trust_id(&impl->base, true, options->pem_client_root_certs,
+                        nullptr);
 
   impl->ssl_contexts = static_cast<SSL_CTX**>(
       gpr_zalloc(options->num_key_cert_pairs * sizeof(SSL_CTX*)));
@@ -2054,6 +2883,22 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
     }
   }
 
+  /* Session ticket keys may be shared with other factories, and a resumed
+     session skips the client certificate check. Only let sessions resume on
+     contexts that would have let the client in the same way. */
+  std::string session_id_context_input(
+      reinterpret_cast<const char*>(kSslSessionIdContext),
+      GPR_ARRAY_SIZE(kSslSessionIdContext));
+  session_id_context_input.push_back(
+      static_cast<char>(options->client_certificate_request));
+  if (options->pem_client_root_certs != nullptr) {
+    session_id_context_input.append(options->pem_client_root_certs);
+  }
+  unsigned char session_id_context[SHA256_DIGEST_LENGTH];
+  SHA256(reinterpret_cast<const unsigned char*>(
+             session_id_context_input.data()),
+         session_id_context_input.size(), session_id_context);
+
   for (i = 0; i < options->num_key_cert_pairs; i++) {
     do {
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
@@ -2075,19 +2920,24 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
                                     options->cipher_suites);
       if (result != TSI_OK) break;
 
-      // TODO(elessar): Provide ability to disable session ticket keys.
-
       // Allow client cache sessions (it's needed for OpenSSL only).
       int set_sid_ctx_result = SSL_CTX_set_session_id_context(
-          impl->ssl_contexts[i], kSslSessionIdContext,
-          GPR_ARRAY_SIZE(kSslSessionIdContext));
+          impl->ssl_contexts[i], session_id_context,
+          GPR_ARRAY_SIZE(session_id_context));
       if (set_sid_ctx_result == 0) {
         gpr_log(GPR_ERROR, "Failed to set session id context.");
         result = TSI_INTERNAL_ERROR;
         break;
       }
 
-      if (options->session_ticket_key != nullptr) {
+      if (options->disable_session_resumption) {
+        SSL_CTX_set_options(impl->ssl_contexts[i], SSL_OP_NO_TICKET);
+        SSL_CTX_set_session_cache_mode(impl->ssl_contexts[i],
+                                       SSL_SESS_CACHE_OFF);
+#if OPENSSL_VERSION_NUMBER >= 0x10101000 && !defined(OPENSSL_IS_BORINGSSL)
+        SSL_CTX_set_num_tickets(impl->ssl_contexts[i], 0);
+#endif
+      } else if (options->session_ticket_key != nullptr) {
         if (SSL_CTX_set_tlsext_ticket_keys(
                 impl->ssl_contexts[i],
                 const_cast<char*>(options->session_ticket_key),
@@ -2096,6 +2946,9 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
           result = TSI_INVALID_ARGUMENT;
           break;
         }
+      } else {
+        SSL_CTX_set_tlsext_ticket_key_cb(
+            impl->ssl_contexts[i], ssl_server_session_ticket_key_callback);
       }
 
       if (options->pem_client_root_certs != nullptr) {
@@ -2119,6 +2972,12 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
           break;
         case TSI_REQUEST_CLIENT_CERTIFICATE_AND_VERIFY:
           SSL_CTX_set_verify(impl->ssl_contexts[i], SSL_VERIFY_PEER, nullptr);
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+          SSL_CTX_set_cert_verify_callback(
+              impl->ssl_contexts[i],
+              ssl_peer_verification_cache_verify_callback,
+              impl->base.peer_trust_id);
+#endif
           break;
         case TSI_REQUEST_AND_REQUIRE_CLIENT_CERTIFICATE_BUT_DONT_VERIFY:
           SSL_CTX_set_verify(impl->ssl_contexts[i],
@@ -2129,6 +2988,12 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
           SSL_CTX_set_verify(impl->ssl_contexts[i],
                              SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT,
                              nullptr);
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+          SSL_CTX_set_cert_verify_callback(
+              impl->ssl_contexts[i],
+              ssl_peer_verification_cache_verify_callback,
+              impl->base.peer_trust_id);
+#endif
           break;
       }
       /* TODO(jboeuf): Add revocation verification. */
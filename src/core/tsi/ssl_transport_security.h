@@ -46,6 +46,20 @@ extern "C" {
 
 #define TSI_X509_URI_PEER_PROPERTY "x509_uri"
 
+/* "true" if the peer certificate chain was found in the peer verification
+   cache, "false" if it was verified and added to it. Only present when the
+   cache is enabled and the chain was verified during the handshake. */
+#define TSI_SSL_PEER_VERIFICATION_CACHED_PEER_PROPERTY \
+  "ssl_peer_verification_cached"
+
+/* Size of a session ticket key: a 16 byte key name followed by a 16 byte HMAC
+   secret and a 16 byte AES key. */
+#define TSI_SSL_SESSION_TICKET_KEY_SIZE 48
+
+/* Period after which the shared session ticket key is replaced, unless
+   tsi_ssl_set_session_ticket_keys says otherwise. */
+#define TSI_SSL_DEFAULT_SESSION_TICKET_KEY_ROTATION_SECONDS (12 * 60 * 60)
+
 /* --- tsi_ssl_root_certs_store object ---
 
    This object stores SSL root certificates. It can be shared by multiple SSL
@@ -279,10 +293,14 @@ struct tsi_ssl_server_handshaker_options {
      NULL. */
   uint16_t num_alpn_protocols;
   /* session_ticket_key is optional key for encrypting session keys. If
-     parameter is not specified it must be NULL. */
+     parameter is not specified it must be NULL, and the session ticket keys
+     shared by the process (see tsi_ssl_set_session_ticket_keys) are used. */
   const char* session_ticket_key;
   /* session_ticket_key_size is a size of session ticket encryption key. */
   size_t session_ticket_key_size;
+  /* If true, the server neither issues session tickets nor caches sessions,
+     so that every handshake is a full one. */
+  bool disable_session_resumption;
   /* The min and max TLS versions that will be negotiated by the handshaker. */
   tsi_tls_version min_tls_version;
   tsi_tls_version max_tls_version;
@@ -297,6 +315,7 @@ struct tsi_ssl_server_handshaker_options {
         num_alpn_protocols(0),
         session_ticket_key(nullptr),
         session_ticket_key_size(0),
+        disable_session_resumption(false),
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
         max_tls_version(tsi_tls_version::TSI_TLS1_3) {}
 };
@@ -325,6 +344,49 @@ tsi_result tsi_ssl_server_handshaker_factory_create_handshaker(
 void tsi_ssl_server_handshaker_factory_unref(
     tsi_ssl_server_handshaker_factory* self);
 
+/* Replaces the session ticket keys shared by all server handshaker factories
+   of the process that are created without a session_ticket_key, so that a
+   client can resume its session with any of them, including factories
+   created after the session was established.
+   - keys is NULL, in which case a random key is generated, or the
+     concatenation of one or more keys of TSI_SSL_SESSION_TICKET_KEY_SIZE
+     bytes each. The first key protects new tickets. The others only open
+     tickets issued earlier, e.g. by the previous instance of this server
+     during a rolling restart.
+   - rotation_period_seconds is how long the key protecting new tickets is
+     used before it is replaced by a random one. The replaced key still opens
+     tickets for one more period, and the keys after it are dropped. Zero
+     disables rotation.
+   Sessions are only resumed by factories with the same client certificate
+   settings. Keys default to random ones, rotated every
+   TSI_SSL_DEFAULT_SESSION_TICKET_KEY_ROTATION_SECONDS.
+
+   - This method returns TSI_OK on success or TSI_INVALID_ARGUMENT if
+     keys_size is not a multiple of the key size.  */
+tsi_result tsi_ssl_set_session_ticket_keys(const char* keys, size_t keys_size,
+                                           int64_t rotation_period_seconds);
+
+/* Configures the process-wide cache of verified peer certificate chains.
+   Handshakers verifying the peer against the same root certificates skip the
+   verification of a chain found in the cache, as well as the extraction of
+   the x509 properties of the peer.
+   - capacity is the maximum number of chains in the cache, the least
+     recently used being evicted first. Zero, the default, disables the cache.
+   - ttl_seconds is how long a chain stays in the cache after it was verified.
+     A chain is never kept past the expiration of any of its certificates.
+   The cache is keyed by the hash of the chain presented by the peer and of
+   the root certificates of the handshaker factory. Changes to the options
+   flush the cache.
+
+   - This method returns TSI_OK on success or TSI_INVALID_ARGUMENT if
+     ttl_seconds is not positive while capacity is not zero.  */
+tsi_result tsi_ssl_set_peer_verification_cache_options(size_t capacity,
+                                                       int64_t ttl_seconds);
+
+/* Drops all the chains of the peer verification cache, e.g. because the
+   trust placed in a root certificate changed. */
+void tsi_ssl_peer_verification_cache_flush(void);
+
 /* Util that checks that an ssl peer matches a specific name.
    Still TODO(jboeuf):
    - handle mixed case.
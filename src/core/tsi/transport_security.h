@@ -102,6 +102,9 @@ struct tsi_handshaker_result_vtable {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  /* Optional: NULL when record protection cannot be moved into the kernel. */
+  tsi_result (*offload_record_protection)(const tsi_handshaker_result* self,
+                                          int fd);
 };
 struct tsi_handshaker_result {
   const tsi_handshaker_result_vtable* vtable;
@@ -31,6 +31,21 @@ tsi_result tsi_handshaker_result_create_zero_copy_grpc_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_zero_copy_grpc_protector** protector);
 
+/* This method hands record protection for the rest of the connection to the
+   kernel TLS implementation of the connected TCP socket fd, so that plaintext
+   can be written to and read from fd directly without any protector.
+   - It returns TSI_OK when both directions have been installed on fd.
+   - It returns TSI_UNIMPLEMENTED when the negotiated protocol or cipher, the
+     TLS library or the kernel does not support it. fd then still carries
+     plain TCP: the kernel "tls" upper layer protocol may be left attached to
+     it, as it cannot be removed, but passes data through unchanged until a
+     direction is installed. The caller should create a protector as usual.
+   - Any other result means that fd is in an unknown state and the connection
+     must be closed.
+   The handshaker result still needs to be destroyed by the caller.  */
+tsi_result tsi_handshaker_result_offload_record_protection(
+    const tsi_handshaker_result* self, int fd);
+
 /* -- tsi_zero_copy_grpc_protector object --  */
 
 /* Outputs protected frames.
@@ -17,6 +17,7 @@
 
 #include <grpcpp/completion_queue.h>
 
+#include <algorithm>
 #include <memory>
 
 #include <grpc/grpc.h>
@@ -28,6 +29,9 @@ namespace grpc {
 
 static internal::GrpcLibraryInitializer g_gli_initializer;
 
+// Maximum number of core events retrieved by one NextBatch call.
+static const size_t kMaxNextBatchSize = 64;
+
 // 'CompletionQueue' constructor can safely call GrpcLibraryCodegen(false) here
 // i.e not have GrpcLibraryCodegen call grpc_init(). This is because, to create
 // a 'grpc_completion_queue' instance (which is being passed as the input to
@@ -70,6 +74,35 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+size_t CompletionQueue::NextBatch(void** tags, bool* oks, size_t max_events) {
+  GPR_ASSERT(max_events > 0);
+  grpc_event events[kMaxNextBatchSize];
+  for (;;) {
+    size_t num_events = grpc_completion_queue_next_batch(
+        cq_, events, std::min(max_events, kMaxNextBatchSize),
+        gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    if (events[0].type == GRPC_QUEUE_SHUTDOWN) {
+      return 0;
+    }
+    size_t num_tags = 0;
+    for (size_t i = 0; i < num_events; i++) {
+      if (events[i].type != GRPC_OP_COMPLETE) continue;
+      auto core_cq_tag =
+          static_cast<::grpc::internal::CompletionQueueTag*>(events[i].tag);
+      void* tag = core_cq_tag;
+      bool ok = events[i].success != 0;
+      if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+        tags[num_tags] = tag;
+        oks[num_tags] = ok;
+        num_tags++;
+      }
+    }
+    if (num_tags > 0) {
+      return num_tags;
+    }
+  }
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
@@ -35,6 +35,7 @@
 #include "test/core/util/test_config.h"
 
 using grpc_core::Arena;
+using grpc_core::ArenaPool;
 
 static void test_noop(void) { Arena::Create(1)->Destroy(); }
 
@@ -115,6 +116,54 @@ static void concurrent_test(void) {
   args.arena->Destroy();
 }
 
+static void test_pool(void) {
+  gpr_log(GPR_DEBUG, "test_pool");
+
+  ArenaPool pool;
+  // Cycle through growing and shrinking sizes so that cached buffers are both
+  // reused and discarded, and overflow the first zone now and then.
+  static const size_t sizes[] = {64, 64, 1024, 64, 4096, 4096, 128, 1};
+  for (size_t iter = 0; iter < 100; iter++) {
+    for (size_t size : sizes) {
+      std::pair<Arena*, void*> a = pool.CreateWithAlloc(size, 32);
+      GPR_ASSERT(((intptr_t)a.second & 0xf) == 0);
+      memset(a.second, 1, 32);
+      size_t nallocs = iter % 3;
+      for (size_t i = 0; i < nallocs; i++) {
+        memset(a.first->Alloc(size), 2, size);
+      }
+      GPR_ASSERT(pool.Release(a.first) ==
+                 GPR_ROUND_UP_TO_ALIGNMENT_SIZE(size) * nallocs + 32);
+    }
+  }
+}
+
+static void concurrent_pool_test_body(void* arg) {
+  ArenaPool* pool = static_cast<ArenaPool*>(arg);
+  for (size_t i = 0; i < concurrent_test_iterations() / 10; i++) {
+    Arena* a = pool->CreateWithAlloc(256, 0).first;
+    *static_cast<char*>(a->Alloc(i % 512 + 1)) = static_cast<char>(i);
+    pool->Release(a);
+  }
+}
+
+static void concurrent_pool_test(void) {
+  gpr_log(GPR_DEBUG, "concurrent_pool_test");
+
+  ArenaPool pool;
+  grpc_core::Thread thds[CONCURRENT_TEST_THREADS];
+
+  for (int i = 0; i < CONCURRENT_TEST_THREADS; i++) {
+    thds[i] = grpc_core::Thread("grpc_concurrent_pool_test",
+                                concurrent_pool_test_body, &pool);
+    thds[i].Start();
+  }
+
+  for (auto& th : thds) {
+    th.Join();
+  }
+}
+
 int main(int argc, char* argv[]) {
   grpc::testing::TestEnvironment env(argc, argv);
 
@@ -126,6 +175,8 @@ int main(int argc, char* argv[]) {
   TEST(1_inc, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11);
   TEST(6_123, 6, 1, 2, 3);
   concurrent_test();
+  test_pool();
+  concurrent_pool_test();
 
   return 0;
 }
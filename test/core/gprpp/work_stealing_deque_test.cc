@@ -0,0 +1,134 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/gprpp/work_stealing_deque.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "src/core/lib/gprpp/thd.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+TEST(WorkStealingDequeTest, EmptyDeque) {
+  WorkStealingDeque<int> deque;
+  EXPECT_EQ(deque.Size(), 0u);
+  EXPECT_EQ(deque.Pop(), nullptr);
+  EXPECT_EQ(deque.Steal(), nullptr);
+}
+
+TEST(WorkStealingDequeTest, PopIsLifoStealIsFifo) {
+  int items[4];
+  WorkStealingDeque<int> deque;
+  for (int& item : items) {
+    EXPECT_TRUE(deque.Push(&item));
+  }
+  EXPECT_EQ(deque.Size(), 4u);
+  EXPECT_EQ(deque.Pop(), &items[3]);
+  EXPECT_EQ(deque.Steal(), &items[0]);
+  EXPECT_EQ(deque.Pop(), &items[2]);
+  EXPECT_EQ(deque.Steal(), &items[1]);
+  EXPECT_EQ(deque.Pop(), nullptr);
+  EXPECT_EQ(deque.Steal(), nullptr);
+}
+
+TEST(WorkStealingDequeTest, PushFailsWhenFull) {
+  constexpr size_t kCapacity = 8;
+  int items[kCapacity + 1];
+  WorkStealingDeque<int, kCapacity> deque;
+  for (size_t i = 0; i < kCapacity; i++) {
+    EXPECT_TRUE(deque.Push(&items[i]));
+  }
+  EXPECT_FALSE(deque.Push(&items[kCapacity]));
+  EXPECT_EQ(deque.Steal(), &items[0]);
+  EXPECT_TRUE(deque.Push(&items[kCapacity]));
+  EXPECT_EQ(deque.Pop(), &items[kCapacity]);
+}
+
+// The owner pushes and pops while several thieves steal concurrently; every
+// item must be taken exactly once.
+TEST(WorkStealingDequeTest, ConcurrentSteal) {
+  constexpr int kItems = 100000;
+  constexpr int kThieves = 4;
+  std::vector<Atomic<int>> taken(kItems);
+  std::vector<int> items(kItems);
+  WorkStealingDeque<int, 256> deque;
+  Atomic<int> remaining(kItems);
+
+  struct ThiefArgs {
+    WorkStealingDeque<int, 256>* deque;
+    std::vector<int>* items;
+    std::vector<Atomic<int>>* taken;
+    Atomic<int>* remaining;
+  } args = {&deque, &items, &taken, &remaining};
+
+  std::vector<Thread> thieves;
+  thieves.reserve(kThieves);
+  for (int i = 0; i < kThieves; i++) {
+    thieves.emplace_back(
+        "thief",
+        [](void* arg) {
+          ThiefArgs* a = static_cast<ThiefArgs*>(arg);
+          while (a->remaining->Load(MemoryOrder::ACQUIRE) > 0) {
+            int* item = a->deque->Steal();
+            if (item != nullptr) {
+              (*a->taken)[item - a->items->data()].FetchAdd(1);
+              a->remaining->FetchSub(1);
+            }
+          }
+        },
+        &args);
+    thieves.back().Start();
+  }
+
+  int next = 0;
+  while (remaining.Load(MemoryOrder::ACQUIRE) > 0) {
+    // Push a few items, then pop one, so that the owner and the thieves keep
+    // racing for the last elements.
+    for (int i = 0; i < 3 && next < kItems; i++) {
+      if (!deque.Push(&items[next])) break;
+      next++;
+    }
+    int* item = deque.Pop();
+    if (item != nullptr) {
+      taken[item - items.data()].FetchAdd(1);
+      remaining.FetchSub(1);
+    }
+  }
+  for (auto& thief : thieves) {
+    thief.Join();
+  }
+  for (int i = 0; i < kItems; i++) {
+    EXPECT_EQ(taken[i].Load(MemoryOrder::RELAXED), 1) << "item " << i;
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -30,6 +30,7 @@
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/load_file.h"
 #include "test/core/util/port.h"
 #include "test/core/util/test_config.h"
@@ -49,6 +50,11 @@ int main(int argc, char* argv[]) {
   // also when h2 precedes gprc-exp.
   const char* extra_alpn_list[] = {"foo", "h2", "bar", "grpc-exp"};
   GPR_ASSERT(server_ssl_test(extra_alpn_list, 4, "h2"));
+  // Handshake succeeds when its steps run on the handshake thread pool.
+  grpc_arg thread_pool_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_SECURITY_HANDSHAKE_THREAD_POOL), 1);
+  grpc_channel_args thread_pool_args = {1, &thread_pool_arg};
+  GPR_ASSERT(server_ssl_test(full_alpn_list, 2, "grpc-exp", &thread_pool_args));
   // Handshake fails when the client uses a fake protocol as its only ALPN
   // preference. This validates the server is correctly validating ALPN
   // and sanity checks the server_ssl_test.
@@ -74,9 +74,10 @@ int create_socket(int port) {
 
 class ServerInfo {
  public:
-  explicit ServerInfo(int p) : port_(p) {}
+  ServerInfo(int p, const grpc_channel_args* args) : port_(p), args_(args) {}
 
   int port() const { return port_; }
+  const grpc_channel_args* args() const { return args_; }
 
   void Activate() {
     grpc_core::MutexLock lock(&mu_);
@@ -91,6 +92,7 @@ class ServerInfo {
 
  private:
   const int port_;
+  const grpc_channel_args* args_;
   grpc_core::Mutex mu_;
   grpc_core::CondVar cv_;
   bool ready_ = false;
@@ -121,7 +123,7 @@ void server_thread(void* arg) {
 
   // Start server listening on local port.
   std::string addr = absl::StrCat("127.0.0.1:", port);
-  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  grpc_server* server = grpc_server_create(s->args(), nullptr);
   GPR_ASSERT(
       grpc_server_add_secure_http2_port(server, addr.c_str(), ssl_creds));
 
@@ -166,11 +168,12 @@ void server_thread(void* arg) {
 // alpn_list) ALPN settings and can probe at the supported ALPN preferences
 // using this (via alpn_expected).
 bool server_ssl_test(const char* alpn_list[], unsigned int alpn_list_len,
-                     const char* alpn_expected) {
+                     const char* alpn_expected,
+                     const grpc_channel_args* server_args) {
   bool success = true;
 
   grpc_init();
-  ServerInfo s(grpc_pick_unused_port_or_die());
+  ServerInfo s(grpc_pick_unused_port_or_die(), server_args);
   gpr_event_init(&client_handshake_complete);
 
   // Launch the gRPC server thread.
@@ -31,6 +31,7 @@
 #include "test/core/util/test_config.h"
 
 bool server_ssl_test(const char* alpn_list[], unsigned int alpn_list_len,
-                     const char* alpn_expected);
+                     const char* alpn_expected,
+                     const grpc_channel_args* server_args = nullptr);
 
 #endif  // GRPC_SERVER_SSL_COMMON_H
@@ -214,6 +214,106 @@ static void test_overflow() {
   ;
 }
 
+static void test_inline() {
+  grpc_disable_error_creation();
+  grpc_error* error =
+      GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_DEADLINE_EXCEEDED);
+  GPR_ASSERT(grpc_error_is_inline(error));
+  GPR_ASSERT(grpc_error_is_special(error));
+  GPR_ASSERT(!grpc_error_is_inline(GRPC_ERROR_NONE));
+  GPR_ASSERT(!grpc_error_is_inline(GRPC_ERROR_OOM));
+  GPR_ASSERT(!grpc_error_is_inline(GRPC_ERROR_CANCELLED));
+  // The low bit stays available to users, as for special errors
+  GPR_ASSERT((reinterpret_cast<uintptr_t>(error) & 1) == 0);
+
+  intptr_t i;
+  GPR_ASSERT(!grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(!grpc_error_get_int(error, GRPC_ERROR_INT_HTTP2_ERROR, &i));
+  GPR_ASSERT(!grpc_error_get_int(error, GRPC_ERROR_INT_FILE_LINE, &i));
+
+  // Status and http2 error codes stay inline
+  error = grpc_error_set_int(error, GRPC_ERROR_INT_GRPC_STATUS,
+                             GRPC_STATUS_DEADLINE_EXCEEDED);
+  error = grpc_error_set_int(error, GRPC_ERROR_INT_HTTP2_ERROR, 8);
+  GPR_ASSERT(grpc_error_is_inline(error));
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(i == GRPC_STATUS_DEADLINE_EXCEEDED);
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_HTTP2_ERROR, &i));
+  GPR_ASSERT(i == 8);
+  error = grpc_error_set_int(error, GRPC_ERROR_INT_GRPC_STATUS,
+                             GRPC_STATUS_UNAUTHENTICATED);
+  GPR_ASSERT(grpc_error_is_inline(error));
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(i == GRPC_STATUS_UNAUTHENTICATED);
+
+  grpc_slice str;
+  GPR_ASSERT(grpc_error_get_str(error, GRPC_ERROR_STR_DESCRIPTION, &str));
+  GPR_ASSERT(!strncmp((char*)GRPC_SLICE_START_PTR(str), "Deadline Exceeded",
+                      GRPC_SLICE_LENGTH(str)));
+  GPR_ASSERT(!grpc_error_get_str(error, GRPC_ERROR_STR_GRPC_MESSAGE, &str));
+
+  GPR_ASSERT(GRPC_ERROR_REF(error) == error);
+  GRPC_ERROR_UNREF(error);
+  const char* s = grpc_error_string(error);
+  GPR_ASSERT(0 == strcmp(s,
+                         "{\"description\":\"Deadline Exceeded\","
+                         "\"grpc_status\":16,\"http2_error\":8}"));
+  GPR_ASSERT(s == grpc_error_string(error));
+  grpc_enable_error_creation();
+
+  // Anything else moves the error to the heap and keeps what it carried
+  error = grpc_error_set_int(error, GRPC_ERROR_INT_STREAM_ID, 3);
+  GPR_ASSERT(!grpc_error_is_special(error));
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_STREAM_ID, &i));
+  GPR_ASSERT(i == 3);
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(i == GRPC_STATUS_UNAUTHENTICATED);
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_HTTP2_ERROR, &i));
+  GPR_ASSERT(i == 8);
+  GPR_ASSERT(grpc_error_get_str(error, GRPC_ERROR_STR_DESCRIPTION, &str));
+  GPR_ASSERT(!strncmp((char*)GRPC_SLICE_START_PTR(str), "Deadline Exceeded",
+                      GRPC_SLICE_LENGTH(str)));
+  GRPC_ERROR_UNREF(error);
+
+  error = grpc_error_set_int(
+      GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_BUFFERS_FULL),
+      GRPC_ERROR_INT_GRPC_STATUS, 100);
+  GPR_ASSERT(!grpc_error_is_special(error));
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(i == 100);
+  error = grpc_error_add_child(
+      error, GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_TRUNCATED_MESSAGE));
+  GRPC_ERROR_UNREF(error);
+}
+
+static void test_inline_grpc_message() {
+  grpc_disable_error_creation();
+  grpc_error* error = GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_RST_STREAM);
+  grpc_slice str;
+  // No message until the http2 error code is known
+  GPR_ASSERT(!grpc_error_get_str(error, GRPC_ERROR_STR_GRPC_MESSAGE, &str));
+  error = grpc_error_set_int(error, GRPC_ERROR_INT_HTTP2_ERROR, 8);
+  GPR_ASSERT(grpc_error_is_inline(error));
+  GPR_ASSERT(grpc_error_get_str(error, GRPC_ERROR_STR_GRPC_MESSAGE, &str));
+  GPR_ASSERT(grpc_slice_str_cmp(str, "Received RST_STREAM with error code 8") ==
+             0);
+  GPR_ASSERT(grpc_error_get_str(error, GRPC_ERROR_STR_DESCRIPTION, &str));
+  GPR_ASSERT(grpc_slice_str_cmp(str, "RST_STREAM") == 0);
+  GPR_ASSERT(0 == strcmp(grpc_error_string(error),
+                         "{\"description\":\"RST_STREAM\",\"grpc_message\":"
+                         "\"Received RST_STREAM with error code 8\","
+                         "\"http2_error\":8}"));
+  grpc_enable_error_creation();
+
+  // The message survives the move to the heap
+  error = grpc_error_set_int(error, GRPC_ERROR_INT_STREAM_ID, 5);
+  GPR_ASSERT(!grpc_error_is_special(error));
+  GPR_ASSERT(grpc_error_get_str(error, GRPC_ERROR_STR_GRPC_MESSAGE, &str));
+  GPR_ASSERT(grpc_slice_str_cmp(str, "Received RST_STREAM with error code 8") ==
+             0);
+  GRPC_ERROR_UNREF(error);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -226,6 +326,8 @@ int main(int argc, char** argv) {
   test_create_referencing();
   test_create_referencing_many();
   test_overflow();
+  test_inline();
+  test_inline_grpc_message();
   grpc_shutdown();
 
   return 0;
@@ -0,0 +1,217 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "src/core/lib/iomgr/port.h"
+
+/* This test only relevant on linux systems where epoll() is available */
+#if defined(GRPC_LINUX_EPOLL) && defined(GRPC_LINUX_EVENTFD)
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "src/core/lib/gprpp/global_config.h"
+#include "src/core/lib/iomgr/ev_posix.h"
+#include "src/core/lib/iomgr/pollset.h"
+#include "test/core/util/test_config.h"
+
+GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_epoll1_num_sets);
+
+#define NUM_SETS 4
+#define FDS_PER_SET 4
+
+static gpr_mu* g_mu;
+static grpc_pollset* g_pollset;
+static int g_num_readable;
+
+static void pollset_destroy(void* ps, grpc_error* /*error*/) {
+  grpc_pollset_destroy(static_cast<grpc_pollset*>(ps));
+  gpr_free(ps);
+}
+
+static void init_pollset() {
+  g_pollset = static_cast<grpc_pollset*>(gpr_zalloc(grpc_pollset_size()));
+  grpc_pollset_init(g_pollset, &g_mu);
+  g_num_readable = 0;
+}
+
+static void shutdown_pollset() {
+  grpc_closure destroyed;
+  GRPC_CLOSURE_INIT(&destroyed, pollset_destroy, g_pollset,
+                    grpc_schedule_on_exec_ctx);
+  grpc_pollset_shutdown(g_pollset, &destroyed);
+  grpc_core::ExecCtx::Get()->Flush();
+}
+
+/* Polls until g_num_readable reaches num_readable or deadline expires */
+static void poll_until(int num_readable, grpc_millis deadline) {
+  gpr_mu_lock(g_mu);
+  while (g_num_readable < num_readable &&
+         grpc_core::ExecCtx::Get()->Now() < deadline) {
+    grpc_pollset_worker* worker = nullptr;
+    GPR_ASSERT(GRPC_LOG_IF_ERROR(
+        "pollset_work", grpc_pollset_work(g_pollset, &worker, deadline)));
+    gpr_mu_unlock(g_mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    gpr_mu_lock(g_mu);
+  }
+  gpr_mu_unlock(g_mu);
+}
+
+static void on_readable(void* /*arg*/, grpc_error* error) {
+  GPR_ASSERT(error == GRPC_ERROR_NONE);
+  gpr_mu_lock(g_mu);
+  g_num_readable++;
+  GPR_ASSERT(
+      GRPC_LOG_IF_ERROR("pollset_kick", grpc_pollset_kick(g_pollset, nullptr)));
+  gpr_mu_unlock(g_mu);
+}
+
+/* Keeps the test thread, and so the only poller, on a single core: the epoll
+ * sets of all the other core groups then have no polling thread at all. */
+static bool pin_to_one_cpu() {
+  cpu_set_t cpus;
+  if (sched_getaffinity(0, sizeof(cpus), &cpus) != 0) return false;
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &cpus)) {
+      CPU_ZERO(&cpus);
+      CPU_SET(cpu, &cpus);
+      return sched_setaffinity(0, sizeof(cpus), &cpus) == 0;
+    }
+  }
+  return false;
+}
+
+/* eventfds report no receiving CPU, so they are spread round robin over all the
+ * epoll sets. A single poller has to see every one of them become readable,
+ * including the ones registered with sets nobody is polling. */
+static void test_unattended_epoll_sets() {
+  gpr_log(GPR_INFO, "test_unattended_epoll_sets");
+  grpc_core::ExecCtx exec_ctx;
+  init_pollset();
+
+  const int num_fds = NUM_SETS * FDS_PER_SET;
+  grpc_fd* fds[num_fds];
+  grpc_closure on_readable_closures[num_fds];
+  for (int i = 0; i < num_fds; i++) {
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    GPR_ASSERT(fd >= 0);
+    fds[i] = grpc_fd_create(fd, "epoll1-test-fd", false);
+    grpc_pollset_add_fd(g_pollset, fds[i]);
+    GRPC_CLOSURE_INIT(&on_readable_closures[i], on_readable, nullptr,
+                      grpc_schedule_on_exec_ctx);
+    grpc_fd_notify_on_read(fds[i], &on_readable_closures[i]);
+  }
+  grpc_core::ExecCtx::Get()->Flush();
+
+  for (int i = 0; i < num_fds; i++) {
+    GPR_ASSERT(eventfd_write(grpc_fd_wrapped_fd(fds[i]), 1) == 0);
+  }
+
+  poll_until(num_fds, grpc_timespec_to_millis_round_up(
+                         grpc_timeout_seconds_to_deadline(10)));
+  GPR_ASSERT(g_num_readable == num_fds);
+
+  for (int i = 0; i < num_fds; i++) {
+    grpc_fd_orphan(fds[i], nullptr, nullptr, "epoll1-test-fd");
+  }
+  grpc_core::ExecCtx::Get()->Flush();
+  shutdown_pollset();
+}
+
+/* grpc_fds are recycled. Readiness reported for an fd after the poller last
+ * looked, but before it was orphaned, must not reach the next user of the same
+ * grpc_fd (with io_uring, the completion of the old poll request is still
+ * queued at that point). */
+static void test_recycled_fd() {
+  gpr_log(GPR_INFO, "test_recycled_fd");
+  grpc_core::ExecCtx exec_ctx;
+  init_pollset();
+  grpc_closure on_readable_closure;
+  GRPC_CLOSURE_INIT(&on_readable_closure, on_readable, nullptr,
+                    grpc_schedule_on_exec_ctx);
+
+  int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  GPR_ASSERT(fd >= 0);
+  grpc_fd* old_fd = grpc_fd_create(fd, "epoll1-test-old-fd", false);
+  grpc_pollset_add_fd(g_pollset, old_fd);
+  GPR_ASSERT(eventfd_write(fd, 1) == 0);
+  grpc_fd_orphan(old_fd, nullptr, nullptr, "epoll1-test-old-fd");
+  grpc_core::ExecCtx::Get()->Flush();
+
+  fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  GPR_ASSERT(fd >= 0);
+  grpc_fd* new_fd = grpc_fd_create(fd, "epoll1-test-new-fd", false);
+  grpc_pollset_add_fd(g_pollset, new_fd);
+  grpc_fd_notify_on_read(new_fd, &on_readable_closure);
+  grpc_core::ExecCtx::Get()->Flush();
+  poll_until(1, grpc_timespec_to_millis_round_up(
+                    grpc_timeout_milliseconds_to_deadline(500)));
+  GPR_ASSERT(g_num_readable == 0);
+
+  GPR_ASSERT(eventfd_write(fd, 1) == 0);
+  poll_until(1, grpc_timespec_to_millis_round_up(
+                    grpc_timeout_seconds_to_deadline(10)));
+  GPR_ASSERT(g_num_readable == 1);
+
+  grpc_fd_orphan(new_fd, nullptr, nullptr, "epoll1-test-new-fd");
+  grpc_core::ExecCtx::Get()->Flush();
+  shutdown_pollset();
+}
+
+int main(int argc, char** argv) {
+  const char* poll_strategy = nullptr;
+  grpc::testing::TestEnvironment env(argc, argv);
+  if (!pin_to_one_cpu()) {
+    gpr_log(GPR_INFO, "Skipping the test. Failed to pin it to a single cpu.");
+    return 0;
+  }
+  GPR_GLOBAL_CONFIG_SET(grpc_epoll1_num_sets, NUM_SETS);
+  grpc_init();
+  {
+    grpc_core::ExecCtx exec_ctx;
+    poll_strategy = grpc_get_poll_strategy_name();
+    if (poll_strategy == nullptr || (strcmp(poll_strategy, "epoll1") != 0 &&
+                                     strcmp(poll_strategy, "io_uring") != 0)) {
+      gpr_log(GPR_INFO,
+              "Skipping the test. The test is only relevant for 'epoll1' "
+              "and 'io_uring' strategies. and the current strategy is: '%s'",
+              poll_strategy);
+    } else {
+      test_recycled_fd();
+      if (strcmp(poll_strategy, "io_uring") == 0) {
+        gpr_log(GPR_INFO,
+                "Skipping test_unattended_epoll_sets. io_uring uses a single "
+                "set.");
+      } else if (gpr_cpu_num_cores() < 2) {
+        gpr_log(GPR_INFO,
+                "Skipping test_unattended_epoll_sets. epoll1 uses a single "
+                "epoll set on a single core machine.");
+      } else {
+        test_unattended_epoll_sets();
+      }
+    }
+  }
+  grpc_shutdown();
+  return 0;
+}
+#else /* defined(GRPC_LINUX_EPOLL) && defined(GRPC_LINUX_EVENTFD) */
+int main(int /*argc*/, char** /*argv*/) { return 0; }
+#endif
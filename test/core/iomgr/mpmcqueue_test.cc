@@ -38,7 +38,7 @@ struct WorkItem {
 // produced items on destructing.
 class ProducerThread {
  public:
-  ProducerThread(grpc_core::InfLenFIFOQueue* queue, int start_index,
+  ProducerThread(grpc_core::MPMCQueueInterface* queue, int start_index,
                  int num_items)
       : start_index_(start_index), num_items_(num_items), queue_(queue) {
     items_ = nullptr;
@@ -69,7 +69,7 @@ class ProducerThread {
 
   int start_index_;
   int num_items_;
-  grpc_core::InfLenFIFOQueue* queue_;
+  grpc_core::MPMCQueueInterface* queue_;
   grpc_core::Thread thd_;
   WorkItem** items_;
 };
@@ -77,7 +77,7 @@ class ProducerThread {
 // Thread to pull out items from queue
 class ConsumerThread {
  public:
-  ConsumerThread(grpc_core::InfLenFIFOQueue* queue) : queue_(queue) {
+  ConsumerThread(grpc_core::MPMCQueueInterface* queue) : queue_(queue) {
     thd_ = grpc_core::Thread(
         "mpmcq_test_consumer_thd",
         [](void* th) { static_cast<ConsumerThread*>(th)->Run(); }, this);
@@ -101,7 +101,7 @@ class ConsumerThread {
 
     gpr_log(GPR_DEBUG, "ConsumerThread: %d times of Get() called.", count);
   }
-  grpc_core::InfLenFIFOQueue* queue_;
+  grpc_core::MPMCQueueInterface* queue_;
   grpc_core::Thread thd_;
 };
 
@@ -170,11 +170,9 @@ static void test_space_efficiency(void) {
   gpr_log(GPR_DEBUG, "Done.");
 }
 
-static void test_many_thread(void) {
-  gpr_log(GPR_INFO, "test_many_thread");
+static void test_many_thread(grpc_core::MPMCQueueInterface* queue) {
   const int num_producer_threads = 10;
   const int num_consumer_threads = 20;
-  grpc_core::InfLenFIFOQueue queue;
   ProducerThread** producer_threads = static_cast<ProducerThread**>(
       gpr_zalloc(num_producer_threads * sizeof(ProducerThread*)));
   ConsumerThread** consumer_threads = static_cast<ConsumerThread**>(
@@ -183,13 +181,13 @@ static void test_many_thread(void) {
   gpr_log(GPR_DEBUG, "Fork ProducerThreads...");
   for (int i = 0; i < num_producer_threads; ++i) {
     producer_threads[i] =
-        new ProducerThread(&queue, i * TEST_NUM_ITEMS, TEST_NUM_ITEMS);
+        new ProducerThread(queue, i * TEST_NUM_ITEMS, TEST_NUM_ITEMS);
     producer_threads[i]->Start();
   }
   gpr_log(GPR_DEBUG, "ProducerThreads Started.");
   gpr_log(GPR_DEBUG, "Fork ConsumerThreads...");
   for (int i = 0; i < num_consumer_threads; ++i) {
-    consumer_threads[i] = new ConsumerThread(&queue);
+    consumer_threads[i] = new ConsumerThread(queue);
     consumer_threads[i]->Start();
   }
   gpr_log(GPR_DEBUG, "ConsumerThreads Started.");
@@ -200,7 +198,7 @@ static void test_many_thread(void) {
   gpr_log(GPR_DEBUG, "All ProducerThreads Terminated.");
   gpr_log(GPR_DEBUG, "Terminating ConsumerThreads...");
   for (int i = 0; i < num_consumer_threads; ++i) {
-    queue.Put(nullptr);
+    queue->Put(nullptr);
   }
   for (int i = 0; i < num_consumer_threads; ++i) {
     consumer_threads[i]->Join();
@@ -219,12 +217,56 @@ static void test_many_thread(void) {
   gpr_log(GPR_DEBUG, "Done.");
 }
 
+static void test_many_thread_inf_len(void) {
+  gpr_log(GPR_INFO, "test_many_thread_inf_len");
+  grpc_core::InfLenFIFOQueue queue;
+  test_many_thread(&queue);
+}
+
+static void test_lock_free_FIFO(void) {
+  gpr_log(GPR_INFO, "test_lock_free_FIFO");
+  grpc_core::LockFreeBoundedQueue queue(TEST_NUM_ITEMS);
+  // Capacity is rounded up to a power of two.
+  GPR_ASSERT(queue.capacity() == 16384);
+  // Goes around the ring a few times.
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < TEST_NUM_ITEMS; ++i) {
+      queue.Put(static_cast<void*>(new WorkItem(i)));
+    }
+    GPR_ASSERT(queue.count() == TEST_NUM_ITEMS);
+    for (int i = 0; i < TEST_NUM_ITEMS; ++i) {
+      WorkItem* item = static_cast<WorkItem*>(queue.Get());
+      GPR_ASSERT(i == item->index);
+      delete item;
+    }
+    GPR_ASSERT(queue.count() == 0);
+  }
+}
+
+// A tiny queue forces producers to block on a full queue and consumers on an
+// empty one.
+static void test_lock_free_small_capacity(void) {
+  gpr_log(GPR_INFO, "test_lock_free_small_capacity");
+  grpc_core::LockFreeBoundedQueue queue(4);
+  GPR_ASSERT(queue.capacity() == 4);
+  test_many_thread(&queue);
+}
+
+static void test_lock_free_many_thread(void) {
+  gpr_log(GPR_INFO, "test_lock_free_many_thread");
+  grpc_core::LockFreeBoundedQueue queue;
+  test_many_thread(&queue);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
   test_FIFO();
   test_space_efficiency();
-  test_many_thread();
+  test_many_thread_inf_len();
+  test_lock_free_FIFO();
+  test_lock_free_small_capacity();
+  test_lock_free_many_thread();
   grpc_shutdown();
   return 0;
 }
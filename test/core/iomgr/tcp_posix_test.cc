@@ -30,6 +30,17 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#ifdef GRPC_LINUX_KTLS
+#include <linux/tls.h>
+#include <netinet/tcp.h>
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif /* GRPC_LINUX_KTLS */
+
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
@@ -249,8 +260,9 @@ static void read_test(size_t num_bytes, size_t slice_size) {
 }
 
 /* Write to a socket until it fills up, then read from it using the grpc_tcp
-   API. */
-static void large_read_test(size_t slice_size) {
+   API. With rx_zerocopy, large reads map the received pages where the kernel
+   supports it (this needs a TCP socket). */
+static void large_read_test(size_t slice_size, bool rx_zerocopy) {
   int sv[2];
   grpc_endpoint* ep;
   struct read_socket_state state;
@@ -259,14 +271,26 @@ static void large_read_test(size_t slice_size) {
       grpc_timespec_to_millis_round_up(grpc_timeout_seconds_to_deadline(20));
   grpc_core::ExecCtx exec_ctx;
 
-  gpr_log(GPR_INFO, "Start large read test, slice size %" PRIuPTR, slice_size);
+  gpr_log(GPR_INFO,
+          "Start large read test, slice size %" PRIuPTR ", rx zerocopy %d",
+          slice_size, rx_zerocopy);
 
-  create_sockets(sv);
+  if (rx_zerocopy) {
+    create_inet_sockets(sv);
+  } else {
+    create_sockets(sv);
+  }
 
-  grpc_arg a[1];
+  grpc_arg a[3];
   a[0].key = const_cast<char*>(GRPC_ARG_TCP_READ_CHUNK_SIZE);
   a[0].type = GRPC_ARG_INTEGER;
   a[0].value.integer = static_cast<int>(slice_size);
+  a[1].key = const_cast<char*>(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED);
+  a[1].type = GRPC_ARG_INTEGER;
+  a[1].value.integer = rx_zerocopy;
+  a[2].key = const_cast<char*>(GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD);
+  a[2].type = GRPC_ARG_INTEGER;
+  a[2].value.integer = 4096;
   grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
   ep = grpc_tcp_create(grpc_fd_create(sv[1], "large_read_test", false), &args,
                        "test");
@@ -557,6 +581,136 @@ static void release_fd_test(size_t num_bytes, size_t slice_size) {
   close(fd);
 }
 
+#ifdef GRPC_LINUX_KTLS
+/* Installs one direction of a fixed TLS 1.2 AES-128-GCM state on fd. Returns
+   false if the kernel has no tls module. */
+static bool install_kernel_tls(int fd, int direction) {
+  tls12_crypto_info_aes_gcm_128 info;
+  memset(&info, 0, sizeof(info));
+  info.info.version = TLS_1_2_VERSION;
+  info.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+  memset(info.key, 0x2a, sizeof(info.key));
+  memset(info.salt, 0x17, sizeof(info.salt));
+  return setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) == 0 &&
+         setsockopt(fd, SOL_TLS, direction, &info, sizeof(info)) == 0;
+}
+
+/* Sends a close_notify alert record through the kernel TLS state of fd. */
+static void send_close_notify(int fd) {
+  unsigned char alert[2] = {1 /* warning */, 0 /* close_notify */};
+  struct iovec iov = {alert, sizeof(alert)};
+  union {
+    char buf[CMSG_SPACE(sizeof(unsigned char))];
+    struct cmsghdr align;
+  } u;
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = u.buf;
+  msg.msg_controllen = sizeof(u.buf);
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_TLS;
+  cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(unsigned char));
+  *CMSG_DATA(cmsg) = 21 /* alert */;
+  GPR_ASSERT(sendmsg(fd, &msg, 0) == sizeof(alert));
+}
+
+struct kernel_tls_read_state {
+  grpc_endpoint* ep;
+  size_t read_bytes;
+  grpc_error* error;
+  bool done;
+  grpc_slice_buffer incoming;
+  grpc_closure read_cb;
+};
+
+static void kernel_tls_read_cb(void* user_data, grpc_error* error) {
+  struct kernel_tls_read_state* state =
+      static_cast<struct kernel_tls_read_state*>(user_data);
+  gpr_mu_lock(g_mu);
+  if (error != GRPC_ERROR_NONE) {
+    state->error = GRPC_ERROR_REF(error);
+    state->done = true;
+    GPR_ASSERT(
+        GRPC_LOG_IF_ERROR("kick", grpc_pollset_kick(g_pollset, nullptr)));
+    gpr_mu_unlock(g_mu);
+    return;
+  }
+  int current_data = state->read_bytes % 256;
+  state->read_bytes += count_slices(state->incoming.slices,
+                                    state->incoming.count, &current_data);
+  gpr_mu_unlock(g_mu);
+  grpc_endpoint_read(state->ep, &state->incoming, &state->read_cb,
+                     /*urgent=*/false);
+}
+
+/* Receive data and then a close_notify alert through kernel TLS. The data
+   must be delivered, and the alert must end the stream as an orderly close
+   rather than fail the read. Skipped where the kernel has no tls module. */
+static void kernel_tls_close_notify_test(size_t num_bytes) {
+  int sv[2];
+  grpc_millis deadline =
+      grpc_timespec_to_millis_round_up(grpc_timeout_seconds_to_deadline(20));
+  grpc_core::ExecCtx exec_ctx;
+
+  gpr_log(GPR_INFO, "Kernel TLS close_notify test of size %" PRIuPTR,
+          num_bytes);
+
+  create_inet_sockets(sv);
+  if (!install_kernel_tls(sv[0], TLS_TX) ||
+      !install_kernel_tls(sv[1], TLS_RX)) {
+    gpr_log(GPR_INFO, "Kernel TLS is not available, skipping");
+    close(sv[0]);
+    close(sv[1]);
+    return;
+  }
+
+  grpc_endpoint* ep = grpc_tcp_create(
+      grpc_fd_create(sv[1], "kernel_tls_close_notify_test", false), nullptr,
+      "test");
+  grpc_tcp_set_kernel_tls(ep);
+  grpc_endpoint_add_to_pollset(ep, g_pollset);
+
+  size_t written_bytes = fill_socket_partial(sv[0], num_bytes);
+  GPR_ASSERT(written_bytes == num_bytes);
+  send_close_notify(sv[0]);
+
+  struct kernel_tls_read_state state;
+  state.ep = ep;
+  state.read_bytes = 0;
+  state.error = GRPC_ERROR_NONE;
+  state.done = false;
+  grpc_slice_buffer_init(&state.incoming);
+  GRPC_CLOSURE_INIT(&state.read_cb, kernel_tls_read_cb, &state,
+                    grpc_schedule_on_exec_ctx);
+
+  grpc_endpoint_read(ep, &state.incoming, &state.read_cb, /*urgent=*/false);
+
+  gpr_mu_lock(g_mu);
+  while (!state.done) {
+    grpc_pollset_worker* worker = nullptr;
+    GPR_ASSERT(GRPC_LOG_IF_ERROR(
+        "pollset_work", grpc_pollset_work(g_pollset, &worker, deadline)));
+    gpr_mu_unlock(g_mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    gpr_mu_lock(g_mu);
+  }
+  GPR_ASSERT(state.read_bytes == written_bytes);
+  gpr_mu_unlock(g_mu);
+  intptr_t status;
+  GPR_ASSERT(grpc_error_get_int(state.error, GRPC_ERROR_INT_GRPC_STATUS,
+                                &status));
+  GPR_ASSERT(status == GRPC_STATUS_UNAVAILABLE);
+  GRPC_ERROR_UNREF(state.error);
+
+  grpc_slice_buffer_destroy_internal(&state.incoming);
+  grpc_endpoint_destroy(ep);
+  close(sv[0]);
+}
+#endif /* GRPC_LINUX_KTLS */
+
 void run_tests(void) {
   size_t i = 0;
 
@@ -564,8 +718,10 @@ void run_tests(void) {
   read_test(10000, 8192);
   read_test(10000, 137);
   read_test(10000, 1);
-  large_read_test(8192);
-  large_read_test(1);
+  large_read_test(8192, false);
+  large_read_test(1, false);
+  large_read_test(8192, true);
+  large_read_test(1, true);
 
   write_test(100, 8192, false);
   write_test(100, 1, false);
@@ -585,6 +741,11 @@ void run_tests(void) {
   }
 
   release_fd_test(100, 8192);
+
+#ifdef GRPC_LINUX_KTLS
+  kernel_tls_close_notify_test(0);
+  kernel_tls_close_notify_test(10000);
+#endif
 }
 
 static void clean_up(void) {}
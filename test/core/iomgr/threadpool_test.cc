@@ -108,11 +108,12 @@ class WorkThread {
   grpc_core::Thread thd_;
 };
 
-static void test_multi_add(void) {
+static void test_multi_add(grpc_core::ThreadPool::QueueType queue_type) {
   gpr_log(GPR_INFO, "test_multi_add");
   const int num_work_thds = 10;
   grpc_core::ThreadPool* pool =
-      new grpc_core::ThreadPool(kLargeThreadPoolSize, "test_multi_add");
+      new grpc_core::ThreadPool(kLargeThreadPoolSize, "test_multi_add",
+                                grpc_core::Thread::Options(), queue_type);
   SimpleFunctorForAdd* functor = new SimpleFunctorForAdd();
   WorkThread** work_thds = static_cast<WorkThread**>(
       gpr_zalloc(sizeof(WorkThread*) * num_work_thds));
@@ -158,11 +159,11 @@ class SimpleFunctorCheckForAdd
   int* count_;
 };
 
-static void test_one_thread_FIFO(void) {
+static void test_one_thread_FIFO(grpc_core::ThreadPool::QueueType queue_type) {
   gpr_log(GPR_INFO, "test_one_thread_FIFO");
   int counter = 0;
-  grpc_core::ThreadPool* pool =
-      new grpc_core::ThreadPool(1, "test_one_thread_FIFO");
+  grpc_core::ThreadPool* pool = new grpc_core::ThreadPool(
+      1, "test_one_thread_FIFO", grpc_core::Thread::Options(), queue_type);
   SimpleFunctorCheckForAdd** check_functors =
       static_cast<SimpleFunctorCheckForAdd**>(
           gpr_zalloc(sizeof(SimpleFunctorCheckForAdd*) * kThreadSmallIter));
@@ -185,8 +186,11 @@ int main(int argc, char** argv) {
   test_size_zero();
   test_constructor_option();
   test_add();
-  test_multi_add();
-  test_one_thread_FIFO();
+  for (auto queue_type : {grpc_core::ThreadPool::QueueType::kInfiniteLength,
+                          grpc_core::ThreadPool::QueueType::kLockFreeBounded}) {
+    test_multi_add(queue_type);
+    test_one_thread_FIFO(queue_type);
+  }
   grpc_shutdown();
   return 0;
 }
@@ -18,12 +18,14 @@
 
 #include "src/core/lib/slice/b64.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "test/core/util/test_config.h"
@@ -200,6 +202,64 @@ static void test_unpadded_decode(void) {
   GPR_ASSERT(GRPC_SLICE_IS_EMPTY(decoded));
 }
 
+/* Checks the bulk encoder and decoder at each instruction set level against
+   the scalar code, for every input length up to a few vector widths. */
+static void test_simd_matches_scalar(int url_safe, int multiline) {
+  unsigned char orig[300];
+  size_t i;
+  for (i = 0; i < sizeof(orig); i++) orig[i] = static_cast<uint8_t>(rand());
+
+  grpc_core::ExecCtx exec_ctx;
+  for (i = 0; i <= sizeof(orig); i++) {
+    grpc_base64_limit_simd_for_testing(0);
+    char* expected = grpc_base64_encode(orig, i, url_safe, multiline);
+    for (int level = 1; level <= 2; level++) {
+      grpc_base64_limit_simd_for_testing(level);
+      char* b64 = grpc_base64_encode(orig, i, url_safe, multiline);
+      GPR_ASSERT(strcmp(expected, b64) == 0);
+      grpc_slice decoded = grpc_base64_decode(b64, url_safe);
+      GPR_ASSERT(GRPC_SLICE_LENGTH(decoded) == i);
+      GPR_ASSERT(buffers_are_equal(orig, GRPC_SLICE_START_PTR(decoded), i));
+      grpc_slice_unref_internal(decoded);
+      gpr_free(b64);
+    }
+    gpr_free(expected);
+  }
+  grpc_base64_limit_simd_for_testing(2);
+}
+
+/* Swaps every possible character into a long encoded string and checks that
+   the bulk decoder accepts and rejects exactly what the scalar one does. */
+static void test_simd_rejects_like_scalar(int url_safe) {
+  unsigned char orig[96];
+  const size_t positions[] = {5, 40};
+  size_t i;
+  for (i = 0; i < sizeof(orig); i++) orig[i] = static_cast<uint8_t>(rand());
+
+  grpc_core::ExecCtx exec_ctx;
+  char* b64 = grpc_base64_encode(orig, sizeof(orig), url_safe, 0);
+  const size_t b64_len = strlen(b64);
+  for (i = 0; i < GPR_ARRAY_SIZE(positions); i++) {
+    const char saved = b64[positions[i]];
+    for (int c = 0; c < 256; c++) {
+      b64[positions[i]] = static_cast<char>(c);
+      grpc_base64_limit_simd_for_testing(0);
+      grpc_slice expected = grpc_base64_decode_with_len(b64, b64_len, url_safe);
+      for (int level = 1; level <= 2; level++) {
+        grpc_base64_limit_simd_for_testing(level);
+        grpc_slice decoded =
+            grpc_base64_decode_with_len(b64, b64_len, url_safe);
+        GPR_ASSERT(grpc_slice_eq(expected, decoded));
+        grpc_slice_unref_internal(decoded);
+      }
+      grpc_slice_unref_internal(expected);
+    }
+    b64[positions[i]] = saved;
+  }
+  gpr_free(b64);
+  grpc_base64_limit_simd_for_testing(2);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -214,6 +274,12 @@ int main(int argc, char** argv) {
   test_url_safe_unsafe_mismatch_failure();
   test_rfc4648_test_vectors();
   test_unpadded_decode();
+  test_simd_matches_scalar(0, 0);
+  test_simd_matches_scalar(0, 1);
+  test_simd_matches_scalar(1, 0);
+  test_simd_matches_scalar(1, 1);
+  test_simd_rejects_like_scalar(0);
+  test_simd_rejects_like_scalar(1);
   grpc_shutdown();
   return 0;
 }
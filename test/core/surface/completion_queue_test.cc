@@ -165,6 +165,73 @@ static void test_cq_end_op(void) {
   }
 }
 
+static void test_next_batch(void) {
+  grpc_event events[4];
+  grpc_completion_queue* cc;
+  grpc_cq_completion completions[6];
+  void* tags[GPR_ARRAY_SIZE(completions)];
+  grpc_cq_polling_type polling_types[] = {
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+  grpc_completion_queue_attributes attr;
+  size_t num_events;
+  size_t i, j;
+
+  LOG_TEST("test_next_batch");
+
+  for (i = 0; i < GPR_ARRAY_SIZE(tags); i++) {
+    tags[i] = create_test_tag();
+  }
+
+  attr.version = 1;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  for (i = 0; i < GPR_ARRAY_SIZE(polling_types); i++) {
+    grpc_core::ExecCtx exec_ctx;
+    attr.cq_polling_type = polling_types[i];
+    cc = grpc_completion_queue_create(
+        grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+
+    /* Nothing queued: times out with a single event */
+    num_events = grpc_completion_queue_next_batch(
+        cc, events, GPR_ARRAY_SIZE(events), gpr_inf_past(GPR_CLOCK_REALTIME),
+        nullptr);
+    GPR_ASSERT(num_events == 1);
+    GPR_ASSERT(events[0].type == GRPC_QUEUE_TIMEOUT);
+
+    for (j = 0; j < GPR_ARRAY_SIZE(tags); j++) {
+      GPR_ASSERT(grpc_cq_begin_op(cc, tags[j]));
+      grpc_cq_end_op(cc, tags[j], GRPC_ERROR_NONE, do_nothing_end_completion,
+                     nullptr, &completions[j]);
+    }
+
+    /* Queued completions come back in order, at most max_events at a time */
+    num_events = grpc_completion_queue_next_batch(
+        cc, events, GPR_ARRAY_SIZE(events), gpr_inf_past(GPR_CLOCK_REALTIME),
+        nullptr);
+    GPR_ASSERT(num_events == GPR_ARRAY_SIZE(events));
+    for (j = 0; j < num_events; j++) {
+      GPR_ASSERT(events[j].type == GRPC_OP_COMPLETE);
+      GPR_ASSERT(events[j].tag == tags[j]);
+      GPR_ASSERT(events[j].success);
+    }
+    num_events = grpc_completion_queue_next_batch(
+        cc, events, GPR_ARRAY_SIZE(events), gpr_inf_past(GPR_CLOCK_REALTIME),
+        nullptr);
+    GPR_ASSERT(num_events == GPR_ARRAY_SIZE(tags) - GPR_ARRAY_SIZE(events));
+    for (j = 0; j < num_events; j++) {
+      GPR_ASSERT(events[j].type == GRPC_OP_COMPLETE);
+      GPR_ASSERT(events[j].tag == tags[GPR_ARRAY_SIZE(events) + j]);
+    }
+
+    grpc_completion_queue_shutdown(cc);
+    num_events = grpc_completion_queue_next_batch(
+        cc, events, GPR_ARRAY_SIZE(events), gpr_inf_future(GPR_CLOCK_REALTIME),
+        nullptr);
+    GPR_ASSERT(num_events == 1);
+    GPR_ASSERT(events[0].type == GRPC_QUEUE_SHUTDOWN);
+    grpc_completion_queue_destroy(cc);
+  }
+}
+
 static void test_cq_tls_cache_full(void) {
   grpc_event ev;
   grpc_completion_queue* cc;
@@ -495,6 +562,7 @@ int main(int argc, char** argv) {
   test_shutdown_then_next_polling();
   test_shutdown_then_next_with_timeout();
   test_cq_end_op();
+  test_next_batch();
   test_pluck();
   test_pluck_after_shutdown();
   test_cq_tls_cache_full();
@@ -135,6 +135,68 @@ INSTANTIATE_TEST_SUITE_P(TooManyNames, BdpEstimatorRandomTest,
                          ::testing::Values(3, 4, 6, 9, 13, 19, 28, 42, 63, 94,
                                            141, 211, 316, 474, 711));
 
+namespace {
+gpr_timespec AtMillis(int64_t ms) {
+  return gpr_time_add(gpr_time_0(GPR_CLOCK_MONOTONIC),
+                      gpr_time_from_millis(ms, GPR_TIMESPAN));
+}
+
+// Delivers bytes_per_ms every millisecond over [start_ms, end_ms).
+void Deliver(DeliveryRateEstimator* est, int64_t start_ms, int64_t end_ms,
+             int64_t bytes_per_ms) {
+  for (int64_t ms = start_ms; ms < end_ms; ms++) {
+    est->AddIncomingBytes(bytes_per_ms, AtMillis(ms));
+  }
+}
+}  // namespace
+
+TEST(DeliveryRateEstimatorTest, NoSamplesWithoutRtt) {
+  DeliveryRateEstimator est("test");
+  for (int64_t ms = 0; ms < 100; ms++) {
+    EXPECT_FALSE(est.AddIncomingBytes(1000, AtMillis(ms)));
+  }
+  EXPECT_EQ(est.EstimateBandwidth(), 0);
+  EXPECT_EQ(est.EstimateBdp(), 0);
+}
+
+TEST(DeliveryRateEstimatorTest, EstimatesBandwidthDelayProduct) {
+  DeliveryRateEstimator est("test");
+  est.AddRttSample(gpr_time_from_millis(10, GPR_TIMESPAN), AtMillis(0));
+  Deliver(&est, 0, 200, 1000);
+  EXPECT_NEAR(est.EstimateBandwidth(), 1e6, 1e4);
+  EXPECT_NEAR(est.EstimateMinRtt(), 0.01, 1e-9);
+  EXPECT_NEAR(est.EstimateBdp(), 10000, 100);
+  EXPECT_TRUE(est.filled_pipe());
+}
+
+TEST(DeliveryRateEstimatorTest, KeepsMinimumRtt) {
+  DeliveryRateEstimator est("test");
+  est.AddRttSample(gpr_time_from_millis(10, GPR_TIMESPAN), AtMillis(0));
+  est.AddRttSample(gpr_time_from_millis(50, GPR_TIMESPAN), AtMillis(1000));
+  EXPECT_NEAR(est.EstimateMinRtt(), 0.01, 1e-9);
+  // an old minimum eventually gives way to what the link does now
+  est.AddRttSample(gpr_time_from_millis(50, GPR_TIMESPAN), AtMillis(20000));
+  EXPECT_NEAR(est.EstimateMinRtt(), 0.05, 1e-9);
+}
+
+TEST(DeliveryRateEstimatorTest, FollowsBandwidthDown) {
+  DeliveryRateEstimator est("test");
+  est.AddRttSample(gpr_time_from_millis(10, GPR_TIMESPAN), AtMillis(0));
+  Deliver(&est, 0, 200, 4000);
+  EXPECT_NEAR(est.EstimateBandwidth(), 4e6, 4e4);
+  Deliver(&est, 200, 400, 1000);
+  EXPECT_NEAR(est.EstimateBandwidth(), 1e6, 1e4);
+}
+
+TEST(DeliveryRateEstimatorTest, IgnoresIdleTime) {
+  DeliveryRateEstimator est("test");
+  est.AddRttSample(gpr_time_from_millis(10, GPR_TIMESPAN), AtMillis(0));
+  for (int64_t burst = 0; burst < 20; burst++) {
+    Deliver(&est, burst * 100, burst * 100 + 20, 1000);
+  }
+  EXPECT_NEAR(est.EstimateBandwidth(), 1e6, 1e4);
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
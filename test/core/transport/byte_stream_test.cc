@@ -113,6 +113,41 @@ TEST(SliceBufferByteStream, Shutdown) {
   stream.Orphan();
 }
 
+TEST(SliceBufferByteStream, PullAvailable) {
+  grpc_core::ExecCtx exec_ctx;
+  // Create and populate slice buffer.
+  grpc_slice_buffer buffer;
+  grpc_slice_buffer_init(&buffer);
+  grpc_slice input[] = {
+      grpc_slice_from_copied_string("this slice is too long to be inlined"),
+      grpc_slice_from_copied_string("and so is this one, which follows it"),
+  };
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(input); ++i) {
+    grpc_slice_buffer_add(&buffer, grpc_slice_ref_internal(input[i]));
+  }
+  // Create byte stream.
+  SliceBufferByteStream stream(&buffer, 0);
+  grpc_slice_buffer_destroy_internal(&buffer);
+  grpc_closure closure;
+  GRPC_CLOSURE_INIT(&closure, NotCalledClosure, nullptr,
+                    grpc_schedule_on_exec_ctx);
+  // Both slices come out of a single pull, without being copied.
+  ASSERT_TRUE(stream.Next(~(size_t)0, &closure));
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&output);
+  grpc_error* error = stream.PullAvailable(&output);
+  EXPECT_TRUE(error == GRPC_ERROR_NONE);
+  ASSERT_EQ(GPR_ARRAY_SIZE(input), output.count);
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(input); ++i) {
+    EXPECT_EQ(GRPC_SLICE_START_PTR(input[i]),
+              GRPC_SLICE_START_PTR(output.slices[i]));
+    grpc_slice_unref_internal(input[i]);
+  }
+  grpc_slice_buffer_destroy_internal(&output);
+  // Clean up.
+  stream.Orphan();
+}
+
 //
 // CachingByteStream tests
 //
@@ -18,6 +18,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include <grpc/grpc.h>
@@ -26,6 +27,7 @@
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/b64.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "test/core/util/test_config.h"
@@ -84,10 +86,42 @@ static size_t base64_infer_length(const char* s) {
       grpc_slice_from_copied_buffer(expected, sizeof(expected) - 1), slice, \
       #slice, __LINE__);
 
+#define EXPECT_SLICE_EQ_SLICE(expected, slice) \
+  expect_slice_eq(expected, slice, #slice, __LINE__);
+
 #define ENCODE_AND_DECODE(s) \
   EXPECT_SLICE_EQ(           \
       s, grpc_chttp2_base64_decode_with_length(base64_encode(s), strlen(s)));
 
+/* Round trips every input length up to a few vector widths through the bulk
+   decoder at each instruction set level, and checks that a bad character
+   anywhere in the input is still rejected. */
+static void expect_simd_round_trip(void) {
+  char data[200];
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = static_cast<char>(rand());
+  }
+  for (int level = 0; level <= 2; level++) {
+    grpc_base64_limit_simd_for_testing(level);
+    for (size_t len = 0; len <= sizeof(data); len++) {
+      grpc_slice input = grpc_slice_from_copied_buffer(data, len);
+      grpc_slice base64 = grpc_chttp2_base64_encode(input);
+      EXPECT_SLICE_EQ_SLICE(input, grpc_chttp2_base64_decode_with_length(
+                                       base64, len));
+      if (len > 0) {
+        grpc_slice bad = grpc_slice_copy(base64);
+        uint8_t* bad_bytes = GRPC_SLICE_START_PTR(bad);
+        bad_bytes[GRPC_SLICE_LENGTH(bad) / 2] = ':';
+        EXPECT_SLICE_EQ_SLICE(grpc_empty_slice(),
+                              grpc_chttp2_base64_decode_with_length(bad, len));
+        grpc_slice_unref_internal(bad);
+      }
+      grpc_slice_unref_internal(base64);
+    }
+  }
+  grpc_base64_limit_simd_for_testing(2);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -164,6 +198,8 @@ int main(int argc, char** argv) {
     EXPECT_DECODED_LENGTH("a===", 0);
     EXPECT_DECODED_LENGTH("abcde", 0);
     EXPECT_DECODED_LENGTH("abcde===", 0);
+
+    expect_simd_round_trip();
   }
   grpc_shutdown();
   return all_ok ? 0 : 1;
@@ -18,6 +18,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 /* This is here for grpc_is_binary_header
@@ -27,6 +28,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/slice/b64.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "test/core/util/test_config.h"
 
@@ -91,6 +93,40 @@ static void expect_combined_equiv(const char* s, size_t len, int line) {
 #define EXPECT_COMBINED_EQUIV(x) \
   expect_combined_equiv(x, sizeof(x) - 1, __LINE__)
 
+/* Checks the bulk encoders at each instruction set level against the scalar
+   code, for every input length up to a few chunks of the combined encoder. */
+static void expect_simd_equiv(void) {
+  char data[600];
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = static_cast<char>(rand());
+  }
+  for (size_t len = 0; len <= sizeof(data); len++) {
+    grpc_slice input = grpc_slice_from_copied_buffer(data, len);
+    grpc_base64_limit_simd_for_testing(0);
+    grpc_slice base64 = grpc_chttp2_base64_encode(input);
+    grpc_slice combined = grpc_chttp2_base64_encode_and_huffman_compress(input);
+    for (int level = 1; level <= 2; level++) {
+      grpc_base64_limit_simd_for_testing(level);
+      grpc_slice got_base64 = grpc_chttp2_base64_encode(input);
+      grpc_slice got_combined =
+          grpc_chttp2_base64_encode_and_huffman_compress(input);
+      if (!grpc_slice_eq(base64, got_base64) ||
+          !grpc_slice_eq(combined, got_combined)) {
+        gpr_log(GPR_ERROR, "FAILED: simd level %d, length %d", level,
+                static_cast<int>(len));
+        all_ok = 0;
+      }
+      grpc_slice_unref(got_base64);
+      grpc_slice_unref(got_combined);
+    }
+    expect_combined_equiv(data, len, __LINE__);
+    grpc_slice_unref(input);
+    grpc_slice_unref(base64);
+    grpc_slice_unref(combined);
+  }
+  grpc_base64_limit_simd_for_testing(2);
+}
+
 static void expect_binary_header(const char* hdr, int binary) {
   if (grpc_is_binary_header(grpc_slice_from_static_string(hdr)) != binary) {
     gpr_log(GPR_ERROR, "FAILED: expected header '%s' to be %s", hdr,
@@ -169,6 +205,8 @@ int main(int argc, char** argv) {
       "\xe0\xe1\xe2\xe3\xe4\xe5\xe6\xe7\xe8\xe9\xea\xeb\xec\xed\xee\xef"
       "\xf0\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\xff");
 
+  expect_simd_equiv();
+
   expect_binary_header("foo-bin", 1);
   expect_binary_header("foo-bar", 0);
   expect_binary_header("-bin", 0);
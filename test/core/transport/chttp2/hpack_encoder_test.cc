@@ -31,9 +31,11 @@
 
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/transport/metadata.h"
+#include "src/core/lib/transport/status_metadata.h"
 #include "test/core/util/parse_hexstring.h"
 #include "test/core/util/slice_splitter.h"
 #include "test/core/util/test_config.h"
@@ -394,6 +396,133 @@ static void test_interned_key_indexed() {
   }
 }
 
+/* A batch that encodes to indexed fields only is re-emitted from its memoized
+   header block, which must be dropped once the decoder table changes and the
+   dynamic indices shift. */
+static void test_memoized_header_block() {
+  verify_params params = {false, false, false};
+  verify(params, "00000a 0104 deadbeef 40 0161 0162 40 0163 0164", 2, "a", "b",
+         "c", "d");
+  for (int i = 0; i < 3; i++) {
+    verify(params, "000002 0104 deadbeef bf be", 2, "a", "b", "c", "d");
+  }
+  verify(params, "000005 0104 deadbeef 40 0165 0166", 1, "e", "f");
+  for (int i = 0; i < 3; i++) {
+    verify(params, "000002 0104 deadbeef c0 bf", 2, "a", "b", "c", "d");
+  }
+}
+
+static grpc_slice encode_batch(grpc_chttp2_hpack_compressor* c,
+                               grpc_metadata_batch* b) {
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&output);
+  grpc_transport_one_way_stats stats;
+  stats = {};
+  grpc_encode_header_options hopt = {
+      0xdeadbeef, /* stream_id */
+      true,       /* is_eof */
+      false,      /* use_true_binary_metadata */
+      16384,      /* max_frame_size */
+      &stats      /* stats */
+  };
+  grpc_chttp2_encode_header(c, nullptr, 0, b, &hopt, &output);
+  verify_frames(output, true);
+  grpc_slice merged = grpc_slice_merge(output.slices, output.count);
+  grpc_slice_buffer_destroy_internal(&output);
+  return merged;
+}
+
+/* grpc-status and grpc-message backed by caller storage, the way the server
+   sends them, must hit the wire exactly like allocated elements. */
+static void verify_status_with_storage(grpc_status_code status,
+                                       const char* message) {
+  grpc_chttp2_hpack_compressor storage_compressor;
+  grpc_chttp2_hpack_compressor mdelem_compressor;
+  grpc_chttp2_hpack_compressor_init(&storage_compressor);
+  grpc_chttp2_hpack_compressor_init(&mdelem_compressor);
+  for (int round = 0; round < 2; round++) {
+    grpc_metadata_batch storage_batch;
+    grpc_metadata_batch_init(&storage_batch);
+    grpc_linked_mdelem storage_status;
+    grpc_linked_mdelem storage_message;
+    grpc_linked_mdelem storage_extra;
+    grpc_core::ManualConstructor<grpc_mdelem_data> status_storage;
+    grpc_core::ManualConstructor<grpc_mdelem_data> message_storage;
+    storage_status.md = grpc_get_status_elem(status, status_storage.get());
+    GPR_ASSERT(grpc_metadata_batch_link_tail(&storage_batch,
+                                             &storage_status) ==
+               GRPC_ERROR_NONE);
+    GPR_ASSERT(storage_batch.idx.named.grpc_status == &storage_status);
+    GPR_ASSERT(grpc_get_status_code_from_metadata(storage_status.md) == status);
+    grpc_slice message_slice = grpc_slice_from_static_string("");
+    if (message != nullptr) {
+      message_slice = grpc_slice_from_copied_string(message);
+      new (message_storage.get())
+          grpc_mdelem_data{GRPC_MDSTR_GRPC_MESSAGE, message_slice};
+      storage_message.md = grpc_mdelem_create(
+          GRPC_MDSTR_GRPC_MESSAGE, message_slice, message_storage.get());
+      GPR_ASSERT(grpc_metadata_batch_link_tail(&storage_batch,
+                                               &storage_message) ==
+                 GRPC_ERROR_NONE);
+    }
+    storage_extra.md = grpc_mdelem_from_slices(
+        grpc_slice_intern(grpc_slice_from_static_string("a")),
+        grpc_slice_intern(grpc_slice_from_static_string("b")));
+    GPR_ASSERT(grpc_metadata_batch_link_tail(&storage_batch, &storage_extra) ==
+               GRPC_ERROR_NONE);
+
+    grpc_metadata_batch mdelem_batch;
+    grpc_metadata_batch_init(&mdelem_batch);
+    grpc_linked_mdelem mdelem_status;
+    grpc_linked_mdelem mdelem_message;
+    grpc_linked_mdelem mdelem_extra;
+    mdelem_status.md = grpc_get_reffed_status_elem(status);
+    GPR_ASSERT(grpc_metadata_batch_link_tail(&mdelem_batch, &mdelem_status) ==
+               GRPC_ERROR_NONE);
+    if (message != nullptr) {
+      mdelem_message.md = grpc_mdelem_from_slices(
+          GRPC_MDSTR_GRPC_MESSAGE, grpc_slice_from_copied_string(message));
+      GPR_ASSERT(grpc_metadata_batch_link_tail(
+                     &mdelem_batch, &mdelem_message) == GRPC_ERROR_NONE);
+    }
+    mdelem_extra.md = GRPC_MDELEM_REF(storage_extra.md);
+    GPR_ASSERT(grpc_metadata_batch_link_tail(&mdelem_batch, &mdelem_extra) ==
+               GRPC_ERROR_NONE);
+
+    GPR_ASSERT(grpc_metadata_batch_size(&storage_batch) ==
+               grpc_metadata_batch_size(&mdelem_batch));
+    grpc_slice storage_output =
+        encode_batch(&storage_compressor, &storage_batch);
+    grpc_slice mdelem_output = encode_batch(&mdelem_compressor, &mdelem_batch);
+    if (!grpc_slice_eq(storage_output, mdelem_output)) {
+      char* storage_str =
+          grpc_dump_slice(storage_output, GPR_DUMP_HEX | GPR_DUMP_ASCII);
+      char* mdelem_str =
+          grpc_dump_slice(mdelem_output, GPR_DUMP_HEX | GPR_DUMP_ASCII);
+      gpr_log(GPR_ERROR, "mismatched output for status %d", status);
+      gpr_log(GPR_ERROR, "EXPECT: %s", mdelem_str);
+      gpr_log(GPR_ERROR, "GOT:    %s", storage_str);
+      gpr_free(storage_str);
+      gpr_free(mdelem_str);
+      g_failure = 1;
+    }
+    grpc_slice_unref_internal(storage_output);
+    grpc_slice_unref_internal(mdelem_output);
+    grpc_metadata_batch_destroy(&storage_batch);
+    grpc_metadata_batch_destroy(&mdelem_batch);
+    grpc_slice_unref_internal(message_slice);
+  }
+  grpc_chttp2_hpack_compressor_destroy(&storage_compressor);
+  grpc_chttp2_hpack_compressor_destroy(&mdelem_compressor);
+}
+
+static void test_status_with_storage() {
+  verify_status_with_storage(GRPC_STATUS_OK, nullptr);
+  verify_status_with_storage(GRPC_STATUS_CANCELLED, "cancelled");
+  verify_status_with_storage(GRPC_STATUS_NOT_FOUND, "no such thing");
+  verify_status_with_storage(GRPC_STATUS_UNAUTHENTICATED, nullptr);
+}
+
 static void run_test(void (*test)(), const char* name) {
   gpr_log(GPR_INFO, "RUN TEST: %s", name);
   grpc_core::ExecCtx exec_ctx;
@@ -412,6 +541,8 @@ int main(int argc, char** argv) {
   TEST(test_encode_header_size);
   TEST(test_interned_key_indexed);
   TEST(test_continuation_headers);
+  TEST(test_status_with_storage);
+  TEST(test_memoized_header_block);
   grpc_shutdown();
   for (i = 0; i < num_to_delete; i++) {
     gpr_free(to_delete[i]);
@@ -19,12 +19,15 @@
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/util/parse_hexstring.h"
 #include "test/core/util/slice_splitter.h"
@@ -212,11 +215,170 @@ static void test_vectors(grpc_slice_split_mode mode) {
   grpc_chttp2_hpack_parser_destroy(&parser);
 }
 
+static grpc_error* save_value(void* ud, grpc_mdelem md) {
+  grpc_slice* value = static_cast<grpc_slice*>(ud);
+  *value = grpc_slice_ref(GRPC_MDVALUE(md));
+  GRPC_MDELEM_UNREF(md);
+  return GRPC_ERROR_NONE;
+}
+
+/* parses a literal header whose value is the given huffman encoded bytes */
+static grpc_slice parse_huffman_value(grpc_chttp2_hpack_parser* parser,
+                                      grpc_slice_split_mode mode,
+                                      grpc_slice huffman) {
+  GPR_ASSERT(GRPC_SLICE_LENGTH(huffman) < 0x7f);
+  grpc_slice input = grpc_slice_malloc(4 + GRPC_SLICE_LENGTH(huffman));
+  uint8_t* p = GRPC_SLICE_START_PTR(input);
+  *p++ = 0x00; /* literal header without indexing, new name */
+  *p++ = 0x01;
+  *p++ = 'a';
+  *p++ = static_cast<uint8_t>(0x80 | GRPC_SLICE_LENGTH(huffman));
+  memcpy(p, GRPC_SLICE_START_PTR(huffman), GRPC_SLICE_LENGTH(huffman));
+  grpc_slice* slices;
+  size_t nslices;
+  grpc_split_slices(mode, &input, 1, &slices, &nslices);
+  grpc_slice_unref(input);
+
+  grpc_slice value = grpc_empty_slice();
+  parser->on_header = save_value;
+  parser->on_header_user_data = &value;
+  for (size_t i = 0; i < nslices; i++) {
+    grpc_core::ExecCtx exec_ctx;
+    GPR_ASSERT(grpc_chttp2_hpack_parser_parse(parser, slices[i]) ==
+               GRPC_ERROR_NONE);
+    grpc_slice_unref(slices[i]);
+  }
+  gpr_free(slices);
+  return value;
+}
+
+/* A huffman encoded string that arrives whole is decoded several symbols at a
+   time, and one that is split across slices a nibble at a time. Both must
+   agree on every input: encoded printable text, and arbitrary bits with long
+   codes, EOS and stray padding. */
+static void test_huffman_decoders_agree() {
+  grpc_chttp2_hpack_parser whole_parser;
+  grpc_chttp2_hpack_parser split_parser;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_chttp2_hpack_parser_init(&whole_parser);
+  grpc_chttp2_hpack_parser_init(&split_parser);
+  srand(0);
+  for (int i = 0; i < 2000; i++) {
+    grpc_slice huffman;
+    if (i % 2 == 0) {
+      grpc_slice text = grpc_slice_malloc(static_cast<size_t>(rand() % 80));
+      for (size_t j = 0; j < GRPC_SLICE_LENGTH(text); j++) {
+        GRPC_SLICE_START_PTR(text)[j] = static_cast<uint8_t>(' ' + rand() % 95);
+      }
+      huffman = grpc_chttp2_huffman_compress(text);
+      if (GRPC_SLICE_LENGTH(huffman) >= 0x7f) {
+        grpc_slice_unref(text);
+        grpc_slice_unref(huffman);
+        continue;
+      }
+      grpc_slice decoded = parse_huffman_value(
+          &whole_parser, GRPC_SLICE_SPLIT_MERGE_ALL, huffman);
+      GPR_ASSERT(grpc_slice_eq(decoded, text));
+      grpc_slice_unref(decoded);
+      grpc_slice_unref(text);
+    } else {
+      huffman = grpc_slice_malloc(static_cast<size_t>(rand() % 40));
+      for (size_t j = 0; j < GRPC_SLICE_LENGTH(huffman); j++) {
+        GRPC_SLICE_START_PTR(huffman)[j] = static_cast<uint8_t>(rand());
+      }
+    }
+    grpc_slice whole = parse_huffman_value(
+        &whole_parser, GRPC_SLICE_SPLIT_MERGE_ALL, huffman);
+    grpc_slice split = parse_huffman_value(
+        &split_parser, GRPC_SLICE_SPLIT_ONE_BYTE, huffman);
+    GPR_ASSERT(grpc_slice_eq(whole, split));
+    grpc_slice_unref(whole);
+    grpc_slice_unref(split);
+    grpc_slice_unref(huffman);
+  }
+  grpc_chttp2_hpack_parser_destroy(&whole_parser);
+  grpc_chttp2_hpack_parser_destroy(&split_parser);
+}
+
+/* parses a literal "a-bin" header whose value is base64 encoded, and huffman
+   compressed if requested, returning the decoded value */
+static grpc_slice parse_binary_value(grpc_chttp2_hpack_parser* parser,
+                                     grpc_slice_split_mode mode,
+                                     grpc_slice encoded, bool huffman) {
+  size_t length = GRPC_SLICE_LENGTH(encoded);
+  grpc_slice input = grpc_slice_malloc(12 + length);
+  uint8_t* p = GRPC_SLICE_START_PTR(input);
+  *p++ = 0x00; /* literal header without indexing, new name */
+  *p++ = 0x05;
+  memcpy(p, "a-bin", 5);
+  p += 5;
+  const uint8_t huffman_flag = huffman ? 0x80 : 0x00;
+  if (length < 0x7f) {
+    *p++ = static_cast<uint8_t>(huffman_flag | length);
+  } else {
+    *p++ = static_cast<uint8_t>(huffman_flag | 0x7f);
+    for (length -= 0x7f; length >= 0x80; length >>= 7) {
+      *p++ = static_cast<uint8_t>(0x80 | (length & 0x7f));
+    }
+    *p++ = static_cast<uint8_t>(length);
+  }
+  memcpy(p, GRPC_SLICE_START_PTR(encoded), GRPC_SLICE_LENGTH(encoded));
+  p += GRPC_SLICE_LENGTH(encoded);
+  GRPC_SLICE_SET_LENGTH(input, p - GRPC_SLICE_START_PTR(input));
+  grpc_slice* slices;
+  size_t nslices;
+  grpc_split_slices(mode, &input, 1, &slices, &nslices);
+  grpc_slice_unref(input);
+
+  grpc_slice value = grpc_empty_slice();
+  parser->on_header = save_value;
+  parser->on_header_user_data = &value;
+  for (size_t i = 0; i < nslices; i++) {
+    grpc_core::ExecCtx exec_ctx;
+    GPR_ASSERT(grpc_chttp2_hpack_parser_parse(parser, slices[i]) ==
+               GRPC_ERROR_NONE);
+    grpc_slice_unref(slices[i]);
+  }
+  gpr_free(slices);
+  return value;
+}
+
+/* binary values of every length up to a few vector widths decode the same
+   whether they arrive whole, and take the bulk base64 decoder, or byte by
+   byte */
+static void test_binary_values(grpc_slice_split_mode mode) {
+  grpc_chttp2_hpack_parser parser;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_chttp2_hpack_parser_init(&parser);
+  for (size_t len = 0; len < 300; len++) {
+    grpc_slice value = grpc_slice_malloc(len);
+    for (size_t j = 0; j < len; j++) {
+      GRPC_SLICE_START_PTR(value)[j] = static_cast<uint8_t>(rand());
+    }
+    grpc_slice base64 = grpc_chttp2_base64_encode(value);
+    grpc_slice compressed =
+        grpc_chttp2_base64_encode_and_huffman_compress(value);
+    grpc_slice decoded = parse_binary_value(&parser, mode, base64, false);
+    GPR_ASSERT(grpc_slice_eq(decoded, value));
+    grpc_slice_unref(decoded);
+    decoded = parse_binary_value(&parser, mode, compressed, true);
+    GPR_ASSERT(grpc_slice_eq(decoded, value));
+    grpc_slice_unref(decoded);
+    grpc_slice_unref(compressed);
+    grpc_slice_unref(base64);
+    grpc_slice_unref(value);
+  }
+  grpc_chttp2_hpack_parser_destroy(&parser);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
   test_vectors(GRPC_SLICE_SPLIT_MERGE_ALL);
   test_vectors(GRPC_SLICE_SPLIT_ONE_BYTE);
+  test_huffman_decoders_agree();
+  test_binary_values(GRPC_SLICE_SPLIT_MERGE_ALL);
+  test_binary_values(GRPC_SLICE_SPLIT_ONE_BYTE);
   grpc_shutdown();
   return 0;
 }
@@ -22,37 +22,46 @@
 
 #define LOG_TEST(x) gpr_log(GPR_INFO, "%s", x)
 
+static void init_map(grpc_chttp2_stream_map* map, size_t initial_capacity,
+                     bool hashed) {
+  if (hashed) {
+    grpc_chttp2_stream_map_init_hashed(map, initial_capacity);
+  } else {
+    grpc_chttp2_stream_map_init(map, initial_capacity);
+  }
+}
+
 /* test creation & destruction */
-static void test_no_op(void) {
+static void test_no_op(bool hashed) {
   grpc_chttp2_stream_map map;
 
   LOG_TEST("test_no_op");
 
-  grpc_chttp2_stream_map_init(&map, 8);
+  init_map(&map, 8, hashed);
   grpc_chttp2_stream_map_destroy(&map);
 }
 
 /* test lookup on an empty map */
-static void test_empty_find(void) {
+static void test_empty_find(bool hashed) {
   grpc_chttp2_stream_map map;
 
   LOG_TEST("test_empty_find");
 
-  grpc_chttp2_stream_map_init(&map, 8);
+  init_map(&map, 8, hashed);
   GPR_ASSERT(nullptr == grpc_chttp2_stream_map_find(&map, 39128));
   grpc_chttp2_stream_map_destroy(&map);
 }
 
 /* test add & lookup */
-static void test_basic_add_find(uint32_t n) {
+static void test_basic_add_find(uint32_t n, bool hashed) {
   grpc_chttp2_stream_map map;
   uint32_t i;
   size_t got;
 
   LOG_TEST("test_basic_add_find");
-  gpr_log(GPR_INFO, "n = %d", n);
+  gpr_log(GPR_INFO, "n = %d, hashed = %d", n, hashed);
 
-  grpc_chttp2_stream_map_init(&map, 8);
+  init_map(&map, 8, hashed);
   GPR_ASSERT(0 == grpc_chttp2_stream_map_size(&map));
   for (i = 1; i <= n; i++) {
     grpc_chttp2_stream_map_add(&map, i, (void*)static_cast<uintptr_t>(i));
@@ -75,7 +84,19 @@ static void verify_for_each(void* user_data, uint32_t stream_id, void* ptr) {
   *for_each_check += 2;
 }
 
-static void check_delete_evens(grpc_chttp2_stream_map* map, uint32_t n) {
+/* the hash table visits entries in no particular order: count the odd keys
+   instead */
+static void count_odd_for_each(void* user_data, uint32_t stream_id,
+                               void* ptr) {
+  uint32_t* for_each_check = static_cast<uint32_t*>(user_data);
+  GPR_ASSERT(ptr);
+  GPR_ASSERT((uintptr_t)ptr == stream_id);
+  GPR_ASSERT(stream_id & 1);
+  *for_each_check += 2;
+}
+
+static void check_delete_evens(grpc_chttp2_stream_map* map, uint32_t n,
+                               bool hashed) {
   uint32_t for_each_check = 1;
   uint32_t i;
   size_t got;
@@ -91,7 +112,8 @@ static void check_delete_evens(grpc_chttp2_stream_map* map, uint32_t n) {
     }
   }
 
-  grpc_chttp2_stream_map_for_each(map, verify_for_each, &for_each_check);
+  grpc_chttp2_stream_map_for_each(
+      map, hashed ? count_odd_for_each : verify_for_each, &for_each_check);
   if (n & 1) {
     GPR_ASSERT(for_each_check == n + 2);
   } else {
@@ -101,14 +123,14 @@ static void check_delete_evens(grpc_chttp2_stream_map* map, uint32_t n) {
 
 /* add a bunch of keys, delete the even ones, and make sure the map is
    consistent */
-static void test_delete_evens_sweep(uint32_t n) {
+static void test_delete_evens_sweep(uint32_t n, bool hashed) {
   grpc_chttp2_stream_map map;
   uint32_t i;
 
   LOG_TEST("test_delete_evens_sweep");
-  gpr_log(GPR_INFO, "n = %d", n);
+  gpr_log(GPR_INFO, "n = %d, hashed = %d", n, hashed);
 
-  grpc_chttp2_stream_map_init(&map, 8);
+  init_map(&map, 8, hashed);
   for (i = 1; i <= n; i++) {
     grpc_chttp2_stream_map_add(&map, i, (void*)static_cast<uintptr_t>(i));
   }
@@ -117,27 +139,27 @@ static void test_delete_evens_sweep(uint32_t n) {
       GPR_ASSERT((void*)(uintptr_t)i == grpc_chttp2_stream_map_delete(&map, i));
     }
   }
-  check_delete_evens(&map, n);
+  check_delete_evens(&map, n, hashed);
   grpc_chttp2_stream_map_destroy(&map);
 }
 
 /* add a bunch of keys, delete the even ones immediately, and make sure the map
    is consistent */
-static void test_delete_evens_incremental(uint32_t n) {
+static void test_delete_evens_incremental(uint32_t n, bool hashed) {
   grpc_chttp2_stream_map map;
   uint32_t i;
 
   LOG_TEST("test_delete_evens_incremental");
-  gpr_log(GPR_INFO, "n = %d", n);
+  gpr_log(GPR_INFO, "n = %d, hashed = %d", n, hashed);
 
-  grpc_chttp2_stream_map_init(&map, 8);
+  init_map(&map, 8, hashed);
   for (i = 1; i <= n; i++) {
     grpc_chttp2_stream_map_add(&map, i, (void*)static_cast<uintptr_t>(i));
     if ((i & 1) == 0) {
       grpc_chttp2_stream_map_delete(&map, i);
     }
   }
-  check_delete_evens(&map, n);
+  check_delete_evens(&map, n, hashed);
   grpc_chttp2_stream_map_destroy(&map);
 }
 
@@ -165,6 +187,62 @@ static void test_periodic_compaction(uint32_t n) {
   grpc_chttp2_stream_map_destroy(&map);
 }
 
+/* same for the hash table: once it has grown to fit the window, deleted slots
+   are reused or rehashed away rather than growing the table further */
+static void test_periodic_rehash(uint32_t n) {
+  grpc_chttp2_stream_map map;
+  uint32_t i;
+  uint32_t del;
+
+  LOG_TEST("test_periodic_rehash");
+  gpr_log(GPR_INFO, "n = %d", n);
+
+  grpc_chttp2_stream_map_init_hashed(&map, 16);
+  GPR_ASSERT(map.capacity == 16);
+  for (i = 1; i <= n; i++) {
+    grpc_chttp2_stream_map_add(&map, i, (void*)static_cast<uintptr_t>(i));
+    if (i > 8) {
+      del = i - 8;
+      GPR_ASSERT((void*)(uintptr_t)del ==
+                 grpc_chttp2_stream_map_delete(&map, del));
+    }
+    GPR_ASSERT(map.capacity <= 32);
+    GPR_ASSERT(grpc_chttp2_stream_map_size(&map) == (i > 8 ? 8 : i));
+  }
+  for (i = n > 8 ? n - 7 : 1; i <= n; i++) {
+    GPR_ASSERT((void*)(uintptr_t)i == grpc_chttp2_stream_map_find(&map, i));
+  }
+  grpc_chttp2_stream_map_destroy(&map);
+}
+
+static void delete_in_for_each(void* user_data, uint32_t stream_id,
+                               void* ptr) {
+  grpc_chttp2_stream_map* map = static_cast<grpc_chttp2_stream_map*>(user_data);
+  GPR_ASSERT(ptr == grpc_chttp2_stream_map_delete(map, stream_id));
+}
+
+/* test that for_each tolerates the callback deleting the entry it is given,
+   as the transport does when cancelling all streams */
+static void test_delete_during_for_each(uint32_t n, bool hashed) {
+  grpc_chttp2_stream_map map;
+  uint32_t i;
+
+  LOG_TEST("test_delete_during_for_each");
+  gpr_log(GPR_INFO, "n = %d, hashed = %d", n, hashed);
+
+  init_map(&map, 8, hashed);
+  for (i = 1; i <= n; i++) {
+    grpc_chttp2_stream_map_add(&map, i, (void*)static_cast<uintptr_t>(i));
+  }
+  grpc_chttp2_stream_map_for_each(&map, delete_in_for_each, &map);
+  GPR_ASSERT(0 == grpc_chttp2_stream_map_size(&map));
+  GPR_ASSERT(nullptr == grpc_chttp2_stream_map_rand(&map));
+  for (i = 1; i <= n; i++) {
+    GPR_ASSERT(nullptr == grpc_chttp2_stream_map_find(&map, i));
+  }
+  grpc_chttp2_stream_map_destroy(&map);
+}
+
 int main(int argc, char** argv) {
   uint32_t n = 1;
   uint32_t prev = 1;
@@ -172,14 +250,20 @@ int main(int argc, char** argv) {
 
   grpc::testing::TestEnvironment env(argc, argv);
 
-  test_no_op();
-  test_empty_find();
+  test_no_op(false);
+  test_no_op(true);
+  test_empty_find(false);
+  test_empty_find(true);
 
   while (n < 100000) {
-    test_basic_add_find(n);
-    test_delete_evens_sweep(n);
-    test_delete_evens_incremental(n);
+    for (int hashed = 0; hashed <= 1; hashed++) {
+      test_basic_add_find(n, hashed);
+      test_delete_evens_sweep(n, hashed);
+      test_delete_evens_incremental(n, hashed);
+      test_delete_during_for_each(n, hashed);
+    }
     test_periodic_compaction(n);
+    test_periodic_rehash(n);
 
     tmp = n;
     n += prev;
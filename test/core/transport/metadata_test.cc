@@ -32,6 +32,7 @@
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_table.h"
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/transport/static_metadata.h"
@@ -392,6 +393,77 @@ static void test_copied_static_metadata(bool dup_key, bool dup_value) {
   grpc_shutdown();
 }
 
+/* Each thread interns keys from a range that overlaps with its neighbours',
+ * so the lock-free lookups race against inserts, against other threads
+ * dropping the last ref, and against gc and growth of the same shards. Every
+ * thread also pins a few keys for its whole run so hits keep landing on live
+ * entries while the entries around them are being freed. */
+#define CONCURRENT_THREADS 8
+#define CONCURRENT_ITERATIONS 20000
+#define CONCURRENT_KEYS 2000
+#define CONCURRENT_PINNED 8
+
+static std::string concurrent_key(size_t i) {
+  return absl::StrFormat("concurrent-key-%" PRIuPTR, i % CONCURRENT_KEYS);
+}
+
+static void concurrent_intern_loop(void* arg) {
+  size_t thread_index = reinterpret_cast<uintptr_t>(arg);
+  grpc_core::ExecCtx exec_ctx;
+  grpc_slice value = grpc_slice_intern(grpc_slice_from_static_string("v"));
+  grpc_mdelem pinned[CONCURRENT_PINNED];
+  for (size_t i = 0; i < CONCURRENT_PINNED; i++) {
+    std::string key = concurrent_key(thread_index * 97 + i);
+    pinned[i] = grpc_mdelem_from_slices(
+        grpc_slice_intern(grpc_slice_from_static_string(key.c_str())),
+        grpc_slice_ref_internal(value));
+  }
+  for (size_t i = 0; i < CONCURRENT_ITERATIONS; i++) {
+    std::string key = concurrent_key(thread_index * 250 + i * 7);
+    grpc_slice key_slice = grpc_slice_from_static_string(key.c_str());
+    grpc_slice a = grpc_slice_intern(key_slice);
+    grpc_slice b = grpc_slice_intern(key_slice);
+    GPR_ASSERT(a.refcount == b.refcount);
+    GPR_ASSERT(grpc_slice_str_cmp(a, key.c_str()) == 0);
+    grpc_mdelem m1 = grpc_mdelem_from_slices(grpc_slice_ref_internal(a),
+                                             grpc_slice_ref_internal(value));
+    grpc_mdelem m2 = grpc_mdelem_from_slices(grpc_slice_ref_internal(b),
+                                             grpc_slice_ref_internal(value));
+    GPR_ASSERT(m1.payload == m2.payload);
+    GPR_ASSERT(grpc_slice_eq(GRPC_MDKEY(m1), a));
+    grpc_slice_unref_internal(a);
+    grpc_slice_unref_internal(b);
+    GRPC_MDELEM_UNREF(m1);
+    GRPC_MDELEM_UNREF(m2);
+    grpc_mdelem p = pinned[i % CONCURRENT_PINNED];
+    grpc_mdelem q = grpc_mdelem_from_slices(
+        grpc_slice_intern(GRPC_MDKEY(p)), grpc_slice_ref_internal(value));
+    GPR_ASSERT(p.payload == q.payload);
+    GRPC_MDELEM_UNREF(q);
+  }
+  for (size_t i = 0; i < CONCURRENT_PINNED; i++) {
+    GRPC_MDELEM_UNREF(pinned[i]);
+  }
+  grpc_slice_unref_internal(value);
+}
+
+static void test_concurrent_intern_and_gc(void) {
+  gpr_log(GPR_INFO, "test_concurrent_intern_and_gc");
+
+  grpc_init();
+  grpc_core::Thread thds[CONCURRENT_THREADS];
+  for (size_t i = 0; i < CONCURRENT_THREADS; i++) {
+    thds[i] = grpc_core::Thread("grpc_concurrent_intern",
+                                concurrent_intern_loop,
+                                reinterpret_cast<void*>(i));
+    thds[i].Start();
+  }
+  for (size_t i = 0; i < CONCURRENT_THREADS; i++) {
+    thds[i].Join();
+  }
+  grpc_shutdown();
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -410,6 +482,7 @@ int main(int argc, char** argv) {
   test_things_stick_around();
   test_user_data_works();
   test_user_data_works_for_allocated_md();
+  test_concurrent_intern_and_gc();
   grpc_shutdown();
   return 0;
 }
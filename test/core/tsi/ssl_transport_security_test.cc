@@ -25,10 +25,14 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/load_file.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "test/core/tsi/transport_security_test_lib.h"
 #include "test/core/util/test_config.h"
@@ -98,6 +102,9 @@ typedef struct ssl_tsi_test_fixture {
   bool session_reused;
   const char* session_ticket_key;
   size_t session_ticket_key_size;
+  bool disable_session_resumption;
+  // Expected value of the peer verification cached property, if any.
+  const char* peer_verification_cached;
   tsi_ssl_server_handshaker_factory* server_handshaker_factory;
   tsi_ssl_client_handshaker_factory* client_handshaker_factory;
 } ssl_tsi_test_fixture;
@@ -164,6 +171,8 @@ static void ssl_test_setup_handshakers(tsi_test_fixture* fixture) {
   }
   server_options.session_ticket_key = ssl_fixture->session_ticket_key;
   server_options.session_ticket_key_size = ssl_fixture->session_ticket_key_size;
+  server_options.disable_session_resumption =
+      ssl_fixture->disable_session_resumption;
   server_options.min_tls_version = test_tls_version;
   server_options.max_tls_version = test_tls_version;
   GPR_ASSERT(tsi_create_ssl_server_handshaker_factory_with_options(
@@ -218,6 +227,20 @@ check_basic_authenticated_peer_and_get_common_name(const tsi_peer* peer) {
   return property;
 }
 
+static void check_peer_verification_cache(ssl_tsi_test_fixture* ssl_fixture,
+                                          tsi_peer* peer) {
+  const tsi_peer_property* cached = tsi_peer_get_property_by_name(
+      peer, TSI_SSL_PEER_VERIFICATION_CACHED_PEER_PROPERTY);
+  if (ssl_fixture->peer_verification_cached == nullptr) {
+    GPR_ASSERT(cached == nullptr);
+  } else {
+    GPR_ASSERT(cached != nullptr);
+    GPR_ASSERT(strncmp(cached->value.data,
+                       ssl_fixture->peer_verification_cached,
+                       cached->value.length) == 0);
+  }
+}
+
 static void check_session_reusage(ssl_tsi_test_fixture* ssl_fixture,
                                   tsi_peer* peer) {
   const tsi_peer_property* session_reused =
@@ -339,6 +362,7 @@ static void ssl_test_check_handshaker_peers(tsi_test_fixture* fixture) {
     GPR_ASSERT(tsi_handshaker_result_extract_peer(
                    ssl_fixture->base.client_result, &peer) == TSI_OK);
     check_session_reusage(ssl_fixture, &peer);
+    check_peer_verification_cache(ssl_fixture, &peer);
     check_alpn(ssl_fixture, &peer);
     check_security_level(&peer);
     if (ssl_fixture->server_name_indication == nullptr ||
@@ -357,6 +381,7 @@ static void ssl_test_check_handshaker_peers(tsi_test_fixture* fixture) {
     GPR_ASSERT(tsi_handshaker_result_extract_peer(
                    ssl_fixture->base.server_result, &peer) == TSI_OK);
     check_session_reusage(ssl_fixture, &peer);
+    check_peer_verification_cache(ssl_fixture, &peer);
     check_alpn(ssl_fixture, &peer);
     check_security_level(&peer);
     check_client_peer(ssl_fixture, &peer);
@@ -501,6 +526,8 @@ static tsi_test_fixture* ssl_tsi_test_fixture_create() {
   ssl_fixture->session_reused = false;
   ssl_fixture->session_ticket_key = nullptr;
   ssl_fixture->session_ticket_key_size = 0;
+  ssl_fixture->disable_session_resumption = false;
+  ssl_fixture->peer_verification_cached = nullptr;
   ssl_fixture->force_client_auth = false;
   return &ssl_fixture->base;
 }
@@ -729,6 +756,120 @@ void ssl_tsi_test_do_round_trip_odd_buffer_size() {
   }
 }
 
+/* Sends message_size bytes, split into odd-sized slices, through sender and
+   feeds the protected bytes to receiver a few at a time. */
+static void ssl_tsi_test_zero_copy_send(tsi_zero_copy_grpc_protector* sender,
+                                        tsi_zero_copy_grpc_protector* receiver,
+                                        size_t message_size) {
+  unsigned char* message =
+      static_cast<unsigned char*>(gpr_malloc(message_size));
+  for (size_t i = 0; i < message_size; i++) {
+    message[i] = static_cast<unsigned char>(rand());
+  }
+  grpc_slice_buffer unprotected;
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer frame;
+  grpc_slice_buffer received;
+  grpc_slice_buffer_init(&unprotected);
+  grpc_slice_buffer_init(&protected_slices);
+  grpc_slice_buffer_init(&frame);
+  grpc_slice_buffer_init(&received);
+  size_t offset = 0;
+  for (size_t slice_size = 1; offset < message_size; slice_size += 997) {
+    size_t size = GPR_MIN(slice_size, message_size - offset);
+    grpc_slice_buffer_add(
+        &unprotected,
+        grpc_slice_from_copied_buffer(
+            reinterpret_cast<const char*>(message + offset), size));
+    offset += size;
+  }
+  GPR_ASSERT(tsi_zero_copy_grpc_protector_protect(sender, &unprotected,
+                                                  &protected_slices) == TSI_OK);
+  GPR_ASSERT(unprotected.length == 0);
+  while (protected_slices.length > 0) {
+    grpc_slice_buffer_move_first(&protected_slices,
+                                 GPR_MIN(protected_slices.length, 4099),
+                                 &frame);
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_unprotect(receiver, &frame,
+                                                      &received) == TSI_OK);
+  }
+  GPR_ASSERT(received.length == message_size);
+  unsigned char* output =
+      static_cast<unsigned char*>(gpr_malloc(message_size));
+  grpc_slice_buffer_move_first_into_buffer(&received, message_size, output);
+  GPR_ASSERT(memcmp(message, output, message_size) == 0);
+  gpr_free(output);
+  gpr_free(message);
+  grpc_slice_buffer_destroy(&unprotected);
+  grpc_slice_buffer_destroy(&protected_slices);
+  grpc_slice_buffer_destroy(&frame);
+  grpc_slice_buffer_destroy(&received);
+}
+
+/* Unprotects whatever the peer sent after its handshake finished, such as TLS
+   1.3 session tickets, the way secure_endpoint handles leftover bytes. */
+static void ssl_tsi_test_zero_copy_drain_channel(
+    tsi_test_channel* channel, tsi_zero_copy_grpc_protector* protector,
+    bool is_client) {
+  uint8_t* bytes =
+      is_client ? channel->client_channel : channel->server_channel;
+  size_t* bytes_read = is_client ? &channel->bytes_read_from_client_channel
+                                 : &channel->bytes_read_from_server_channel;
+  size_t bytes_written = is_client ? channel->bytes_written_to_client_channel
+                                   : channel->bytes_written_to_server_channel;
+  grpc_slice_buffer leftover;
+  grpc_slice_buffer unprotected;
+  grpc_slice_buffer_init(&leftover);
+  grpc_slice_buffer_init(&unprotected);
+  grpc_slice_buffer_add(
+      &leftover, grpc_slice_from_copied_buffer(
+                     reinterpret_cast<const char*>(bytes + *bytes_read),
+                     bytes_written - *bytes_read));
+  *bytes_read = bytes_written;
+  GPR_ASSERT(tsi_zero_copy_grpc_protector_unprotect(protector, &leftover,
+                                                    &unprotected) == TSI_OK);
+  GPR_ASSERT(unprotected.length == 0);
+  grpc_slice_buffer_destroy(&leftover);
+  grpc_slice_buffer_destroy(&unprotected);
+}
+
+void ssl_tsi_test_do_round_trip_zero_copy() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_do_round_trip_zero_copy");
+  tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+  /* Keep the bytes left in the channel after the handshake. */
+  fixture->test_unused_bytes = false;
+  tsi_test_do_handshake(fixture);
+  /* A socket that is not connected cannot take over record protection, and
+     the failed attempt must leave the results usable. */
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  GPR_ASSERT(fd >= 0);
+  GPR_ASSERT(tsi_handshaker_result_offload_record_protection(
+                 fixture->client_result, fd) == TSI_UNIMPLEMENTED);
+  GPR_ASSERT(tsi_handshaker_result_offload_record_protection(
+                 fixture->server_result, fd) == TSI_UNIMPLEMENTED);
+  close(fd);
+  tsi_zero_copy_grpc_protector* client_protector = nullptr;
+  tsi_zero_copy_grpc_protector* server_protector = nullptr;
+  size_t max_frame_size = 4096;
+  GPR_ASSERT(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                 fixture->client_result, nullptr, &client_protector) ==
+             TSI_OK);
+  GPR_ASSERT(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                 fixture->server_result, &max_frame_size,
+                 &server_protector) == TSI_OK);
+  ssl_tsi_test_zero_copy_drain_channel(fixture->channel, client_protector,
+                                       true /* is_client */);
+  ssl_tsi_test_zero_copy_drain_channel(fixture->channel, server_protector,
+                                       false /* is_client */);
+  ssl_tsi_test_zero_copy_send(client_protector, server_protector, 1);
+  ssl_tsi_test_zero_copy_send(server_protector, client_protector, 1);
+  ssl_tsi_test_zero_copy_send(client_protector, server_protector, 300000);
+  ssl_tsi_test_zero_copy_send(server_protector, client_protector, 300000);
+  tsi_zero_copy_grpc_protector_destroy(client_protector);
+  tsi_zero_copy_grpc_protector_destroy(server_protector);
+  tsi_test_fixture_destroy(fixture);
+}
+
 void ssl_tsi_test_do_handshake_session_cache() {
   gpr_log(GPR_INFO, "ssl_tsi_test_do_handshake_session_cache");
   tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
@@ -762,6 +903,86 @@ void ssl_tsi_test_do_handshake_session_cache() {
   tsi_ssl_session_cache_unref(session_cache);
 }
 
+void ssl_tsi_test_do_handshake_shared_session_ticket_keys() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_do_handshake_shared_session_ticket_keys");
+  tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
+  auto do_handshake = [&session_cache](bool session_reused,
+                                       bool force_client_auth = false,
+                                       bool disable_resumption = false) {
+    tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+    ssl_tsi_test_fixture* ssl_fixture =
+        reinterpret_cast<ssl_tsi_test_fixture*>(fixture);
+    ssl_fixture->server_name_indication =
+        const_cast<char*>("waterzooi.test.google.be");
+    ssl_fixture->force_client_auth = force_client_auth;
+    ssl_fixture->disable_session_resumption = disable_resumption;
+    tsi_ssl_session_cache_ref(session_cache);
+    ssl_fixture->session_cache = session_cache;
+    ssl_fixture->session_reused = session_reused;
+    tsi_test_do_round_trip(&ssl_fixture->base);
+    tsi_test_fixture_destroy(fixture);
+  };
+  // Every handshake gets a new server handshaker factory, which still opens
+  // the tickets issued by the previous one.
+  GPR_ASSERT(tsi_ssl_set_session_ticket_keys(nullptr, 0, 0) == TSI_OK);
+  do_handshake(false);
+  do_handshake(true);
+  // Resetting the shared keys invalidates tickets.
+  GPR_ASSERT(tsi_ssl_set_session_ticket_keys(nullptr, 0, 0) == TSI_OK);
+  do_handshake(false);
+  do_handshake(true);
+  char keys[2 * TSI_SSL_SESSION_TICKET_KEY_SIZE];
+  memset(keys, 'b', TSI_SSL_SESSION_TICKET_KEY_SIZE);
+  memset(keys + TSI_SSL_SESSION_TICKET_KEY_SIZE, 'a',
+         TSI_SSL_SESSION_TICKET_KEY_SIZE);
+  GPR_ASSERT(tsi_ssl_set_session_ticket_keys(
+                 keys, TSI_SSL_SESSION_TICKET_KEY_SIZE - 1, 0) ==
+             TSI_INVALID_ARGUMENT);
+  GPR_ASSERT(tsi_ssl_set_session_ticket_keys(
+                 keys + TSI_SSL_SESSION_TICKET_KEY_SIZE,
+                 TSI_SSL_SESSION_TICKET_KEY_SIZE, 0) == TSI_OK);
+  do_handshake(false);
+  do_handshake(true);
+  // Tickets sealed with a key that is no longer the current one still open.
+  GPR_ASSERT(tsi_ssl_set_session_ticket_keys(keys, sizeof(keys), 0) == TSI_OK);
+  do_handshake(true);
+  // A session does not resume on a server checking client certificates.
+  do_handshake(false, true);
+  do_handshake(true, true);
+  do_handshake(false, false, true);
+  GPR_ASSERT(tsi_ssl_set_session_ticket_keys(
+                 nullptr, 0,
+                 TSI_SSL_DEFAULT_SESSION_TICKET_KEY_ROTATION_SECONDS) == TSI_OK);
+  tsi_ssl_session_cache_unref(session_cache);
+}
+
+void ssl_tsi_test_do_handshake_peer_verification_cache() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_do_handshake_peer_verification_cache");
+  auto do_handshake = [](const char* peer_verification_cached) {
+    tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+    ssl_tsi_test_fixture* ssl_fixture =
+        reinterpret_cast<ssl_tsi_test_fixture*>(fixture);
+    ssl_fixture->force_client_auth = true;
+    ssl_fixture->disable_session_resumption = true;
+    ssl_fixture->peer_verification_cached = peer_verification_cached;
+    tsi_test_do_handshake(&ssl_fixture->base);
+    tsi_test_fixture_destroy(fixture);
+  };
+  GPR_ASSERT(tsi_ssl_set_peer_verification_cache_options(16, 0) ==
+             TSI_INVALID_ARGUMENT);
+  GPR_ASSERT(tsi_ssl_set_peer_verification_cache_options(16, 60) == TSI_OK);
+  // Chains verified by the handshakers of one factory are trusted by the next.
+  do_handshake("false");
+  do_handshake("true");
+  do_handshake("true");
+  // New roots flush the cache.
+  tsi_ssl_peer_verification_cache_flush();
+  do_handshake("false");
+  do_handshake("true");
+  GPR_ASSERT(tsi_ssl_set_peer_verification_cache_options(0, 0) == TSI_OK);
+  do_handshake(nullptr);
+}
+
 static const tsi_ssl_handshaker_factory_vtable* original_vtable;
 static bool handshaker_factory_destructor_called;
 
@@ -1002,8 +1223,11 @@ int main(int argc, char** argv) {
     ssl_tsi_test_do_handshake_alpn_server_no_client();
     ssl_tsi_test_do_handshake_alpn_client_server_ok();
     ssl_tsi_test_do_handshake_session_cache();
+    ssl_tsi_test_do_handshake_shared_session_ticket_keys();
+    ssl_tsi_test_do_handshake_peer_verification_cache();
     ssl_tsi_test_do_round_trip_for_all_configs();
     ssl_tsi_test_do_round_trip_odd_buffer_size();
+    ssl_tsi_test_do_round_trip_zero_copy();
     ssl_tsi_test_handshaker_factory_internals();
     ssl_tsi_test_duplicate_root_certificates();
     ssl_tsi_test_extract_x509_subject_names();
@@ -25,14 +25,27 @@
 #include "test/cpp/util/test_config.h"
 
 using grpc_core::Arena;
+using grpc_core::ArenaPool;
 
 static void BM_Arena_NoOp(benchmark::State& state) {
+  TrackCounters track_counters;
   for (auto _ : state) {
     Arena::Create(state.range(0))->Destroy();
   }
+  track_counters.Finish(state);
 }
 BENCHMARK(BM_Arena_NoOp)->Range(1, 1024 * 1024);
 
+static void BM_ArenaPool_NoOp(benchmark::State& state) {
+  TrackCounters track_counters;
+  ArenaPool pool;
+  for (auto _ : state) {
+    pool.Release(pool.CreateWithAlloc(state.range(0), 0).first);
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ArenaPool_NoOp)->Range(1, 1024 * 1024);
+
 static void BM_Arena_ManyAlloc(benchmark::State& state) {
   Arena* a = Arena::Create(state.range(0));
   const size_t realloc_after =
@@ -50,6 +63,7 @@ static void BM_Arena_ManyAlloc(benchmark::State& state) {
 BENCHMARK(BM_Arena_ManyAlloc)->Ranges({{1, 1024 * 1024}, {1, 32 * 1024}});
 
 static void BM_Arena_Batch(benchmark::State& state) {
+  TrackCounters track_counters;
   for (auto _ : state) {
     Arena* a = Arena::Create(state.range(0));
     for (int i = 0; i < state.range(1); i++) {
@@ -57,9 +71,26 @@ static void BM_Arena_Batch(benchmark::State& state) {
     }
     a->Destroy();
   }
+  track_counters.Finish(state);
 }
 BENCHMARK(BM_Arena_Batch)->Ranges({{1, 64 * 1024}, {1, 64}, {1, 1024}});
 
+// As BM_Arena_Batch, but recycling the arenas through a pool the way channels
+// do for their calls.
+static void BM_ArenaPool_Batch(benchmark::State& state) {
+  TrackCounters track_counters;
+  ArenaPool pool;
+  for (auto _ : state) {
+    Arena* a = pool.CreateWithAlloc(state.range(0), 0).first;
+    for (int i = 0; i < state.range(1); i++) {
+      a->Alloc(state.range(2));
+    }
+    pool.Release(a);
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ArenaPool_Batch)->Ranges({{1, 64 * 1024}, {1, 64}, {1, 1024}});
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
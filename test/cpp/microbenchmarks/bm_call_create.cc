@@ -35,6 +35,7 @@
 #include "src/core/ext/filters/http/message_compress/message_compress_filter.h"
 #include "src/core/ext/filters/http/server/http_server_filter.h"
 #include "src/core/ext/filters/message_size/message_size_filter.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/connected_channel.h"
 #include "src/core/lib/iomgr/call_combiner.h"
@@ -92,6 +93,21 @@ class InsecureChannel : public BaseChannelFixture {
             grpc_insecure_channel_create("localhost:1234", nullptr, nullptr)) {}
 };
 
+// As InsecureChannel, but with call arena recycling disabled, as a baseline
+// for the allocations per call.
+class InsecureChannelNoArenaPool : public BaseChannelFixture {
+ public:
+  InsecureChannelNoArenaPool() : BaseChannelFixture(CreateChannel()) {}
+
+ private:
+  static grpc_channel* CreateChannel() {
+    grpc_arg arg = grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_CALL_ARENA_POOL), 0);
+    grpc_channel_args args = {1, &arg};
+    return grpc_insecure_channel_create("localhost:1234", &args, nullptr);
+  }
+};
+
 class LameChannel : public BaseChannelFixture {
  public:
   LameChannel()
@@ -117,6 +133,7 @@ static void BM_CallCreateDestroy(benchmark::State& state) {
 }
 
 BENCHMARK_TEMPLATE(BM_CallCreateDestroy, InsecureChannel);
+BENCHMARK_TEMPLATE(BM_CallCreateDestroy, InsecureChannelNoArenaPool);
 BENCHMARK_TEMPLATE(BM_CallCreateDestroy, LameChannel);
 
 ////////////////////////////////////////////////////////////////////////////////
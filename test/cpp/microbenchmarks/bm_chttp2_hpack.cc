@@ -24,13 +24,18 @@
 #include <string.h>
 #include <memory>
 #include <sstream>
+#include <string>
 
+#include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/ext/transport/chttp2/transport/incoming_metadata.h"
+#include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/transport/static_metadata.h"
+#include "src/core/lib/transport/status_metadata.h"
 #include "src/core/lib/transport/timeout_encoding.h"
 
 #include "test/core/util/test_config.h"
@@ -393,6 +398,12 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    SingleNonInternedBinaryElem<100, false>)
     ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   SingleNonInternedBinaryElem<1024, false>)
+    ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   SingleNonInternedBinaryElem<8192, false>)
+    ->Args({0, 16384});
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    SingleNonInternedBinaryElem<1, true>)
     ->Args({0, 16384});
@@ -408,6 +419,12 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    SingleNonInternedBinaryElem<100, true>)
     ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   SingleNonInternedBinaryElem<1024, true>)
+    ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   SingleNonInternedBinaryElem<8192, true>)
+    ->Args({0, 16384});
 // test with a tiny frame size, to highlight continuation costs
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleNonInternedElem)
     ->Args({0, 1});
@@ -427,6 +444,193 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
 
 }  // namespace hpack_encoder_fixtures
 
+// Encodes client initial metadata for a fresh batch every iteration, cycling
+// through state.range(0) methods, the way a channel sends the same metadata
+// on call after call. Once every field is indexed the header block of each
+// method is re-emitted from the compressor's memo, until there are more
+// methods than memo slots.
+static void BM_HpackEncoderEncodeRepeatedHeader(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  const int num_methods = static_cast<int>(state.range(0));
+  std::vector<grpc_mdelem> paths;
+  for (int i = 0; i < num_methods; i++) {
+    std::string path = "/grpc.test.FooService/Method" + std::to_string(i);
+    paths.push_back(grpc_mdelem_from_slices(
+        GRPC_MDSTR_PATH, grpc_slice_intern(grpc_slice_from_copied_buffer(
+                             path.data(), path.size()))));
+  }
+  grpc_mdelem authority = grpc_mdelem_from_slices(
+      GRPC_MDSTR_AUTHORITY, grpc_slice_intern(grpc_slice_from_static_string(
+                                "foo.test.google.fr:1234")));
+  grpc_mdelem user_agent = grpc_mdelem_from_slices(
+      GRPC_MDSTR_USER_AGENT, grpc_slice_intern(grpc_slice_from_static_string(
+                                 "grpc-c/3.0.0-dev (linux; chttp2; green)")));
+
+  std::unique_ptr<grpc_chttp2_hpack_compressor> c(
+      new grpc_chttp2_hpack_compressor);
+  grpc_chttp2_hpack_compressor_init(c.get());
+  grpc_transport_one_way_stats stats;
+  stats = {};
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&outbuf);
+  int method = 0;
+  while (state.KeepRunning()) {
+    grpc_mdelem elems[] = {
+        GRPC_MDELEM_SCHEME_HTTP,
+        GRPC_MDELEM_METHOD_POST,
+        GRPC_MDELEM_REF(paths[method]),
+        GRPC_MDELEM_REF(authority),
+        GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP,
+        GRPC_MDELEM_TE_TRAILERS,
+        GRPC_MDELEM_CONTENT_TYPE_APPLICATION_SLASH_GRPC,
+        GRPC_MDELEM_REF(user_agent)};
+    grpc_linked_mdelem storage[GPR_ARRAY_SIZE(elems)];
+    grpc_metadata_batch b;
+    grpc_metadata_batch_init(&b);
+    for (size_t i = 0; i < GPR_ARRAY_SIZE(elems); i++) {
+      GPR_ASSERT(GRPC_LOG_IF_ERROR(
+          "addmd", grpc_metadata_batch_add_tail(&b, &storage[i], elems[i])));
+    }
+    grpc_encode_header_options hopt = {
+        static_cast<uint32_t>(state.iterations()),
+        false,
+        true,
+        16384,
+        &stats,
+    };
+    grpc_chttp2_encode_header(c.get(), nullptr, 0, &b, &hopt, &outbuf);
+    grpc_metadata_batch_destroy(&b);
+    grpc_slice_buffer_reset_and_unref_internal(&outbuf);
+    grpc_core::ExecCtx::Get()->Flush();
+    if (++method == num_methods) method = 0;
+  }
+  grpc_chttp2_hpack_compressor_destroy(c.get());
+  grpc_slice_buffer_destroy_internal(&outbuf);
+  for (grpc_mdelem path : paths) {
+    GRPC_MDELEM_UNREF(path);
+  }
+  GRPC_MDELEM_UNREF(authority);
+  GRPC_MDELEM_UNREF(user_agent);
+
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_HpackEncoderEncodeRepeatedHeader)->Arg(1)->Arg(4)->Arg(16);
+
+// Builds and encodes server trailing metadata carrying a non-OK status and a
+// message each iteration, either with grpc-status/grpc-message backed by
+// caller storage (as the server sends them) or as allocated mdelems.
+template <bool kWithStorage>
+static void BM_HpackEncoderEncodeStatus(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  const grpc_status_code status =
+      static_cast<grpc_status_code>(state.range(0));
+  grpc_slice message = grpc_slice_from_static_string("Resource exhausted");
+
+  std::unique_ptr<grpc_chttp2_hpack_compressor> c(
+      new grpc_chttp2_hpack_compressor);
+  grpc_chttp2_hpack_compressor_init(c.get());
+  grpc_transport_one_way_stats stats;
+  stats = {};
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&outbuf);
+  while (state.KeepRunning()) {
+    grpc_metadata_batch b;
+    grpc_metadata_batch_init(&b);
+    grpc_linked_mdelem storage[2];
+    grpc_core::ManualConstructor<grpc_mdelem_data> status_storage;
+    grpc_core::ManualConstructor<grpc_mdelem_data> message_storage;
+    if (kWithStorage) {
+      new (message_storage.get())
+          grpc_mdelem_data{GRPC_MDSTR_GRPC_MESSAGE, message};
+      GPR_ASSERT(GRPC_LOG_IF_ERROR(
+          "status",
+          grpc_metadata_batch_add_tail(
+              &b, &storage[0],
+              grpc_get_status_elem(status, status_storage.get()))));
+      GPR_ASSERT(GRPC_LOG_IF_ERROR(
+          "message", grpc_metadata_batch_add_tail(
+                         &b, &storage[1],
+                         grpc_mdelem_create(GRPC_MDSTR_GRPC_MESSAGE, message,
+                                            message_storage.get()))));
+    } else {
+      GPR_ASSERT(GRPC_LOG_IF_ERROR(
+          "status", grpc_metadata_batch_add_tail(
+                        &b, &storage[0], grpc_get_reffed_status_elem(status))));
+      GPR_ASSERT(GRPC_LOG_IF_ERROR(
+          "message", grpc_metadata_batch_add_tail(
+                         &b, &storage[1],
+                         grpc_mdelem_from_slices(
+                             GRPC_MDSTR_GRPC_MESSAGE,
+                             grpc_slice_ref_internal(message)))));
+    }
+    grpc_encode_header_options hopt = {
+        static_cast<uint32_t>(state.iterations()),
+        true,
+        false,
+        16384,
+        &stats,
+    };
+    grpc_chttp2_encode_header(c.get(), nullptr, 0, &b, &hopt, &outbuf);
+    grpc_metadata_batch_destroy(&b);
+    grpc_slice_buffer_reset_and_unref_internal(&outbuf);
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  grpc_chttp2_hpack_compressor_destroy(c.get());
+  grpc_slice_buffer_destroy_internal(&outbuf);
+
+  track_counters.Finish(state);
+}
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeStatus, false)
+    ->Arg(GRPC_STATUS_CANCELLED)
+    ->Arg(GRPC_STATUS_RESOURCE_EXHAUSTED);
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeStatus, true)
+    ->Arg(GRPC_STATUS_CANCELLED)
+    ->Arg(GRPC_STATUS_RESOURCE_EXHAUSTED);
+
+////////////////////////////////////////////////////////////////////////////////
+// Binary metadata encoding
+//
+
+static grpc_slice MakeRandomBytes(size_t length) {
+  grpc_slice s = grpc_slice_malloc(length);
+  for (size_t i = 0; i < length; i++) {
+    GRPC_SLICE_START_PTR(s)[i] = static_cast<uint8_t>(rand());
+  }
+  return s;
+}
+
+// Base64 encodes and huffman compresses a state.range(0) byte binary value,
+// the way the encoder sends -bin metadata to peers without true binary support
+static void BM_Base64EncodeAndHuffmanCompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice input = MakeRandomBytes(static_cast<size_t>(state.range(0)));
+  while (state.KeepRunning()) {
+    grpc_slice_unref(grpc_chttp2_base64_encode_and_huffman_compress(input));
+  }
+  grpc_slice_unref(input);
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64EncodeAndHuffmanCompress)->Range(16, 16384);
+
+// Decodes the base64 encoding of a state.range(0) byte binary value
+static void BM_Base64Decode(benchmark::State& state) {
+  TrackCounters track_counters;
+  const size_t length = static_cast<size_t>(state.range(0));
+  grpc_slice value = MakeRandomBytes(length);
+  grpc_slice input = grpc_chttp2_base64_encode(value);
+  while (state.KeepRunning()) {
+    grpc_slice_unref(grpc_chttp2_base64_decode_with_length(input, length));
+  }
+  grpc_slice_unref(input);
+  grpc_slice_unref(value);
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64Decode)->Range(16, 16384);
+
 ////////////////////////////////////////////////////////////////////////////////
 // HPACK parser
 //
@@ -879,6 +1083,81 @@ class SameDeadline {
   }
 };
 
+// Appends a length prefixed string literal
+static void AddStringLiteral(std::vector<uint8_t>* v, grpc_slice str,
+                             bool huffman) {
+  const uint8_t huffman_flag = huffman ? 0x80 : 0x00;
+  size_t length = GRPC_SLICE_LENGTH(str);
+  if (length < 0x7f) {
+    v->push_back(static_cast<uint8_t>(huffman_flag | length));
+  } else {
+    v->push_back(static_cast<uint8_t>(huffman_flag | 0x7f));
+    for (length -= 0x7f; length >= 0x80; length >>= 7) {
+      v->push_back(static_cast<uint8_t>(0x80 | (length & 0x7f)));
+    }
+    v->push_back(static_cast<uint8_t>(length));
+  }
+  v->insert(v->end(), GRPC_SLICE_START_PTR(str), GRPC_SLICE_END_PTR(str));
+}
+
+// Appends a literal header field without indexing, with a new name and a
+// huffman encoded value
+static void AddHuffmanLiteral(std::vector<uint8_t>* v, const char* key,
+                              const char* value) {
+  const size_t key_length = strlen(key);
+  GPR_ASSERT(key_length < 0x7f);
+  v->push_back(0x00);
+  v->push_back(static_cast<uint8_t>(key_length));
+  v->insert(v->end(), key, key + key_length);
+  grpc_slice huffman =
+      grpc_chttp2_huffman_compress(grpc_slice_from_static_string(value));
+  AddStringLiteral(v, huffman, true);
+  grpc_slice_unref(huffman);
+}
+
+// Long huffman encoded values of the kind that dominate parsing time on
+// servers: a bearer token, a trace context and a user-agent
+class HuffmanHeavyMetadata {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    std::vector<uint8_t> v;
+    AddHuffmanLiteral(
+        &v, "authorization",
+        "Bearer eyJhbGciOiJSUzI1NiIsImtpZCI6IjEyMzQ1Njc4OTAiLCJ0eXAiOiJKV1Qi"
+        "fQ.eyJpc3MiOiJodHRwczovL2FjY291bnRzLmV4YW1wbGUuY29tIiwiYXVkIjoiZm9v"
+        "LmV4YW1wbGUuY29tIiwic3ViIjoiMTEwMTY5NDg0NDc0Mzg2Mjc2MzM0IiwiaWF0Ijo"
+        "xNjAwMDAwMDAwLCJleHAiOjE2MDAwMDM2MDB9.dGhpcyBpcyBub3QgYSByZWFsIHNpZ"
+        "25hdHVyZSBidXQgaXQgaXMgYWJvdXQgdGhlIHJpZ2h0IGxlbmd0aCBmb3Igb25l");
+    AddHuffmanLiteral(
+        &v, "traceparent",
+        "00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01");
+    AddHuffmanLiteral(
+        &v, "user-agent",
+        "grpc-c++/1.33.0-dev grpc-c/12.0.0-dev (linux; chttp2; gon)");
+    return {MakeSlice(v)};
+  }
+};
+
+// A kLength byte binary value sent base64 encoded, and huffman compressed if
+// kHuffman, as serialized trace and auth contexts are
+template <int kLength, bool kHuffman>
+class LargeBase64BinaryElem {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    std::vector<uint8_t> v = {0x00, 0x07, 'a', 'b', 'c', '-', 'b', 'i', 'n'};
+    grpc_slice value = MakeRandomBytes(kLength);
+    grpc_slice encoded =
+        kHuffman ? grpc_chttp2_base64_encode_and_huffman_compress(value)
+                 : grpc_chttp2_base64_encode(value);
+    AddStringLiteral(&v, encoded, kHuffman);
+    grpc_slice_unref(encoded);
+    grpc_slice_unref(value);
+    return {MakeSlice(v)};
+  }
+};
+
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, EmptyBatch, UnrefHeader);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, IndexedSingleStaticElem,
                    UnrefHeader);
@@ -913,6 +1192,14 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<31, true>,
                    UnrefHeader);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<100, true>,
                    UnrefHeader);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
+                   LargeBase64BinaryElem<1024, false>, UnrefHeader);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
+                   LargeBase64BinaryElem<8192, false>, UnrefHeader);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, LargeBase64BinaryElem<1024, true>,
+                   UnrefHeader);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, LargeBase64BinaryElem<8192, true>,
+                   UnrefHeader);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeClientInitialMetadata, UnrefHeader);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
@@ -928,6 +1215,8 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata, OnInitialHeader);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline, OnHeaderTimeout);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, HuffmanHeavyMetadata,
+                   UnrefHeader);
 
 }  // namespace hpack_parser_fixtures
 
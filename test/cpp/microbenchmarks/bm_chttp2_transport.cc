@@ -29,6 +29,7 @@
 #include <sstream>
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/stream_map.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/resource_quota.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -682,6 +683,42 @@ static void BM_TransportStreamRecv(benchmark::State& state) {
 }
 BENCHMARK(BM_TransportStreamRecv)->Range(0, 128 * 1024 * 1024);
 
+// Steady state stream churn with state.range(0) open streams: each iteration
+// opens a stream, looks up a pseudo-randomly chosen open one, and closes the
+// oldest, as a busy connection does per request.
+template <bool kHashed>
+static void BM_StreamMapChurn(benchmark::State& state) {
+  TrackCounters track_counters;
+  const uint32_t open_streams = static_cast<uint32_t>(state.range(0));
+  grpc_chttp2_stream_map map;
+  if (kHashed) {
+    grpc_chttp2_stream_map_init_hashed(&map, 8);
+  } else {
+    grpc_chttp2_stream_map_init(&map, 8);
+  }
+  uint32_t next_id = 1;
+  for (uint32_t i = 0; i < open_streams; i++, next_id += 2) {
+    grpc_chttp2_stream_map_add(&map, next_id,
+                               reinterpret_cast<void*>(uintptr_t{next_id}));
+  }
+  uint32_t oldest_id = 1;
+  uint32_t lcg = 1;
+  for (auto _ : state) {
+    grpc_chttp2_stream_map_add(&map, next_id,
+                               reinterpret_cast<void*>(uintptr_t{next_id}));
+    next_id += 2;
+    lcg = lcg * 1664525 + 1013904223;
+    uint32_t id = oldest_id + 2 + 2 * ((lcg >> 8) % open_streams);
+    benchmark::DoNotOptimize(grpc_chttp2_stream_map_find(&map, id));
+    grpc_chttp2_stream_map_delete(&map, oldest_id);
+    oldest_id += 2;
+  }
+  grpc_chttp2_stream_map_destroy(&map);
+  track_counters.Finish(state);
+}
+BENCHMARK_TEMPLATE(BM_StreamMapChurn, false)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StreamMapChurn, true)->Arg(100)->Arg(1000)->Arg(10000);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
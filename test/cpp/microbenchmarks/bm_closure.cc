@@ -20,12 +20,15 @@
 
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
+#include <grpc/support/sync.h>
 #include <sstream>
+#include <vector>
 
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/executor.h"
 
 #include "test/core/util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
@@ -387,6 +390,84 @@ static void BM_ClosureReschedOnExecCtx(benchmark::State& state) {
 }
 BENCHMARK(BM_ClosureReschedOnExecCtx);
 
+// A batch of closures run on the default executor; Wait() returns once all of
+// them have run.
+class ExecutorBatch {
+ public:
+  explicit ExecutorBatch(size_t size) : closures_(size), pending_(size) {
+    gpr_event_init(&done_);
+    for (auto& closure : closures_) {
+      GRPC_CLOSURE_INIT(&closure, Step, this, nullptr);
+    }
+    GRPC_CLOSURE_INIT(&fan_out_, FanOut, this, nullptr);
+  }
+
+  // Enqueue every closure from the calling (non executor) thread.
+  void ScheduleFromCaller() {
+    for (auto& closure : closures_) {
+      grpc_core::Executor::Run(&closure, GRPC_ERROR_NONE);
+    }
+  }
+
+  // Enqueue every closure from a single executor thread, so they all land on
+  // that thread's own queue and can only run in parallel by being stolen.
+  void ScheduleFromExecutor() {
+    grpc_core::Executor::Run(&fan_out_, GRPC_ERROR_NONE);
+  }
+
+  void Wait() { gpr_event_wait(&done_, gpr_inf_future(GPR_CLOCK_REALTIME)); }
+
+ private:
+  static void Step(void* arg, grpc_error* /*error*/) {
+    ExecutorBatch* self = static_cast<ExecutorBatch*>(arg);
+    if (self->pending_.FetchSub(1) == 1) {
+      gpr_event_set(&self->done_, reinterpret_cast<void*>(1));
+    }
+  }
+
+  static void FanOut(void* arg, grpc_error* /*error*/) {
+    static_cast<ExecutorBatch*>(arg)->ScheduleFromCaller();
+  }
+
+  std::vector<grpc_closure> closures_;
+  grpc_closure fan_out_;
+  grpc_core::Atomic<size_t> pending_;
+  gpr_event done_;
+};
+
+static void BM_ClosureSchedOnExecutor(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    ExecutorBatch batch(state.range(0));
+    batch.ScheduleFromCaller();
+    batch.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ClosureSchedOnExecutor)
+    ->Arg(1)
+    ->Arg(64)
+    ->Arg(1024)
+    ->ThreadRange(1, 16);
+
+static void BM_ClosureStealOnExecutor(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    ExecutorBatch batch(state.range(0));
+    batch.ScheduleFromExecutor();
+    batch.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ClosureStealOnExecutor)
+    ->Arg(64)
+    ->Arg(1024)
+    ->ThreadRange(1, 16);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
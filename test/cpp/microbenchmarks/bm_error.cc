@@ -63,6 +63,27 @@ static void BM_ErrorCreateAndSetStatus(benchmark::State& state) {
 }
 BENCHMARK(BM_ErrorCreateAndSetStatus);
 
+static void BM_ErrorCreateInline(benchmark::State& state) {
+  TrackCounters track_counters;
+  for (auto _ : state) {
+    GRPC_ERROR_UNREF(
+        GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_DEADLINE_EXCEEDED));
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ErrorCreateInline);
+
+static void BM_ErrorCreateInlineAndSetStatus(benchmark::State& state) {
+  TrackCounters track_counters;
+  for (auto _ : state) {
+    GRPC_ERROR_UNREF(grpc_error_set_int(
+        GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_DEADLINE_EXCEEDED),
+        GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_DEADLINE_EXCEEDED));
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ErrorCreateInlineAndSetStatus);
+
 static void BM_ErrorCreateAndSetIntAndStr(benchmark::State& state) {
   TrackCounters track_counters;
   for (auto _ : state) {
@@ -112,6 +133,17 @@ static void BM_ErrorRefUnref(benchmark::State& state) {
 }
 BENCHMARK(BM_ErrorRefUnref);
 
+static void BM_ErrorRefUnrefInline(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_error* error =
+      GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_DEADLINE_EXCEEDED);
+  for (auto _ : state) {
+    GRPC_ERROR_UNREF(GRPC_ERROR_REF(error));
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ErrorRefUnrefInline);
+
 static void BM_ErrorUnrefNone(benchmark::State& state) {
   TrackCounters track_counters;
   for (auto _ : state) {
@@ -195,6 +227,18 @@ class ErrorWithGrpcStatus {
       GRPC_STATUS_UNIMPLEMENTED)};
 };
 
+class InlineErrorWithGrpcStatus {
+ public:
+  grpc_millis deadline() const { return deadline_; }
+  grpc_error* error() const { return error_.get(); }
+
+ private:
+  const grpc_millis deadline_ = GRPC_MILLIS_INF_FUTURE;
+  ErrorPtr error_{grpc_error_set_int(
+      GRPC_ERROR_CREATE_INLINE(GRPC_ERROR_INLINE_DEADLINE_EXCEEDED),
+      GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_DEADLINE_EXCEEDED)};
+};
+
 class ErrorWithHttpError {
  public:
   grpc_millis deadline() const { return deadline_; }
@@ -295,18 +339,38 @@ static void BM_HasClearGrpcStatus(benchmark::State& state) {
   track_counters.Finish(state);
 }
 
+// What a call pays to fail with a status: create the error, hand out a ref,
+// resolve it to a status and release both refs.
+template <class Fixture>
+static void BM_ErrorPerCallCancel(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    Fixture fixture;
+    grpc_error* error = GRPC_ERROR_REF(fixture.error());
+    grpc_status_code status;
+    grpc_slice slice;
+    grpc_error_get_status(error, fixture.deadline(), &status, &slice, nullptr,
+                          nullptr);
+    GRPC_ERROR_UNREF(error);
+  }
+  track_counters.Finish(state);
+}
+
 #define BENCHMARK_SUITE(fixture)                         \
   BENCHMARK_TEMPLATE(BM_ErrorStringOnNewError, fixture); \
   BENCHMARK_TEMPLATE(BM_ErrorStringRepeatedly, fixture); \
   BENCHMARK_TEMPLATE(BM_ErrorGetStatus, fixture);        \
   BENCHMARK_TEMPLATE(BM_ErrorGetStatusCode, fixture);    \
   BENCHMARK_TEMPLATE(BM_ErrorHttpError, fixture);        \
-  BENCHMARK_TEMPLATE(BM_HasClearGrpcStatus, fixture)
+  BENCHMARK_TEMPLATE(BM_HasClearGrpcStatus, fixture);    \
+  BENCHMARK_TEMPLATE(BM_ErrorPerCallCancel, fixture)
 
 BENCHMARK_SUITE(ErrorNone);
 BENCHMARK_SUITE(ErrorCancelled);
 BENCHMARK_SUITE(SimpleError);
 BENCHMARK_SUITE(ErrorWithGrpcStatus);
+BENCHMARK_SUITE(InlineErrorWithGrpcStatus);
 BENCHMARK_SUITE(ErrorWithHttpError);
 BENCHMARK_SUITE(ErrorWithNestedGrpcStatus);
 
@@ -0,0 +1,129 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark streaming over TLS with records protected in userspace and in the
+   kernel. bytes_per_second is taken over CPU time, so its inverse is the CPU
+   cost per byte for each configuration. */
+
+#include <grpcpp/security/server_credentials.h>
+
+#include "src/core/lib/security/credentials/ssl/ssl_credentials.h"
+#include "src/cpp/client/secure_credentials.h"
+#include "test/core/end2end/data/ssl_test_data.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/fullstack_streaming_pump.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+/*******************************************************************************
+ * FIXTURES
+ */
+
+class TLSConfiguration : public FixtureConfiguration {
+ public:
+  explicit TLSConfiguration(bool kernel_offload)
+      : kernel_offload_(kernel_offload) {}
+
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    c->SetSslTargetNameOverride("foo.test.google.fr");
+    c->SetInt(GRPC_ARG_TLS_KERNEL_OFFLOAD, kernel_offload_);
+    FixtureConfiguration::ApplyCommonChannelArguments(c);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument(GRPC_ARG_TLS_KERNEL_OFFLOAD, kernel_offload_);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+
+ private:
+  const bool kernel_offload_;
+};
+
+/* TLS 1.2 over TCP: kernel offload is only done for TLS 1.2, so the client
+   caps the version for both fixtures to compare like with like. */
+template <bool kKernelOffload>
+class TLS12Fixture : public FullstackFixture {
+ public:
+  TLS12Fixture(Service* service)
+      : FullstackFixture(service, TLSConfiguration(kKernelOffload),
+                         MakeAddress(&port_), MakeServerCredentials(),
+                         MakeChannelCredentials()) {}
+
+  ~TLS12Fixture() override { grpc_recycle_unused_port(port_); }
+
+ private:
+  int port_;
+
+  static std::string MakeAddress(int* port) {
+    *port = grpc_pick_unused_port_or_die();
+    std::stringstream addr;
+    addr << "localhost:" << *port;
+    return addr.str();
+  }
+
+  static std::shared_ptr<ServerCredentials> MakeServerCredentials() {
+    SslServerCredentialsOptions options;
+    options.pem_key_cert_pairs.push_back(
+        {test_server1_key, test_server1_cert});
+    return SslServerCredentials(options);
+  }
+
+  static std::shared_ptr<ChannelCredentials> MakeChannelCredentials() {
+    grpc_channel_credentials* creds =
+        grpc_ssl_credentials_create(test_root_cert, nullptr, nullptr, nullptr);
+    static_cast<grpc_ssl_credentials*>(creds)->set_max_tls_version(
+        grpc_tls_version::TLS1_2);
+    return std::make_shared<SecureChannelCredentials>(creds);
+  }
+};
+
+typedef TLS12Fixture<false> UserspaceTLS12;
+typedef TLS12Fixture<true> KernelTLS12;
+
+/*******************************************************************************
+ * CONFIGURATIONS
+ */
+
+BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, UserspaceTLS12)
+    ->Range(1024, 128 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, KernelTLS12)
+    ->Range(1024, 128 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, UserspaceTLS12)
+    ->Range(1024, 128 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, KernelTLS12)
+    ->Range(1024, 128 * 1024 * 1024);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
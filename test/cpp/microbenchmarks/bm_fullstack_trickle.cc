@@ -20,6 +20,7 @@
 
 #include <benchmark/benchmark.h>
 #include <gflags/gflags.h>
+#include <algorithm>
 #include <fstream>
 
 #include "absl/memory/memory.h"
@@ -81,11 +82,12 @@ static void write_csv(std::ostream* out, A0&& a0, Arg&&... arg) {
 
 class TrickledCHTTP2 : public EndpointPairFixture {
  public:
-  TrickledCHTTP2(Service* service, bool streaming, size_t req_size,
-                 size_t resp_size, size_t kilobits_per_second,
-                 grpc_passthru_endpoint_stats* stats)
+  TrickledCHTTP2(
+      Service* service, bool streaming, size_t req_size, size_t resp_size,
+      size_t kilobits_per_second, grpc_passthru_endpoint_stats* stats,
+      const FixtureConfiguration& config = FixtureConfiguration())
       : EndpointPairFixture(service, MakeEndpoints(kilobits_per_second, stats),
-                            FixtureConfiguration()),
+                            config),
         stats_(stats) {
     if (FLAGS_log) {
       std::ostringstream fn;
@@ -138,12 +140,14 @@ class TrickledCHTTP2 : public EndpointPairFixture {
     grpc_chttp2_transport* server =
         reinterpret_cast<grpc_chttp2_transport*>(server_transport_);
     grpc_chttp2_stream* client_stream =
-        client->stream_map.count == 1
-            ? static_cast<grpc_chttp2_stream*>(client->stream_map.values[0])
+        grpc_chttp2_stream_map_size(&client->stream_map) == 1
+            ? static_cast<grpc_chttp2_stream*>(
+                  grpc_chttp2_stream_map_rand(&client->stream_map))
             : nullptr;
     grpc_chttp2_stream* server_stream =
-        server->stream_map.count == 1
-            ? static_cast<grpc_chttp2_stream*>(server->stream_map.values[0])
+        grpc_chttp2_stream_map_size(&server->stream_map) == 1
+            ? static_cast<grpc_chttp2_stream*>(
+                  grpc_chttp2_stream_map_rand(&server->stream_map))
             : nullptr;
     write_csv(
         log_.get(),
@@ -201,6 +205,14 @@ class TrickledCHTTP2 : public EndpointPairFixture {
       UpdateStats((grpc_chttp2_transport*)server_transport_, &server_stats_,
                   server_backlog);
     }
+    UpdateClientWindowChanges();
+  }
+
+  // Simulated times (in microseconds) at which the initial window announced
+  // by the client changed, with the window it changed to.
+  const std::vector<std::pair<gpr_atm, uint32_t>>& client_window_changes()
+      const {
+    return client_window_changes_;
   }
 
  private:
@@ -213,6 +225,7 @@ class TrickledCHTTP2 : public EndpointPairFixture {
   Stats server_stats_;
   std::unique_ptr<std::ofstream> log_;
   gpr_timespec start_ = gpr_now(GPR_CLOCK_MONOTONIC);
+  std::vector<std::pair<gpr_atm, uint32_t>> client_window_changes_;
 
   static grpc_endpoint_pair MakeEndpoints(size_t kilobits,
                                           grpc_passthru_endpoint_stats* stats) {
@@ -225,6 +238,18 @@ class TrickledCHTTP2 : public EndpointPairFixture {
     return p;
   }
 
+  void UpdateClientWindowChanges() GPR_ATTRIBUTE_NO_TSAN {
+    uint32_t window =
+        reinterpret_cast<grpc_chttp2_transport*>(client_transport_)
+            ->settings[GRPC_LOCAL_SETTINGS]
+                      [GRPC_CHTTP2_SETTINGS_INITIAL_WINDOW_SIZE];
+    if (client_window_changes_.empty() ||
+        client_window_changes_.back().second != window) {
+      client_window_changes_.emplace_back(
+          gpr_atm_no_barrier_load(&g_now_us), window);
+    }
+  }
+
   void UpdateStats(grpc_chttp2_transport* t, Stats* s,
                    size_t backlog) GPR_ATTRIBUTE_NO_TSAN {
     if (backlog == 0) {
@@ -453,6 +478,315 @@ static void UnaryTrickleArgs(benchmark::internal::Benchmark* b) {
   }
 }
 BENCHMARK(BM_PumpUnbalancedUnary_Trickle)->Apply(UnaryTrickleArgs);
+
+class WriteQuantumConfiguration : public FixtureConfiguration {
+ public:
+  explicit WriteQuantumConfiguration(int write_quantum)
+      : write_quantum_(write_quantum) {}
+
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    FixtureConfiguration::ApplyCommonChannelArguments(c);
+    c->SetInt(GRPC_ARG_HTTP2_WRITE_QUANTUM_BYTES, write_quantum_);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+    b->AddChannelArgument(GRPC_ARG_HTTP2_WRITE_QUANTUM_BYTES, write_quantum_);
+  }
+
+ private:
+  const int write_quantum_;
+};
+
+// Latency of small unary calls sharing a connection with a server streaming
+// call that keeps the link saturated. The label reports the median and 99th
+// percentile unary latency in (simulated) microseconds.
+static void BM_UnaryLatencyUnderBulkStream_Trickle(benchmark::State& state) {
+  EchoTestService::AsyncService service;
+  std::unique_ptr<TrickledCHTTP2> fixture(new TrickledCHTTP2(
+      &service, true, 1 /* req_size */, state.range(1) /* resp_size */,
+      state.range(2) /* bw in kbit/s */, grpc_passthru_endpoint_stats_create(),
+      WriteQuantumConfiguration(state.range(0) /* write quantum */)));
+  enum {
+    kBulkStarted = 0,
+    kBulkConnected,
+    kBulkRead,
+    kBulkWrite,
+    kUnaryRequested,
+    kUnaryResponded,
+    kUnaryDone,
+  };
+  EchoResponse bulk_response;
+  bulk_response.set_message(std::string(state.range(1), 'a'));
+  EchoResponse bulk_recv;
+  ServerContext bulk_svr_ctx;
+  ServerAsyncReaderWriter<EchoResponse, EchoRequest> bulk_response_rw(
+      &bulk_svr_ctx);
+  service.RequestBidiStream(&bulk_svr_ctx, &bulk_response_rw, fixture->cq(),
+                            fixture->cq(), tag(kBulkStarted));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  ClientContext bulk_cli_ctx;
+  auto bulk_request_rw =
+      stub->AsyncBidiStream(&bulk_cli_ctx, fixture->cq(), tag(kBulkConnected));
+  void* t;
+  bool ok;
+  for (int need_tags = (1 << kBulkStarted) | (1 << kBulkConnected);
+       need_tags != 0;) {
+    TrickleCQNext(fixture.get(), &t, &ok, -1);
+    GPR_ASSERT(ok);
+    need_tags &= ~(1 << reinterpret_cast<intptr_t>(t));
+  }
+  // the bulk stream always has a read and a write outstanding
+  bulk_request_rw->Read(&bulk_recv, tag(kBulkRead));
+  bulk_response_rw.Write(bulk_response, tag(kBulkWrite));
+
+  EchoRequest send_request;
+  send_request.set_message("a");
+  EchoResponse send_response;
+  send_response.set_message("a");
+  struct ServerEnv {
+    ServerContext ctx;
+    EchoRequest recv_request;
+    grpc::ServerAsyncResponseWriter<EchoResponse> response_writer;
+    ServerEnv() : response_writer(&ctx) {}
+  };
+  std::unique_ptr<ServerEnv> server_env(new ServerEnv);
+  service.RequestEcho(&server_env->ctx, &server_env->recv_request,
+                      &server_env->response_writer, fixture->cq(),
+                      fixture->cq(), tag(kUnaryRequested));
+  // Drives the bulk stream until the unary call in flight completes.
+  auto dispatch = [&](int64_t iteration) {
+    for (int need_tags = (1 << kUnaryResponded) | (1 << kUnaryDone);
+         need_tags != 0;) {
+      TrickleCQNext(fixture.get(), &t, &ok, iteration);
+      switch (reinterpret_cast<intptr_t>(t)) {
+        case kBulkRead:
+          GPR_ASSERT(ok);
+          bulk_request_rw->Read(&bulk_recv, tag(kBulkRead));
+          break;
+        case kBulkWrite:
+          GPR_ASSERT(ok);
+          bulk_response_rw.Write(bulk_response, tag(kBulkWrite));
+          break;
+        case kUnaryRequested:
+          GPR_ASSERT(ok);
+          server_env->response_writer.Finish(send_response, Status::OK,
+                                             tag(kUnaryResponded));
+          break;
+        case kUnaryResponded:
+        case kUnaryDone:
+          GPR_ASSERT(ok);
+          need_tags &= ~(1 << reinterpret_cast<intptr_t>(t));
+          break;
+        default:
+          GPR_ASSERT(false);
+      }
+    }
+  };
+  std::vector<int64_t> latencies_us;
+  auto inner_loop = [&](bool in_warmup) {
+    GPR_TIMER_SCOPE("BenchmarkCycle", 0);
+    EchoResponse recv_response;
+    Status recv_status;
+    ClientContext cli_ctx;
+    const gpr_atm start_us = gpr_atm_no_barrier_load(&g_now_us);
+    std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> response_reader(
+        stub->AsyncEcho(&cli_ctx, send_request, fixture->cq()));
+    response_reader->Finish(&recv_response, &recv_status, tag(kUnaryDone));
+    dispatch(in_warmup ? -1 : state.iterations());
+    GPR_ASSERT(recv_status.ok());
+    if (!in_warmup) {
+      latencies_us.push_back(gpr_atm_no_barrier_load(&g_now_us) - start_us);
+    }
+    server_env.reset(new ServerEnv);
+    service.RequestEcho(&server_env->ctx, &server_env->recv_request,
+                        &server_env->response_writer, fixture->cq(),
+                        fixture->cq(), tag(kUnaryRequested));
+  };
+  for (int i = 0; i < FLAGS_warmup_iterations; i++) {
+    inner_loop(true);
+  }
+  while (state.KeepRunning()) {
+    inner_loop(false);
+  }
+
+  // wind down the bulk stream: let its last write finish, then close it
+  for (bool write_pending = true; write_pending;) {
+    TrickleCQNext(fixture.get(), &t, &ok, -1);
+    if (t == tag(kBulkRead) && ok) {
+      bulk_request_rw->Read(&bulk_recv, tag(kBulkRead));
+    } else if (t == tag(kBulkWrite)) {
+      write_pending = false;
+    }
+  }
+  bulk_response_rw.Finish(Status::OK, tag(kBulkWrite));
+  Status bulk_status;
+  bulk_request_rw->Finish(&bulk_status, tag(kBulkConnected));
+  for (int need_tags = (1 << kBulkRead) | (1 << kBulkWrite) |
+                       (1 << kBulkConnected);
+       need_tags != 0;) {
+    TrickleCQNext(fixture.get(), &t, &ok, -1);
+    if (t == tag(kBulkRead) && ok) {
+      bulk_request_rw->Read(&bulk_recv, tag(kBulkRead));
+      continue;
+    }
+    int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+    GPR_ASSERT(need_tags & (1 << i));
+    need_tags &= ~(1 << i);
+  }
+
+  if (!latencies_us.empty()) {
+    std::sort(latencies_us.begin(), latencies_us.end());
+    std::ostringstream label;
+    label << "unary_p50_us:" << latencies_us[latencies_us.size() / 2]
+          << " unary_p99_us:" << latencies_us[latencies_us.size() * 99 / 100];
+    fixture->AddLabel(label.str());
+  }
+  fixture->Finish(state);
+  fixture.reset();
+  server_env.reset();
+  state.SetBytesProcessed(state.range(1) * state.iterations());
+}
+
+static void UnaryLatencyUnderBulkStreamArgs(
+    benchmark::internal::Benchmark* b) {
+  for (int bw = 1024; bw <= 64 * 1024; bw *= 8) {
+    for (int bulk = 64 * 1024; bulk <= 1024 * 1024; bulk *= 16) {
+      b->Args({0, bulk, bw});
+      b->Args({16 * 1024, bulk, bw});
+    }
+  }
+}
+BENCHMARK(BM_UnaryLatencyUnderBulkStream_Trickle)
+    ->Apply(UnaryLatencyUnderBulkStreamArgs);
+
+class AutotuningConfiguration : public FixtureConfiguration {
+ public:
+  explicit AutotuningConfiguration(bool delivery_rate)
+      : delivery_rate_(delivery_rate) {}
+
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    FixtureConfiguration::ApplyCommonChannelArguments(c);
+    c->SetInt(GRPC_ARG_HTTP2_DELIVERY_RATE_AUTOTUNING, delivery_rate_);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+    b->AddChannelArgument(GRPC_ARG_HTTP2_DELIVERY_RATE_AUTOTUNING,
+                          delivery_rate_);
+  }
+
+ private:
+  const bool delivery_rate_;
+};
+
+// Pumps messages from server to client over a fresh connection, with either
+// flow control autotuning mode. The label reports how long (in simulated
+// time) the window announced by the client takes to settle within 25% of
+// where it ends up, that final window, and the throughput over the second
+// half of the run.
+static void BM_FlowControlConvergence_Trickle(benchmark::State& state) {
+  const int kMessageSize = 16 * 1024;
+  EchoTestService::AsyncService service;
+  const gpr_atm start_us = gpr_atm_no_barrier_load(&g_now_us);
+  std::unique_ptr<TrickledCHTTP2> fixture(new TrickledCHTTP2(
+      &service, true, kMessageSize /* req_size */,
+      kMessageSize /* resp_size */, state.range(1) /* bw in kbit/s */,
+      grpc_passthru_endpoint_stats_create(),
+      AutotuningConfiguration(state.range(0) != 0 /* delivery rate */)));
+  std::vector<gpr_atm> completion_us;
+  {
+    EchoResponse send_response;
+    EchoResponse recv_response;
+    send_response.set_message(std::string(kMessageSize, 'a'));
+    ServerContext svr_ctx;
+    ServerAsyncReaderWriter<EchoResponse, EchoRequest> response_rw(&svr_ctx);
+    service.RequestBidiStream(&svr_ctx, &response_rw, fixture->cq(),
+                              fixture->cq(), tag(0));
+    std::unique_ptr<EchoTestService::Stub> stub(
+        EchoTestService::NewStub(fixture->channel()));
+    ClientContext cli_ctx;
+    auto request_rw = stub->AsyncBidiStream(&cli_ctx, fixture->cq(), tag(1));
+    int need_tags = (1 << 0) | (1 << 1);
+    void* t;
+    bool ok;
+    while (need_tags) {
+      TrickleCQNext(fixture.get(), &t, &ok, -1);
+      GPR_ASSERT(ok);
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      GPR_ASSERT(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+    request_rw->Read(&recv_response, tag(0));
+    while (state.KeepRunning()) {
+      GPR_TIMER_SCOPE("BenchmarkCycle", 0);
+      response_rw.Write(send_response, tag(1));
+      while (true) {
+        TrickleCQNext(fixture.get(), &t, &ok, state.iterations());
+        if (t == tag(0)) {
+          request_rw->Read(&recv_response, tag(0));
+        } else if (t == tag(1)) {
+          break;
+        } else {
+          GPR_ASSERT(false);
+        }
+      }
+      completion_us.push_back(gpr_atm_no_barrier_load(&g_now_us));
+    }
+    response_rw.Finish(Status::OK, tag(1));
+    grpc::Status status;
+    request_rw->Finish(&status, tag(2));
+    need_tags = (1 << 0) | (1 << 1) | (1 << 2);
+    while (need_tags) {
+      TrickleCQNext(fixture.get(), &t, &ok, -1);
+      if (t == tag(0) && ok) {
+        request_rw->Read(&recv_response, tag(0));
+        continue;
+      }
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      GPR_ASSERT(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+  }
+
+  const auto& changes = fixture->client_window_changes();
+  if (!changes.empty() && completion_us.size() >= 4) {
+    // the window has converged from the first change after which it stays
+    // within 25% of its final value
+    const double final_window = changes.back().second;
+    size_t settled = changes.size() - 1;
+    while (settled > 0 && changes[settled - 1].second >= final_window / 1.25 &&
+           changes[settled - 1].second <= final_window * 1.25) {
+      settled--;
+    }
+    const size_t half = completion_us.size() / 2;
+    const double steady_seconds =
+        1e-6 * static_cast<double>(completion_us.back() - completion_us[half]);
+    const double steady_bytes = static_cast<double>(kMessageSize) *
+                                static_cast<double>(completion_us.size() - 1 -
+                                                    half);
+    std::ostringstream label;
+    label << "converge_ms:"
+          << 1e-3 * static_cast<double>(changes[settled].first - start_us)
+          << " final_window:" << changes.back().second << " steady_kbps:"
+          << (steady_seconds > 0 ? steady_bytes * 8 / 1000 / steady_seconds
+                                 : 0);
+    fixture->AddLabel(label.str());
+  }
+  fixture->Finish(state);
+  fixture.reset();
+  state.SetBytesProcessed(kMessageSize * state.iterations());
+}
+
+static void FlowControlConvergenceArgs(benchmark::internal::Benchmark* b) {
+  for (int bw = 1024; bw <= 128 * 1024; bw *= 8) {
+    b->Args({0, bw});
+    b->Args({1, bw});
+  }
+}
+BENCHMARK(BM_FlowControlConvergence_Trickle)
+    ->Apply(FlowControlConvergenceArgs);
 }  // namespace testing
 }  // namespace grpc
 
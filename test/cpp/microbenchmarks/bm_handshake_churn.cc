@@ -0,0 +1,144 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark unary calls over an established TLS connection while other
+   clients keep connecting to the same server, with the server running the
+   TLS handshakes on its pollers or on the handshake thread pool. The p50_us
+   and p99_us counters are the latencies of the established connection. */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "include/grpc/grpc.h"
+#include "include/grpcpp/grpcpp.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/end2end/data/ssl_test_data.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+static const char* kServerName = "foo.test.google.fr";
+
+class EchoServer final : public grpc::testing::EchoTestService::Service {
+  grpc::Status Echo(grpc::ServerContext* /*context*/,
+                    const grpc::testing::EchoRequest* request,
+                    grpc::testing::EchoResponse* response) override {
+    response->set_message(request->message());
+    return grpc::Status::OK;
+  }
+};
+
+static std::shared_ptr<grpc::Channel> CreateTlsChannel(
+    const std::string& address, grpc::ChannelArguments args) {
+  grpc::SslCredentialsOptions options;
+  options.pem_root_certs = test_root_cert;
+  args.SetSslTargetNameOverride(kServerName);
+  return grpc::CreateCustomChannel(address, grpc::SslCredentials(options),
+                                   args);
+}
+
+// Args: whether the server uses the handshake thread pool, and the number of
+// threads connecting over and over again.
+static void BM_EstablishedCallsUnderHandshakeChurn(benchmark::State& state) {
+  TrackCounters track_counters;
+  const std::string address =
+      absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+  EchoServer service;
+  grpc::SslServerCredentialsOptions server_options;
+  server_options.pem_key_cert_pairs.push_back(
+      {test_server1_key, test_server1_cert});
+  grpc::ServerBuilder builder;
+  builder.AddListeningPort(address,
+                           grpc::SslServerCredentials(server_options));
+  builder.AddChannelArgument(GRPC_ARG_SECURITY_HANDSHAKE_THREAD_POOL,
+                             static_cast<int>(state.range(0)));
+  builder.RegisterService(&service);
+  std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+
+  std::unique_ptr<grpc::testing::EchoTestService::Stub> stub =
+      grpc::testing::EchoTestService::NewStub(
+          CreateTlsChannel(address, grpc::ChannelArguments()));
+  grpc::testing::EchoRequest request;
+  grpc::testing::EchoResponse response;
+  request.set_message("ping");
+  {
+    grpc::ClientContext context;
+    GPR_ASSERT(stub->Echo(&context, request, &response).ok());
+  }
+
+  std::atomic<bool> done{false};
+  std::vector<std::thread> churners;
+  for (int64_t i = 0; i < state.range(1); i++) {
+    churners.emplace_back([&address, &done] {
+      while (!done.load(std::memory_order_relaxed)) {
+        // A local subchannel pool gets every channel its own connection.
+        grpc::ChannelArguments args;
+        args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+        std::shared_ptr<grpc::Channel> channel =
+            CreateTlsChannel(address, args);
+        channel->WaitForConnected(grpc_timeout_seconds_to_deadline(5));
+      }
+    });
+  }
+
+  std::vector<double> latencies_us;
+  for (auto _ : state) {
+    grpc::ClientContext context;
+    gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+    GPR_ASSERT(stub->Echo(&context, request, &response).ok());
+    latencies_us.push_back(gpr_timespec_to_micros(
+        gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start)));
+  }
+  done.store(true, std::memory_order_relaxed);
+  for (std::thread& churner : churners) churner.join();
+  server->Shutdown();
+
+  std::sort(latencies_us.begin(), latencies_us.end());
+  if (!latencies_us.empty()) {
+    state.counters["p50_us"] = latencies_us[latencies_us.size() / 2];
+    state.counters["p99_us"] = latencies_us[latencies_us.size() * 99 / 100];
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_EstablishedCallsUnderHandshakeChurn)
+    ->Args({0, 0})
+    ->Args({1, 0})
+    ->Args({0, 8})
+    ->Args({1, 8})
+    ->UseRealTime();
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
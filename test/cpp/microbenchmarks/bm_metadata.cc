@@ -69,6 +69,21 @@ static void BM_SliceReIntern(benchmark::State& state) {
 }
 BENCHMARK(BM_SliceReIntern);
 
+// Every thread re-interns the same already-interned string, so all lookups
+// land in one shard of the intern table and hit.
+static void BM_SliceReInternMultiThreaded(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExternallyManagedSlice static_slice("abc");
+  grpc_core::ManagedMemorySlice slice(&static_slice);
+  for (auto _ : state) {
+    grpc_slice_unref(grpc_core::ManagedMemorySlice(&slice));
+  }
+  grpc_slice_unref(slice);
+  state.SetItemsProcessed(state.iterations());
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_SliceReInternMultiThreaded)->ThreadRange(1, 16)->UseRealTime();
+
 static void BM_SliceInternStaticMetadata(benchmark::State& state) {
   TrackCounters track_counters;
   for (auto _ : state) {
@@ -134,6 +149,29 @@ static void BM_MetadataFromInternedSlicesAlreadyInIndex(
 }
 BENCHMARK(BM_MetadataFromInternedSlicesAlreadyInIndex);
 
+// Every thread creates the same mdelem while a seed reference keeps it in
+// the index, so all lookups land in one shard of the mdelem table and hit.
+static void BM_MetadataFromInternedSlicesAlreadyInIndexMultiThreaded(
+    benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ManagedMemorySlice k("key");
+  grpc_core::ManagedMemorySlice v("value");
+  grpc_core::ExecCtx exec_ctx;
+  grpc_mdelem seed = grpc_mdelem_create(k, v, nullptr);
+  for (auto _ : state) {
+    GRPC_MDELEM_UNREF(grpc_mdelem_create(k, v, nullptr));
+  }
+  GRPC_MDELEM_UNREF(seed);
+
+  grpc_slice_unref(k);
+  grpc_slice_unref(v);
+  state.SetItemsProcessed(state.iterations());
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_MetadataFromInternedSlicesAlreadyInIndexMultiThreaded)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
 static void BM_MetadataFromInternedKey(benchmark::State& state) {
   TrackCounters track_counters;
   grpc_core::ManagedMemorySlice k("key");
@@ -0,0 +1,164 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark a storm of clients reconnecting to an SSL server, with and without
+   session resumption. items_per_second is the number of handshakes per
+   second. */
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include <grpc/support/log.h>
+
+#include "src/core/tsi/ssl_transport_security.h"
+#include "src/core/tsi/transport_security.h"
+#include "test/core/end2end/data/ssl_test_data.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+static const char* kServerName = "foo.test.google.fr";
+
+/* Feeds the bytes received from the peer to the handshaker and appends what
+   it has to send back to *to_send. */
+static void HandshakerNext(tsi_handshaker* handshaker, std::string* received,
+                           std::string* to_send,
+                           tsi_handshaker_result** result) {
+  const unsigned char* bytes_to_send = nullptr;
+  size_t bytes_to_send_size = 0;
+  GPR_ASSERT(tsi_handshaker_next(
+                 handshaker,
+                 reinterpret_cast<const unsigned char*>(received->data()),
+                 received->size(), &bytes_to_send, &bytes_to_send_size, result,
+                 nullptr, nullptr) == TSI_OK);
+  received->clear();
+  to_send->append(reinterpret_cast<const char*>(bytes_to_send),
+                  bytes_to_send_size);
+}
+
+/* Runs the records that followed the handshake through the client, which is
+   where TLS 1.3 clients pick up their session tickets. */
+static void ClientUnprotect(tsi_handshaker_result* result,
+                            std::string* received) {
+  const unsigned char* unused_bytes = nullptr;
+  size_t unused_bytes_size = 0;
+  GPR_ASSERT(tsi_handshaker_result_get_unused_bytes(
+                 result, &unused_bytes, &unused_bytes_size) == TSI_OK);
+  received->insert(0, reinterpret_cast<const char*>(unused_bytes),
+                   unused_bytes_size);
+  tsi_frame_protector* protector = nullptr;
+  GPR_ASSERT(tsi_handshaker_result_create_frame_protector(
+                 result, nullptr, &protector) == TSI_OK);
+  unsigned char buffer[4096];
+  size_t offset = 0;
+  while (offset < received->size()) {
+    size_t size = received->size() - offset;
+    size_t buffer_size = sizeof(buffer);
+    GPR_ASSERT(tsi_frame_protector_unprotect(
+                   protector,
+                   reinterpret_cast<const unsigned char*>(received->data()) +
+                       offset,
+                   &size, buffer, &buffer_size) == TSI_OK);
+    offset += size;
+  }
+  tsi_frame_protector_destroy(protector);
+}
+
+static bool SessionReused(tsi_handshaker_result* result) {
+  tsi_peer peer;
+  GPR_ASSERT(tsi_handshaker_result_extract_peer(result, &peer) == TSI_OK);
+  const tsi_peer_property* reused = tsi_peer_get_property_by_name(
+      &peer, TSI_SSL_SESSION_REUSED_PEER_PROPERTY);
+  GPR_ASSERT(reused != nullptr);
+  bool session_reused =
+      std::string(reused->value.data, reused->value.length) == "true";
+  tsi_peer_destruct(&peer);
+  return session_reused;
+}
+
+static void BM_SslHandshake(benchmark::State& state) {
+  TrackCounters track_counters;
+  const bool resumption = state.range(0) != 0;
+  tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(1);
+  tsi_ssl_client_handshaker_options client_options;
+  client_options.pem_root_certs = test_root_cert;
+  client_options.session_cache = resumption ? session_cache : nullptr;
+  tsi_ssl_client_handshaker_factory* client_factory = nullptr;
+  GPR_ASSERT(tsi_create_ssl_client_handshaker_factory_with_options(
+                 &client_options, &client_factory) == TSI_OK);
+  tsi_ssl_pem_key_cert_pair key_cert_pair = {test_server1_key,
+                                             test_server1_cert};
+  tsi_ssl_server_handshaker_options server_options;
+  server_options.pem_key_cert_pairs = &key_cert_pair;
+  server_options.num_key_cert_pairs = 1;
+  server_options.disable_session_resumption = !resumption;
+  tsi_ssl_server_handshaker_factory* server_factory = nullptr;
+  GPR_ASSERT(tsi_create_ssl_server_handshaker_factory_with_options(
+                 &server_options, &server_factory) == TSI_OK);
+  int64_t resumed = 0;
+  for (auto _ : state) {
+    tsi_handshaker* client = nullptr;
+    tsi_handshaker* server = nullptr;
+    GPR_ASSERT(tsi_ssl_client_handshaker_factory_create_handshaker(
+                   client_factory, kServerName, &client) == TSI_OK);
+    GPR_ASSERT(tsi_ssl_server_handshaker_factory_create_handshaker(
+                   server_factory, &server) == TSI_OK);
+    std::string to_server;
+    std::string to_client;
+    tsi_handshaker_result* client_result = nullptr;
+    tsi_handshaker_result* server_result = nullptr;
+    HandshakerNext(client, &to_client, &to_server, &client_result);
+    while (client_result == nullptr || server_result == nullptr) {
+      if (server_result == nullptr) {
+        HandshakerNext(server, &to_server, &to_client, &server_result);
+      }
+      if (client_result == nullptr) {
+        HandshakerNext(client, &to_client, &to_server, &client_result);
+      }
+    }
+    ClientUnprotect(client_result, &to_client);
+    if (SessionReused(server_result)) resumed++;
+    tsi_handshaker_result_destroy(client_result);
+    tsi_handshaker_result_destroy(server_result);
+    tsi_handshaker_destroy(client);
+    tsi_handshaker_destroy(server);
+  }
+  /* All but the first handshake are expected to resume. */
+  GPR_ASSERT(!resumption || resumed + 1 >= state.iterations());
+  tsi_ssl_server_handshaker_factory_unref(server_factory);
+  tsi_ssl_client_handshaker_factory_unref(client_factory);
+  tsi_ssl_session_cache_unref(session_cache);
+  state.SetItemsProcessed(state.iterations());
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_SslHandshake)->Arg(0)->Arg(1);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -57,6 +57,18 @@ class BlockingCounter {
   std::condition_variable cv_;
 };
 
+// Arguments are number of iterations (num_iterations), thread pool size
+// (num_threads) and the closure queue used by the pool (0 for InfLenFIFOQueue,
+// 1 for LockFreeBoundedQueue).
+static void PoolArgs(benchmark::internal::Benchmark* b) {
+  b->Ranges({{524288, 524288}, {1, 1024}, {0, 1}});
+}
+
+static grpc_core::ThreadPool::QueueType QueueTypeArg(int64_t arg) {
+  return arg == 0 ? grpc_core::ThreadPool::QueueType::kInfiniteLength
+                  : grpc_core::ThreadPool::QueueType::kLockFreeBounded;
+}
+
 // This is a functor/closure class for threadpool microbenchmark.
 // This functor (closure) class will add another functor into pool if the
 // number passed in (num_add) is greater than 0. Otherwise, it will decrement
@@ -98,7 +110,9 @@ static void ThreadPoolAddAnother(benchmark::State& state) {
   const int num_threads = state.range(1);
   // Number of adds done by each closure.
   const int num_add = num_iterations / kConcurrentFunctor;
-  grpc_core::ThreadPool pool(num_threads);
+  grpc_core::ThreadPool pool(num_threads, "ThreadPoolWorker",
+                             grpc_core::Thread::Options(),
+                             QueueTypeArg(state.range(2)));
   while (state.KeepRunningBatch(num_iterations)) {
     BlockingCounter counter(kConcurrentFunctor);
     for (int i = 0; i < kConcurrentFunctor; ++i) {
@@ -109,23 +123,15 @@ static void ThreadPoolAddAnother(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations());
 }
 
-// First pair of arguments is range for number of iterations (num_iterations).
-// Second pair of arguments is range for thread pool size (num_threads).
-BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 1)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 4)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 8)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 16)
-    ->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 32)
-    ->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 64)
-    ->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 128)
-    ->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 512)
-    ->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 2048)
-    ->RangePair(524288, 524288, 1, 1024);
+BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 1)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 4)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 8)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 16)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 32)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 64)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 128)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 512)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddAnother, 2048)->Apply(PoolArgs);
 
 // A functor class that will delete self on end of running.
 class SuicideFunctorForAdd : public grpc_experimental_completion_queue_functor {
@@ -154,7 +160,9 @@ static void BM_ThreadPoolExternalAdd(benchmark::State& state) {
   // Setup for each run of test.
   if (state.thread_index == 0) {
     const int num_threads = state.range(1);
-    external_add_pool = new grpc_core::ThreadPool(num_threads);
+    external_add_pool = new grpc_core::ThreadPool(
+        num_threads, "ThreadPoolWorker", grpc_core::Thread::Options(),
+        QueueTypeArg(state.range(2)));
   }
   const int num_iterations = state.range(0) / state.threads;
   while (state.KeepRunningBatch(num_iterations)) {
@@ -172,9 +180,7 @@ static void BM_ThreadPoolExternalAdd(benchmark::State& state) {
   }
 }
 BENCHMARK(BM_ThreadPoolExternalAdd)
-    // First pair is range for number of iterations (num_iterations).
-    // Second pair is range for thread pool size (num_threads).
-    ->RangePair(524288, 524288, 1, 1024)
+    ->Apply(PoolArgs)
     ->ThreadRange(1, 256);  // Concurrent external thread(s) up to 256
 
 // Functor (closure) that adds itself into pool repeatedly. By adding self, the
@@ -214,7 +220,9 @@ static void ThreadPoolAddSelf(benchmark::State& state) {
   const int num_threads = state.range(1);
   // Number of adds done by each closure.
   const int num_add = num_iterations / kConcurrentFunctor;
-  grpc_core::ThreadPool pool(num_threads);
+  grpc_core::ThreadPool pool(num_threads, "ThreadPoolWorker",
+                             grpc_core::Thread::Options(),
+                             QueueTypeArg(state.range(2)));
   while (state.KeepRunningBatch(num_iterations)) {
     BlockingCounter counter(kConcurrentFunctor);
     for (int i = 0; i < kConcurrentFunctor; ++i) {
@@ -225,17 +233,15 @@ static void ThreadPoolAddSelf(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations());
 }
 
-// First pair of arguments is range for number of iterations (num_iterations).
-// Second pair of arguments is range for thread pool size (num_threads).
-BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 1)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 4)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 8)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 16)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 32)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 64)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 128)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 512)->RangePair(524288, 524288, 1, 1024);
-BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 2048)->RangePair(524288, 524288, 1, 1024);
+BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 1)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 4)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 8)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 16)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 32)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 64)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 128)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 512)->Apply(PoolArgs);
+BENCHMARK_TEMPLATE(ThreadPoolAddSelf, 2048)->Apply(PoolArgs);
 
 #if defined(__GNUC__) && !defined(SWIG)
 #if defined(__i386__) || defined(__x86_64__)
@@ -296,7 +302,9 @@ static void BM_SpikyLoad(benchmark::State& state) {
   const int kNumSpikes = 1000;
   const int batch_size = 3 * num_threads;
   std::vector<ShortWorkFunctorForAdd> work_vector(batch_size);
-  grpc_core::ThreadPool pool(num_threads);
+  grpc_core::ThreadPool pool(num_threads, "ThreadPoolWorker",
+                             grpc_core::Thread::Options(),
+                             QueueTypeArg(state.range(1)));
   while (state.KeepRunningBatch(kNumSpikes * batch_size)) {
     for (int i = 0; i != kNumSpikes; ++i) {
       BlockingCounter counter(batch_size);
@@ -309,7 +317,9 @@ static void BM_SpikyLoad(benchmark::State& state) {
   }
   state.SetItemsProcessed(state.iterations() * batch_size);
 }
-BENCHMARK(BM_SpikyLoad)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16);
+// First argument is thread pool size (num_threads), second one the closure
+// queue used by the pool.
+BENCHMARK(BM_SpikyLoad)->RangeMultiplier(2)->Ranges({{1, 16}, {0, 1}});
 
 }  // namespace testing
 }  // namespace grpc
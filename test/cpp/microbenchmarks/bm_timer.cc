@@ -26,10 +26,13 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/iomgr/timer.h"
+#include "src/core/lib/iomgr/timer_wheel.h"
 #include "test/core/util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
 
+extern grpc_timer_vtable grpc_generic_timer_vtable;
+
 namespace grpc {
 namespace testing {
 
@@ -100,6 +103,78 @@ BENCHMARK(BM_TimerBatch)
     ->Args({/*check=*/true, /*reverse=*/true})
     ->ThreadRange(1, 128);
 
+// Timer implementations compared by the benchmarks below. Each has its own
+// global state, so the one not selected by grpc_init is initialized
+// separately in main() and driven directly through its vtable.
+static grpc_timer_vtable* const kTimerImpls[] = {&grpc_generic_timer_vtable,
+                                                 &grpc_wheel_timer_vtable};
+
+static grpc_timer_vtable* InactiveTimerImpl() {
+  return GPR_GLOBAL_CONFIG_GET(grpc_experimental_timer_wheel)
+             ? &grpc_generic_timer_vtable
+             : &grpc_wheel_timer_vtable;
+}
+
+// Adds and cancels one timer while 'pending' other timers, with deadlines
+// spread over the next ten seconds, are outstanding.
+static void AddCancelWithPending(benchmark::State& state,
+                                 grpc_timer_vtable* impl, int pending) {
+  constexpr int kDeadlineSpreadMs = 10000;
+  grpc_core::ExecCtx exec_ctx;
+  const grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  std::vector<TimerClosure> timer_closures(pending + 1);
+  for (auto& timer_closure : timer_closures) {
+    GRPC_CLOSURE_INIT(
+        &timer_closure.closure, [](void* /*args*/, grpc_error* /*err*/) {},
+        nullptr, grpc_schedule_on_exec_ctx);
+  }
+  for (int i = 0; i < pending; i++) {
+    impl->init(&timer_closures[i].timer,
+               now + 1000 + (i * 7919) % kDeadlineSpreadMs,
+               &timer_closures[i].closure);
+  }
+  TimerClosure* timer_closure = &timer_closures[pending];
+  int iteration = 0;
+  for (auto _ : state) {
+    impl->init(&timer_closure->timer,
+               now + 1000 + (iteration++ * 7919) % kDeadlineSpreadMs,
+               &timer_closure->closure);
+    impl->cancel(&timer_closure->timer);
+    exec_ctx.Flush();
+  }
+  for (int i = 0; i < pending; i++) {
+    impl->cancel(&timer_closures[i].timer);
+  }
+  exec_ctx.Flush();
+}
+
+static void BM_TimerAddCancel(benchmark::State& state) {
+  TrackCounters track_counters;
+  AddCancelWithPending(state, kTimerImpls[state.range(0)], state.range(1));
+  track_counters.Finish(state);
+}
+static void AddCancelArgs(benchmark::internal::Benchmark* b) {
+  for (int wheel = 0; wheel <= 1; wheel++) {
+    for (int pending = 1 << 10; pending <= 1 << 17; pending *= 8) {
+      // First argument selects the timer implementation (0: heap, 1: wheel)
+      // Second argument is the number of outstanding timers
+      b->Args({wheel, pending});
+    }
+  }
+}
+BENCHMARK(BM_TimerAddCancel)->Apply(AddCancelArgs);
+
+static void BM_TimerAddCancelThreaded(benchmark::State& state) {
+  TrackCounters track_counters;
+  AddCancelWithPending(state, kTimerImpls[state.range(0)],
+                       state.range(1) / state.threads);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_TimerAddCancelThreaded)
+    ->Args({/*wheel=*/false, /*pending=*/1 << 17})
+    ->Args({/*wheel=*/true, /*pending=*/1 << 17})
+    ->ThreadRange(1, 64);
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -114,6 +189,14 @@ int main(int argc, char** argv) {
   LibraryInitializer libInit;
   ::benchmark::Initialize(&argc, argv);
   ::grpc::testing::InitTest(&argc, &argv, false);
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc::testing::InactiveTimerImpl()->list_init();
+  }
   benchmark::RunTheBenchmarksNamespaced();
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc::testing::InactiveTimerImpl()->list_shutdown();
+  }
   return 0;
 }
@@ -59,11 +59,15 @@ static void ApplyCommonChannelArguments(ChannelArguments* c) {
 
 class EndpointPairFixture {
  public:
-  EndpointPairFixture(Service* service, grpc_endpoint_pair endpoints) {
+  EndpointPairFixture(Service* service, grpc_endpoint_pair endpoints,
+                      int write_cork_us = 0) {
     ServerBuilder b;
     cq_ = b.AddCompletionQueue(true);
     b.RegisterService(service);
     ApplyCommonServerBuilderConfig(&b);
+    if (write_cork_us != 0) {
+      b.AddChannelArgument(GRPC_ARG_HTTP2_WRITE_CORK_US, write_cork_us);
+    }
     server_ = b.BuildAndStart();
 
     grpc_core::ExecCtx exec_ctx;
@@ -90,6 +94,9 @@ class EndpointPairFixture {
       ChannelArguments args;
       args.SetString(GRPC_ARG_DEFAULT_AUTHORITY, "test.authority");
       ApplyCommonChannelArguments(&args);
+      if (write_cork_us != 0) {
+        args.SetInt(GRPC_ARG_HTTP2_WRITE_CORK_US, write_cork_us);
+      }
 
       grpc_channel_args c_args = args.c_channel_args();
       grpc_transport* transport =
@@ -126,8 +133,10 @@ class EndpointPairFixture {
 
 class InProcessCHTTP2 : public EndpointPairFixture {
  public:
-  InProcessCHTTP2(Service* service, grpc_passthru_endpoint_stats* stats)
-      : EndpointPairFixture(service, MakeEndpoints(stats)), stats_(stats) {}
+  InProcessCHTTP2(Service* service, grpc_passthru_endpoint_stats* stats,
+                  int write_cork_us = 0)
+      : EndpointPairFixture(service, MakeEndpoints(stats), write_cork_us),
+        stats_(stats) {}
 
   ~InProcessCHTTP2() override {
     if (stats_ != nullptr) {
@@ -224,6 +233,96 @@ static double UnaryPingPong(int request_size, int response_size) {
   return writes_per_iteration;
 }
 
+struct PipelinedResult {
+  double writes_per_rpc;
+  double mean_batch_latency_us;
+};
+
+// Issues batches of kDepth concurrent unary calls, each answered by the
+// server as soon as it arrives, so that the transport has many small frames
+// to write in quick succession.
+static PipelinedResult PipelinedUnary(int write_cork_us) {
+  const int kDepth = 16;
+  const int kBatches = 1000;
+
+  EchoTestService::AsyncService service;
+  std::unique_ptr<InProcessCHTTP2> fixture(new InProcessCHTTP2(
+      &service, grpc_passthru_endpoint_stats_create(), write_cork_us));
+  EchoRequest send_request;
+  EchoResponse send_response;
+  send_request.set_message(std::string(64, 'a'));
+  send_response.set_message(std::string(64, 'a'));
+  struct ServerEnv {
+    ServerContext ctx;
+    EchoRequest recv_request;
+    grpc::ServerAsyncResponseWriter<EchoResponse> response_writer;
+    ServerEnv() : response_writer(&ctx) {}
+  };
+  struct ClientEnv {
+    ClientContext ctx;
+    EchoResponse recv_response;
+    Status recv_status;
+    std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> response_reader;
+  };
+  // Tags 0..kDepth-1 are server requests, kDepth..2*kDepth-1 server finishes
+  // and 2*kDepth..3*kDepth-1 client finishes.
+  std::unique_ptr<ServerEnv> server_env[kDepth];
+  for (int i = 0; i < kDepth; i++) {
+    server_env[i].reset(new ServerEnv);
+    service.RequestEcho(&server_env[i]->ctx, &server_env[i]->recv_request,
+                        &server_env[i]->response_writer, fixture->cq(),
+                        fixture->cq(), tag(i));
+  }
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  gpr_timespec total_latency = gpr_time_0(GPR_TIMESPAN);
+  for (int batch = 0; batch < kBatches; batch++) {
+    gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+    std::unique_ptr<ClientEnv> client_env[kDepth];
+    for (int i = 0; i < kDepth; i++) {
+      client_env[i].reset(new ClientEnv);
+      client_env[i]->response_reader =
+          stub->AsyncEcho(&client_env[i]->ctx, send_request, fixture->cq());
+      client_env[i]->response_reader->Finish(&client_env[i]->recv_response,
+                                             &client_env[i]->recv_status,
+                                             tag(2 * kDepth + i));
+    }
+    // Every call completes three tags: its server request, its server finish
+    // and its client finish.
+    for (int remaining = 3 * kDepth; remaining > 0; remaining--) {
+      void* t;
+      bool ok;
+      GPR_ASSERT(fixture->cq()->Next(&t, &ok));
+      GPR_ASSERT(ok);
+      int tagnum = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      if (tagnum < kDepth) {
+        server_env[tagnum]->response_writer.Finish(send_response, Status::OK,
+                                                   tag(kDepth + tagnum));
+      } else if (tagnum < 2 * kDepth) {
+        int slot = tagnum - kDepth;
+        server_env[slot].reset(new ServerEnv);
+        service.RequestEcho(
+            &server_env[slot]->ctx, &server_env[slot]->recv_request,
+            &server_env[slot]->response_writer, fixture->cq(), fixture->cq(),
+            tag(slot));
+      } else {
+        GPR_ASSERT(client_env[tagnum - 2 * kDepth]->recv_status.ok());
+      }
+    }
+    total_latency = gpr_time_add(
+        total_latency, gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start));
+  }
+
+  PipelinedResult result;
+  result.writes_per_rpc = static_cast<double>(fixture->writes_performed()) /
+                          static_cast<double>(kBatches * kDepth);
+  result.mean_batch_latency_us =
+      gpr_timespec_to_micros(total_latency) / kBatches;
+
+  fixture.reset();
+  return result;
+}
+
 TEST(WritesPerRpcTest, UnaryPingPong) {
   EXPECT_LT(UnaryPingPong(0, 0), 2.05);
   EXPECT_LT(UnaryPingPong(1, 0), 2.05);
@@ -232,6 +331,17 @@ TEST(WritesPerRpcTest, UnaryPingPong) {
   EXPECT_LT(UnaryPingPong(0, 4096), 2.5);
 }
 
+TEST(WritesPerRpcTest, PipelinedUnaryWriteCork) {
+  PipelinedResult uncorked = PipelinedUnary(0);
+  PipelinedResult corked = PipelinedUnary(1000);
+  gpr_log(GPR_INFO,
+          "pipelined unary: %.2f writes/rpc, %.1fus/batch uncorked; "
+          "%.2f writes/rpc, %.1fus/batch with a 1000us write cork",
+          uncorked.writes_per_rpc, uncorked.mean_batch_latency_us,
+          corked.writes_per_rpc, corked.mean_batch_latency_us);
+  EXPECT_LT(corked.writes_per_rpc, uncorked.writes_per_rpc);
+}
+
 }  // namespace testing
 }  // namespace grpc
 
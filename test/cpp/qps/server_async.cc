@@ -94,6 +94,8 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
       gpr_log(GPR_INFO, "Sizing async server to %d threads", num_threads);
     }
 
+    next_batch_size_ = std::max(1, config.cq_next_batch_size());
+
     int tpc = std::max(1, config.threads_per_cq());  // 1 if unspecified
     int num_cqs = (num_threads + tpc - 1) / tpc;     // ceiling operator
     for (int i = 0; i < num_cqs; i++) {
@@ -159,7 +161,10 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
 
     for (int i = 0; i < num_threads; i++) {
       shutdown_state_.emplace_back(new PerThreadShutdownState());
-      threads_.emplace_back(&AsyncQpsServerTest::ThreadFunc, this, i);
+      threads_.emplace_back(next_batch_size_ > 1
+                                ? &AsyncQpsServerTest::BatchThreadFunc
+                                : &AsyncQpsServerTest::ThreadFunc,
+                            this, i);
     }
   }
   ~AsyncQpsServerTest() override {
@@ -230,6 +235,33 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
         &got_tag, &ok, gpr_inf_future(GPR_CLOCK_REALTIME)));
   }
 
+  // Same as ThreadFunc, but retrieves up to next_batch_size_ events from the
+  // completion queue at a time.
+  void BatchThreadFunc(int thread_idx) {
+    std::unique_ptr<void*[]> got_tags(new void*[next_batch_size_]);
+    std::unique_ptr<bool[]> oks(new bool[next_batch_size_]);
+    std::mutex* mu_ptr = &shutdown_state_[thread_idx]->mutex;
+    size_t num_events;
+    while ((num_events = srv_cqs_[cq_[thread_idx]]->NextBatch(
+                got_tags.get(), oks.get(), next_batch_size_)) > 0) {
+      // Proceed while holding a lock to make sure that
+      // this thread isn't supposed to shut down
+      std::lock_guard<std::mutex> lock(*mu_ptr);
+      if (shutdown_state_[thread_idx]->shutdown) {
+        return;
+      }
+      for (size_t i = 0; i < num_events; i++) {
+        // The tag is a pointer to an RPC context to invoke
+        ServerRpcContext* ctx = detag(got_tags[i]);
+        ctx->lock();
+        if (!ctx->RunNextState(oks[i])) {
+          ctx->Reset();
+        }
+        ctx->unlock();
+      }
+    }
+  }
+
   class ServerRpcContext {
    public:
     ServerRpcContext() {}
@@ -520,6 +552,7 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
   std::unique_ptr<grpc::Server> server_;
   std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> srv_cqs_;
   std::vector<int> cq_;
+  int next_batch_size_;
   ServiceType async_service_;
   std::vector<std::unique_ptr<ServerRpcContext>> contexts_;
 
@@ -310,6 +310,112 @@ static void generate_huff_tables(void) {
   dump_ctbl("emit_sub_tbl");
 }
 
+/*
+ * Multi-symbol Huffman decoder table generation
+ */
+
+/* number of input bits the fast decoding table is indexed by */
+#define HUFF_FAST_BITS 12
+/* longest code in the HPACK huffman table (EOS) */
+#define MAX_HUFF_CODE_LENGTH 30
+
+/* returns the symbol whose code starts 'used' bits into the HUFF_FAST_BITS
+   bit value 'peek', or -1 if that code does not fit in 'peek' */
+static int fast_symbol_at(unsigned peek, unsigned used) {
+  int i;
+  for (i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
+    unsigned length = grpc_chttp2_huffsyms[i].length;
+    if (used + length > HUFF_FAST_BITS) continue;
+    if (((peek >> (HUFF_FAST_BITS - used - length)) & ((1u << length) - 1)) ==
+        grpc_chttp2_huffsyms[i].bits) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static void generate_huff_fast_table(void) {
+  unsigned peek;
+
+  printf("static const uint32_t huff_fast_tbl[%d] = {", 1 << HUFF_FAST_BITS);
+  for (peek = 0; peek < (1u << HUFF_FAST_BITS); peek++) {
+    unsigned entry = 0;
+    int first = fast_symbol_at(peek, 0);
+    if (first >= 0) {
+      unsigned first_length = grpc_chttp2_huffsyms[first].length;
+      unsigned length = first_length;
+      unsigned nsyms = 1;
+      int second = fast_symbol_at(peek, first_length);
+      GPR_ASSERT(first < 256);
+      if (second >= 0) {
+        GPR_ASSERT(second < 256);
+        length += grpc_chttp2_huffsyms[second].length;
+        nsyms = 2;
+      } else {
+        second = 0;
+      }
+      entry = (unsigned)first | ((unsigned)second << 8) |
+              (first_length << 16) | (length << 20) | (nsyms << 24);
+    }
+    printf("0x%07x,", entry);
+  }
+  printf("};\n");
+}
+
+static void generate_huff_long_tables(void) {
+  unsigned count[MAX_HUFF_CODE_LENGTH + 1];
+  unsigned first_code[MAX_HUFF_CODE_LENGTH + 1];
+  unsigned offset[MAX_HUFF_CODE_LENGTH + 1];
+  unsigned code = 0;
+  unsigned nlong = 0;
+  unsigned length;
+  int i;
+
+  memset(count, 0, sizeof(count));
+  for (i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
+    count[grpc_chttp2_huffsyms[i].length]++;
+  }
+  /* the HPACK code is canonical: codes of the same length are consecutive
+     and ordered by symbol, so a code decodes by length and offset alone */
+  for (length = 1; length <= MAX_HUFF_CODE_LENGTH; length++) {
+    first_code[length] = code;
+    offset[length] = nlong;
+    for (i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
+      if (grpc_chttp2_huffsyms[i].length != length) continue;
+      GPR_ASSERT(grpc_chttp2_huffsyms[i].bits == code);
+      code++;
+    }
+    if (length > HUFF_FAST_BITS) nlong += count[length];
+    code <<= 1;
+  }
+
+  printf("static const uint32_t huff_long_first_code[%d] = {",
+         MAX_HUFF_CODE_LENGTH + 1);
+  for (length = 0; length <= MAX_HUFF_CODE_LENGTH; length++) {
+    printf("%u,", length > HUFF_FAST_BITS ? first_code[length] : 0);
+  }
+  printf("};\n");
+  printf("static const uint8_t huff_long_count[%d] = {",
+         MAX_HUFF_CODE_LENGTH + 1);
+  for (length = 0; length <= MAX_HUFF_CODE_LENGTH; length++) {
+    printf("%u,", length > HUFF_FAST_BITS ? count[length] : 0);
+  }
+  printf("};\n");
+  printf("static const uint8_t huff_long_offset[%d] = {",
+         MAX_HUFF_CODE_LENGTH + 1);
+  for (length = 0; length <= MAX_HUFF_CODE_LENGTH; length++) {
+    printf("%u,", length > HUFF_FAST_BITS ? offset[length] : 0);
+  }
+  printf("};\n");
+  printf("static const uint16_t huff_long_syms[%d] = {", nlong);
+  for (length = HUFF_FAST_BITS + 1; length <= MAX_HUFF_CODE_LENGTH; length++) {
+    for (i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
+      if (grpc_chttp2_huffsyms[i].length == length) printf("%d,", i);
+    }
+  }
+  printf("};\n");
+}
+
 static void generate_base64_huff_encoder_table(void) {
   static const char alphabet[] =
       "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
@@ -345,6 +451,8 @@ static void generate_base64_inverse_table(void) {
 
 int main(void) {
   generate_huff_tables();
+  generate_huff_fast_table();
+  generate_huff_long_tables();
   generate_first_byte_lut();
   generate_base64_huff_encoder_table();
   generate_base64_inverse_table();
@@ -80,6 +80,12 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_tcp_backup_poller_polls"] = massage_qps_stats_helpers.counter(
                     core_stats, "tcp_backup_poller_polls")
+            stats[
+                "core_tcp_read_copy_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "tcp_read_copy_bytes")
+            stats[
+                "core_tcp_read_zerocopy_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "tcp_read_zerocopy_bytes")
             stats["core_http2_op_batches"] = massage_qps_stats_helpers.counter(
                 core_stats, "http2_op_batches")
             stats["core_http2_op_cancel"] = massage_qps_stats_helpers.counter(
@@ -299,6 +305,9 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_executor_queue_drained"] = massage_qps_stats_helpers.counter(
                     core_stats, "executor_queue_drained")
+            stats[
+                "core_executor_closures_stolen"] = massage_qps_stats_helpers.counter(
+                    core_stats, "executor_closures_stolen")
             stats[
                 "core_executor_push_retries"] = massage_qps_stats_helpers.counter(
                     core_stats, "executor_push_retries")
@@ -308,6 +317,18 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_server_slowpath_requests_queued"] = massage_qps_stats_helpers.counter(
                     core_stats, "server_slowpath_requests_queued")
+            stats[
+                "core_tls_server_full_handshakes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "tls_server_full_handshakes")
+            stats[
+                "core_tls_server_resumed_handshakes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "tls_server_resumed_handshakes")
+            stats[
+                "core_tls_peer_verification_cache_hits"] = massage_qps_stats_helpers.counter(
+                    core_stats, "tls_peer_verification_cache_hits")
+            stats[
+                "core_tls_peer_verification_cache_misses"] = massage_qps_stats_helpers.counter(
+                    core_stats, "tls_peer_verification_cache_misses")
             stats[
                 "core_cq_ev_queue_trylock_failures"] = massage_qps_stats_helpers.counter(
                     core_stats, "cq_ev_queue_trylock_failures")
@@ -61,10 +61,19 @@ _FORCE_ENVIRON_FOR_WRAPPERS = {
 }
 
 _POLLING_STRATEGIES = {
-    'linux': ['epollex', 'epoll1', 'poll'],
+    'linux': ['epollex', 'epoll1', 'epoll1_sharded', 'io_uring', 'poll'],
     'mac': ['poll'],
 }
 
+# Polling strategies that run one of the engines above with extra settings,
+# mapped to the engine and the environment they need.
+_POLLING_STRATEGY_VARIANTS = {
+    # epoll1 split into per core group epoll sets
+    'epoll1_sharded': ('epoll1', {
+        'GRPC_EPOLL1_NUM_SETS': '4'
+    }),
+}
+
 
 def platform_string():
     return jobset.platform_string()
@@ -302,19 +311,24 @@ class CLanguage(object):
             if self.args.iomgr_platform == 'uv':
                 polling_strategies = ['all']
             for polling_strategy in polling_strategies:
+                poll_engine, poll_environ = _POLLING_STRATEGY_VARIANTS.get(
+                    polling_strategy, (polling_strategy, {}))
                 env = {
                     'GRPC_DEFAULT_SSL_ROOTS_FILE_PATH':
                         _ROOT + '/src/core/tsi/test_creds/ca.pem',
                     'GRPC_POLL_STRATEGY':
-                        polling_strategy,
+                        poll_engine,
                     'GRPC_VERBOSITY':
                         'DEBUG'
                 }
+                env.update(poll_environ)
                 resolver = os.environ.get('GRPC_DNS_RESOLVER', None)
                 if resolver:
                     env['GRPC_DNS_RESOLVER'] = resolver
-                shortname_ext = '' if polling_strategy == 'all' else ' GRPC_POLL_STRATEGY=%s' % polling_strategy
-                if polling_strategy in target.get('excluded_poll_engines', []):
+                shortname_ext = '' if polling_strategy == 'all' else ' GRPC_POLL_STRATEGY=%s' % poll_engine
+                for name, value in sorted(poll_environ.items()):
+                    shortname_ext += ' %s=%s' % (name, value)
+                if poll_engine in target.get('excluded_poll_engines', []):
                     continue
 
                 timeout_scaling = 1
@@ -1760,6 +1774,18 @@ def _has_epollexclusive():
         return False
 
 
+def _has_io_uring():
+    """The io_uring engine needs multishot poll requests (Linux 5.13)."""
+    match = re.match(r'(\d+)\.(\d+)', platform.release())
+    if not match or (int(match.group(1)), int(match.group(2))) < (5, 13):
+        return False
+    try:
+        with open('/proc/sys/kernel/io_uring_disabled') as f:
+            return f.read().strip() == '0'
+    except IOError:
+        return True
+
+
 # returns a list of things that failed (or an empty list on success)
 def _build_and_run(check_cancelled,
                    newline_on_success,
@@ -1787,6 +1813,12 @@ def _build_and_run(check_cancelled,
         print('\n\nOmitting EPOLLEXCLUSIVE tests\n\n')
         _POLLING_STRATEGIES[platform_string()].remove('epollex')
 
+    if not _has_io_uring() and platform_string(
+    ) in _POLLING_STRATEGIES and 'io_uring' in _POLLING_STRATEGIES[
+            platform_string()]:
+        print('\n\nOmitting io_uring tests\n\n')
+        _POLLING_STRATEGIES[platform_string()].remove('io_uring')
+
     # start antagonists
     antagonists = [
         subprocess.Popen(['tools/run_tests/python_utils/antagonist.py'])